@@ -14,6 +14,8 @@
 #include <linux/list_sort.h>
 #include <linux/workqueue.h>
 #include <linux/hashtable.h>
+#include <linux/hash.h>
+#include <linux/percpu.h>
 #include <linux/netdevice.h>
 #include "rmnet_config.h"
 #include "rmnet_aps.h"
@@ -35,6 +37,9 @@ static char*verinfo[]={"\x37\x34\x31\x35\x39\x32\x31\x63",
 #define DATARMNETe1763a8705 (0xbf7+4364-0x1c04)
 #define DATARMNET3bc5e7094a (0xd0a+237-0xdf2)
 #define DATARMNET810b8d04cd 55932
+#define DATARMNET7064010e19 (0xd11+230-0xdf3)
+#define DATARMNETef6ca062ff ((0xd26+209-0xdf6)<<DATARMNET7064010e19)
+#define DATARMNETe83551d25f (HZ/(0xd27+224-0xdfd))
 #define DATARMNET7b5bbaa047 ((0xd18+223-0xdf4))
 #define DATARMNETfd026b105a (DATARMNET7b5bbaa047 * HZ)
 #define DATARMNET65d0d735fa ((0xdf7+6169-0x241c) * (0xdf7+2629-0x143c) * \
@@ -51,8 +56,13 @@ DATARMNET7520901fb5);struct DATARMNET6fd48c33f6{struct hlist_node hash_list;
 struct list_head DATARMNETed4d7b4a3c;struct DATARMNET5d4139d9d7 
 DATARMNET54338da2ff;u32 DATARMNET556cdfb5eb;u32 DATARMNETee01ad514b;unsigned 
 long expires;u64 DATARMNETa27e524d8a;bool DATARMNET626c626b74;bool 
-DATARMNET40bb1d945b;};extern void(*rmnet_aps_set_prio)(struct net_device*
-DATARMNET413e8dcf7b,struct sk_buff*DATARMNET543491eb0f);extern struct 
+DATARMNET40bb1d945b;};struct DATARMNETde75e7f7e2{u32 DATARMNETf00ec0a044;u32 
+DATARMNETa781640ac9;u32 DATARMNETc50e787e1b;u32 DATARMNET4343097c50;unsigned 
+long DATARMNET8bc42f0992;bool DATARMNETafb1b7c23c;};struct DATARMNET1266b0548a{
+struct DATARMNETde75e7f7e2 DATARMNET3d9b72c1f9[DATARMNETef6ca062ff];};static 
+DEFINE_PER_CPU(struct DATARMNET1266b0548a,DATARMNETd87b2e1749);static u32 
+DATARMNETd26a26a08c=(0xd26+209-0xdf6);extern void(*rmnet_aps_set_prio)(struct 
+net_device*DATARMNET413e8dcf7b,struct sk_buff*DATARMNET543491eb0f);extern struct 
 genl_family DATARMNETcdba30eca9;static void DATARMNET30dd480cad(struct 
 net_device*DATARMNET413e8dcf7b,struct sk_buff*DATARMNET543491eb0f);static void 
 DATARMNET446f780f19(u32 DATARMNETbb588401ec,u8 DATARMNETf8bbe3b0fb);static void 
@@ -62,7 +72,10 @@ work_struct*DATARMNET33110a3ff5);static DECLARE_DELAYED_WORK(DATARMNET3481998252
 ,DATARMNET5979020f87);static int DATARMNET998f6cbce7(struct notifier_block*
 DATARMNET272c159b3c,unsigned long DATARMNET9a4761f31c,void*DATARMNETaef95eabe8);
 static struct notifier_block DATARMNETc580548769 __read_mostly={.notifier_call=
-DATARMNET998f6cbce7,.priority=(0xd1f+216-0xdf5),};static struct 
+DATARMNET998f6cbce7,.priority=(0xd1f+216-0xdf5),};static void 
+DATARMNET5e3314549b(void){u32 DATARMNETa781640ac9=DATARMNETd26a26a08c+
+(0xd26+209-0xdf6);if(!DATARMNETa781640ac9)DATARMNETa781640ac9=(0xd26+209-0xdf6);
+WRITE_ONCE(DATARMNETd26a26a08c,DATARMNETa781640ac9);}static struct 
 DATARMNET6fd48c33f6*DATARMNET3ed11fdc8d(u32 DATARMNETbb588401ec){struct 
 DATARMNET6fd48c33f6*DATARMNETaa568481cf;hash_for_each_possible(
 DATARMNET2ee773c365,DATARMNETaa568481cf,hash_list,DATARMNETbb588401ec){if(
@@ -80,16 +93,17 @@ void DATARMNET7fa3dd63cb(struct DATARMNET6fd48c33f6*DATARMNETaa568481cf){
 hash_del(&DATARMNETaa568481cf->hash_list);list_del(&DATARMNETaa568481cf->
 DATARMNETed4d7b4a3c);if(likely(DATARMNETfef55eaf9a))DATARMNETfef55eaf9a--;else 
 DATARMNET112d724eff("aps: flow count is aleady 0\n");if(!DATARMNETfef55eaf9a){
-WRITE_ONCE(rmnet_aps_set_prio,NULL);del_timer(&DATARMNETd21629e047);}kfree(
-DATARMNETaa568481cf);}static void DATARMNET9ac8a34003(void){struct 
-DATARMNET6fd48c33f6*DATARMNETaa568481cf,*DATARMNETaf503e06a5;struct hlist_node*
-DATARMNET0386f6f82a;int DATARMNET5c2fd31d7b;del_timer(&DATARMNETd21629e047);
-list_for_each_entry_safe(DATARMNETaa568481cf,DATARMNETaf503e06a5,&
-DATARMNET7520901fb5,DATARMNETed4d7b4a3c){list_del(&DATARMNETaa568481cf->
-DATARMNETed4d7b4a3c);}hash_for_each_safe(DATARMNET2ee773c365,DATARMNET5c2fd31d7b
-,DATARMNET0386f6f82a,DATARMNETaa568481cf,hash_list){hash_del(&
-DATARMNETaa568481cf->hash_list);kfree(DATARMNETaa568481cf);}DATARMNETfef55eaf9a=
-(0xd2d+202-0xdf7);WRITE_ONCE(rmnet_aps_set_prio,NULL);DATARMNET112d724eff(
+WRITE_ONCE(rmnet_aps_set_prio,NULL);del_timer(&DATARMNETd21629e047);}
+DATARMNET5e3314549b();kfree(DATARMNETaa568481cf);}static void 
+DATARMNET9ac8a34003(void){struct DATARMNET6fd48c33f6*DATARMNETaa568481cf,*
+DATARMNETaf503e06a5;struct hlist_node*DATARMNET0386f6f82a;int 
+DATARMNET5c2fd31d7b;del_timer(&DATARMNETd21629e047);list_for_each_entry_safe(
+DATARMNETaa568481cf,DATARMNETaf503e06a5,&DATARMNET7520901fb5,DATARMNETed4d7b4a3c
+){list_del(&DATARMNETaa568481cf->DATARMNETed4d7b4a3c);}hash_for_each_safe(
+DATARMNET2ee773c365,DATARMNET5c2fd31d7b,DATARMNET0386f6f82a,DATARMNETaa568481cf,
+hash_list){hash_del(&DATARMNETaa568481cf->hash_list);kfree(DATARMNETaa568481cf);
+}DATARMNETfef55eaf9a=(0xd2d+202-0xdf7);WRITE_ONCE(rmnet_aps_set_prio,NULL);
+DATARMNET112d724eff(
 "\x61\x70\x73\x3a\x20\x61\x6c\x6c\x20\x66\x6c\x6f\x77\x73\x20\x72\x65\x6d\x6f\x76\x65\x64" "\n"
 );}static void DATARMNET250448eb06(int ifindex){struct DATARMNET6fd48c33f6*
 DATARMNETaa568481cf;struct hlist_node*DATARMNET0386f6f82a;int 
@@ -163,13 +177,14 @@ DATARMNET112d724eff(
 DATARMNETbb588401ec,DATARMNETaa568481cf->DATARMNETa27e524d8a,DATARMNETaa568481cf
 ->DATARMNET40bb1d945b,DATARMNETd39b09fa66);}if(DATARMNETaa568481cf->
 DATARMNETa27e524d8a){DATARMNETd3eb49eab3=true;DATARMNETaa568481cf->
-DATARMNETa27e524d8a=(0xd2d+202-0xdf7);}}spin_unlock_bh(&DATARMNET33bd4139f4);if(
-DATARMNETd3eb49eab3)schedule_delayed_work(&DATARMNET3481998252,
-DATARMNETfd026b105a);}static int DATARMNET82d65f9ca6(struct DATARMNET5d4139d9d7*
-DATARMNETddcafd8b91){struct DATARMNET6fd48c33f6*DATARMNETaa568481cf;
-DATARMNETaa568481cf=DATARMNET3ed11fdc8d(DATARMNETddcafd8b91->DATARMNETbb588401ec
-);if(DATARMNETddcafd8b91->cmd==DATARMNET3412b803e1){if(DATARMNETaa568481cf){
-DATARMNET7fa3dd63cb(DATARMNETaa568481cf);DATARMNET112d724eff(
+DATARMNETa27e524d8a=(0xd2d+202-0xdf7);}}DATARMNET5e3314549b();spin_unlock_bh(&
+DATARMNET33bd4139f4);if(DATARMNETd3eb49eab3)schedule_delayed_work(&
+DATARMNET3481998252,DATARMNETfd026b105a);}static int DATARMNET82d65f9ca6(struct 
+DATARMNET5d4139d9d7*DATARMNETddcafd8b91){struct DATARMNET6fd48c33f6*
+DATARMNETaa568481cf;DATARMNETaa568481cf=DATARMNET3ed11fdc8d(DATARMNETddcafd8b91
+->DATARMNETbb588401ec);if(DATARMNETddcafd8b91->cmd==DATARMNET3412b803e1){if(
+DATARMNETaa568481cf){DATARMNET7fa3dd63cb(DATARMNETaa568481cf);
+DATARMNET112d724eff(
 "\x61\x70\x73\x3a\x20\x66\x6c\x6f\x77\x20\x30\x78\x25\x78\x20\x72\x65\x6d\x6f\x76\x65\x64\x2c\x20\x63\x6e\x74\x20\x25\x75" "\n"
 ,DATARMNETddcafd8b91->DATARMNETbb588401ec,DATARMNETfef55eaf9a);}else{
 DATARMNET112d724eff(
@@ -232,14 +247,31 @@ DATARMNETa13fcf9070,GFP_ATOMIC)){DATARMNET112d724eff(
 "\x61\x70\x73\x20\x63\x6c\x69\x65\x6e\x74\x20\x73\x65\x6e\x64\x20\x66\x61\x69\x6c\x65\x64\x2e\x20\x64\x69\x73\x61\x62\x6c\x65\x20\x63\x6c\x69\x65\x6e\x74" "\n"
 );DATARMNET7d98961cbe.snd_portid=(0xd2d+202-0xdf7);}}static void 
 DATARMNET30dd480cad(struct net_device*DATARMNET413e8dcf7b,struct sk_buff*
-DATARMNET543491eb0f){struct DATARMNET6fd48c33f6*DATARMNETaa568481cf;if(
-DATARMNET543491eb0f->priority>>(0xeb7+1158-0x132d)!=DATARMNET2fe4661b82)return;
-if(!READ_ONCE(DATARMNETfef55eaf9a))return;spin_lock_bh(&DATARMNET33bd4139f4);
-DATARMNETaa568481cf=DATARMNET3ed11fdc8d(DATARMNET543491eb0f->priority);if(
-DATARMNETaa568481cf){DATARMNET543491eb0f->priority=DATARMNETaa568481cf->
+DATARMNET543491eb0f){struct DATARMNET6fd48c33f6*DATARMNETaa568481cf;struct 
+DATARMNETde75e7f7e2*DATARMNET3d9b72c1f9;u32 DATARMNETf00ec0a044=
+DATARMNET543491eb0f->priority;if(DATARMNETf00ec0a044>>(0xeb7+1158-0x132d)!=
+DATARMNET2fe4661b82)return;if(!READ_ONCE(DATARMNETfef55eaf9a))return;
+DATARMNET3d9b72c1f9=&this_cpu_ptr(&DATARMNETd87b2e1749)->DATARMNET3d9b72c1f9[
+hash_32(DATARMNETf00ec0a044,DATARMNET7064010e19)];if(DATARMNET3d9b72c1f9->
+DATARMNETa781640ac9==READ_ONCE(DATARMNETd26a26a08c)&&DATARMNET3d9b72c1f9->
+DATARMNETf00ec0a044==DATARMNETf00ec0a044&&time_before(jiffies,
+DATARMNET3d9b72c1f9->DATARMNET8bc42f0992+DATARMNETe83551d25f)){if(
+DATARMNET3d9b72c1f9->DATARMNETafb1b7c23c){DATARMNET543491eb0f->priority=
+DATARMNET3d9b72c1f9->DATARMNETc50e787e1b;DATARMNET3d9b72c1f9->
+DATARMNET4343097c50+=DATARMNET543491eb0f->len;}return;}spin_lock_bh(&
+DATARMNET33bd4139f4);DATARMNETaa568481cf=DATARMNET3ed11fdc8d(DATARMNETf00ec0a044
+);if(DATARMNETaa568481cf){DATARMNET543491eb0f->priority=DATARMNETaa568481cf->
 DATARMNET556cdfb5eb;DATARMNETaa568481cf->expires=jiffies+DATARMNETaa568481cf->
 DATARMNETee01ad514b;DATARMNETaa568481cf->DATARMNETa27e524d8a+=
-DATARMNET543491eb0f->len;}spin_unlock_bh(&DATARMNET33bd4139f4);if(
+DATARMNET543491eb0f->len;if(DATARMNET3d9b72c1f9->DATARMNETf00ec0a044==
+DATARMNETf00ec0a044&&DATARMNET3d9b72c1f9->DATARMNETafb1b7c23c)
+DATARMNETaa568481cf->DATARMNETa27e524d8a+=DATARMNET3d9b72c1f9->
+DATARMNET4343097c50;DATARMNET3d9b72c1f9->DATARMNETc50e787e1b=DATARMNETaa568481cf
+->DATARMNET556cdfb5eb;}DATARMNET3d9b72c1f9->DATARMNETf00ec0a044=
+DATARMNETf00ec0a044;DATARMNET3d9b72c1f9->DATARMNETa781640ac9=DATARMNETd26a26a08c
+;DATARMNET3d9b72c1f9->DATARMNETafb1b7c23c=!!DATARMNETaa568481cf;
+DATARMNET3d9b72c1f9->DATARMNET4343097c50=(0xd2d+202-0xdf7);DATARMNET3d9b72c1f9->
+DATARMNET8bc42f0992=jiffies;spin_unlock_bh(&DATARMNET33bd4139f4);if(
 DATARMNETaa568481cf)schedule_delayed_work(&DATARMNET3481998252,
 DATARMNETfd026b105a);}static int DATARMNET998f6cbce7(struct notifier_block*
 DATARMNET272c159b3c,unsigned long DATARMNET9a4761f31c,void*DATARMNETaef95eabe8){
@@ -272,12 +304,13 @@ DATARMNETddcafd8b91.DATARMNETbb588401ec;DATARMNET112d724eff(
 ,DATARMNET2fe4661b82);DATARMNETb14e52a504=(0xd2d+202-0xdf7);break;case 
 DATARMNETceae994093:case DATARMNET3412b803e1:case DATARMNET1efd633004:
 DATARMNETb14e52a504=DATARMNET82d65f9ca6(&DATARMNETddcafd8b91);break;default:
-DATARMNETb14e52a504=-EINVAL;break;}spin_unlock_bh(&DATARMNET33bd4139f4);
-DATARMNETa13fcf9070.cmd=DATARMNETddcafd8b91.cmd;DATARMNETa13fcf9070.
-DATARMNETe65883bfce=DATARMNETb14e52a504;DATARMNETa13fcf9070.DATARMNETbb588401ec=
-DATARMNETddcafd8b91.DATARMNETbb588401ec;DATARMNETb14e52a504=DATARMNET1d51fe00f2(
-DATARMNET54338da2ff,&DATARMNETa13fcf9070,GFP_KERNEL);return DATARMNETb14e52a504;
-}static int __init DATARMNET0718a3fa4c(void){int DATARMNETb14e52a504;pr_info(
+DATARMNETb14e52a504=-EINVAL;break;}DATARMNET5e3314549b();spin_unlock_bh(&
+DATARMNET33bd4139f4);DATARMNETa13fcf9070.cmd=DATARMNETddcafd8b91.cmd;
+DATARMNETa13fcf9070.DATARMNETe65883bfce=DATARMNETb14e52a504;DATARMNETa13fcf9070.
+DATARMNETbb588401ec=DATARMNETddcafd8b91.DATARMNETbb588401ec;DATARMNETb14e52a504=
+DATARMNET1d51fe00f2(DATARMNET54338da2ff,&DATARMNETa13fcf9070,GFP_KERNEL);return 
+DATARMNETb14e52a504;}static int __init DATARMNET0718a3fa4c(void){int 
+DATARMNETb14e52a504;pr_info(
 "\x61\x70\x73\x3a\x20\x69\x6e\x69\x74\x20\x28\x25\x73\x29" "\n",
 DATARMNETe5ef0e617c);DATARMNETb14e52a504=DATARMNETcfa8d492f8();if(
 DATARMNETb14e52a504){pr_err(
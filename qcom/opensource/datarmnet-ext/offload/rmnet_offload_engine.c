@@ -13,6 +13,10 @@
 #include <linux/log2.h>
 #include <linux/list.h>
 #include <linux/hashtable.h>
+#include <linux/hrtimer.h>
+#include <linux/interrupt.h>
+#include <linux/ktime.h>
+#include <linux/version.h>
 #include "rmnet_descriptor.h"
 #include "rmnet_offload_state.h"
 #include "rmnet_offload_engine.h"
@@ -91,10 +95,40 @@ DATARMNET57d435b225%=DATARMNET78d9393ac8;hash_del(&DATARMNET6745427f98->
 DATARMNETbd5d7d96d8);if(DATARMNET6745427f98->DATARMNET1db11fa85e){
 DATARMNETa00cda79d0(DATARMNETf3f92fc0b9);DATARMNETa3055c21f2(DATARMNET6745427f98
 ,&DATARMNET6f9bfa17e6);}DATARMNETc70e73c8d4(&DATARMNET6f9bfa17e6);return 
-DATARMNET6745427f98;}static void DATARMNETbe30d096c6(void){LIST_HEAD(
-DATARMNET6f9bfa17e6);DATARMNET664568fcd0();if(DATARMNETae70636c90(&
-DATARMNET6f9bfa17e6))DATARMNETa00cda79d0(DATARMNET5727f095ec);
-DATARMNET6a76048590();DATARMNETc70e73c8d4(&DATARMNET6f9bfa17e6);}void 
+DATARMNET6745427f98;}static u32 DATARMNET7f96b87926(struct list_head*
+DATARMNET6f9bfa17e6){struct DATARMNET70f3b87b5d*DATARMNETe05748b000=
+DATARMNETc2a630b113();struct DATARMNETd7c9631acd*DATARMNETaa568481cf;u64 
+DATARMNETee0ce4feb8=ktime_get_ns();u64 DATARMNET34ccd5cb0d=U64_MAX;u32 
+DATARMNET737bbd41c3=(0xd2d+202-0xdf7);int DATARMNETae0201901a;hash_for_each(
+DATARMNET4791268d67,DATARMNETae0201901a,DATARMNETaa568481cf,DATARMNETbd5d7d96d8)
+{if(!DATARMNETaa568481cf->DATARMNET1db11fa85e)continue;if(DATARMNETaa568481cf->
+DATARMNETf6b4bad2a9<=DATARMNETee0ce4feb8){DATARMNET737bbd41c3++;
+DATARMNETa3055c21f2(DATARMNETaa568481cf,DATARMNET6f9bfa17e6);}else{
+DATARMNETa00cda79d0(DATARMNETec3c348714);DATARMNET34ccd5cb0d=min(
+DATARMNET34ccd5cb0d,DATARMNETaa568481cf->DATARMNETf6b4bad2a9);}}if(
+DATARMNET34ccd5cb0d!=U64_MAX&&!DATARMNETe05748b000->DATARMNETa6c2f8e1d4)
+hrtimer_start(&DATARMNETe05748b000->DATARMNET71d5ece65b,ns_to_ktime(
+DATARMNET34ccd5cb0d),HRTIMER_MODE_ABS_SOFT);
+return DATARMNET737bbd41c3;}
+#if LINUX_VERSION_CODE < KERNEL_VERSION(5, 9, 0)
+static void DATARMNET5a1e0f7c39(unsigned long DATARMNETd83b68738d)
+#else
+static void DATARMNET5a1e0f7c39(struct tasklet_struct*DATARMNETd83b68738d)
+#endif
+{LIST_HEAD(DATARMNET6f9bfa17e6);u32 DATARMNET737bbd41c3;DATARMNET664568fcd0();
+DATARMNET737bbd41c3=DATARMNET7f96b87926(&DATARMNET6f9bfa17e6);
+DATARMNETbad3b5165e(DATARMNETceb1110673,DATARMNET737bbd41c3);
+DATARMNET6a76048590();DATARMNETc70e73c8d4(&DATARMNET6f9bfa17e6);}static enum 
+hrtimer_restart DATARMNET4c72735045(struct hrtimer*DATARMNETd83b68738d){struct 
+DATARMNET70f3b87b5d*DATARMNETe05748b000=container_of(DATARMNETd83b68738d,struct 
+DATARMNET70f3b87b5d,DATARMNET71d5ece65b);tasklet_schedule(&DATARMNETe05748b000->
+DATARMNET8b0d3e61fa);return HRTIMER_NORESTART;}static void 
+DATARMNETbe30d096c6(void){LIST_HEAD(DATARMNET6f9bfa17e6);u32 DATARMNET737bbd41c3
+;DATARMNET664568fcd0();if(DATARMNETf1d1b8287f(DATARMNET153273ef73))
+DATARMNET737bbd41c3=DATARMNET7f96b87926(&DATARMNET6f9bfa17e6);else 
+DATARMNET737bbd41c3=DATARMNETae70636c90(&DATARMNET6f9bfa17e6);if(
+DATARMNET737bbd41c3)DATARMNETa00cda79d0(DATARMNET5727f095ec);DATARMNET6a76048590
+();DATARMNETc70e73c8d4(&DATARMNET6f9bfa17e6);}void 
 DATARMNETd4230b6bfe(void){rcu_assign_pointer(rmnet_perf_chain_end,
 DATARMNETbe30d096c6);}void DATARMNET560e127137(void){rcu_assign_pointer(
 rmnet_perf_chain_end,NULL);}int DATARMNET241493ab9a(u64 DATARMNET0470698d6c,u64 
@@ -107,14 +141,44 @@ DATARMNET88a9920663:DATARMNET737bbd41c3=DATARMNET1993bae165(DATARMNETfd5c3d30e5,
 &DATARMNET6f9bfa17e6);break;case DATARMNET5fe3af8828:DATARMNET737bbd41c3=
 DATARMNETae70636c90(&DATARMNET6f9bfa17e6);break;}DATARMNETbad3b5165e(
 DATARMNETddf572458d,DATARMNET737bbd41c3);DATARMNETc70e73c8d4(&
-DATARMNET6f9bfa17e6);return(0xd2d+202-0xdf7);}void DATARMNETa3055c21f2(struct 
+DATARMNET6f9bfa17e6);return(0xd2d+202-0xdf7);}static bool DATARMNET3faccb1c68(
+struct DATARMNETd7c9631acd*DATARMNETaa568481cf){struct rmnet_frag_descriptor*
+DATARMNET9d1b321642;if(DATARMNETaa568481cf->DATARMNET78fd20ce0e.
+DATARMNET7fa8b2acbf!=DATARMNETa656f324b2||DATARMNETaa568481cf->
+DATARMNET1db11fa85e<(0xd1f+216-0xdf5)||!DATARMNETf1d1b8287f(DATARMNETd8a4747448)
+)return false;list_for_each_entry(DATARMNET9d1b321642,&DATARMNETaa568481cf->
+DATARMNETb76b79d0d5,list){if(DATARMNET9d1b321642->gso_segs>(0xd26+209-0xdf6)){
+DATARMNETa00cda79d0(DATARMNETc4e6fafd7b);return false;}}if(!
+rmnet_frag_udp_fraglist_ok(list_first_entry(&DATARMNETaa568481cf->
+DATARMNETb76b79d0d5,struct rmnet_frag_descriptor,list))){DATARMNETa00cda79d0(
+DATARMNET2b6e0d4c91);return false;}return true;}static void
+ DATARMNETb63317aedb(struct DATARMNETd7c9631acd*DATARMNETaa568481cf,struct 
+list_head*DATARMNET6f9bfa17e6){struct rmnet_frag_descriptor*DATARMNETd74aeaa49a;
+u8 DATARMNET737bbd41c3=DATARMNETaa568481cf->DATARMNET1db11fa85e;u32 
+DATARMNET248f120dd5;if(DATARMNET737bbd41c3<=(0xd1f+216-0xdf5))
+DATARMNET248f120dd5=DATARMNETffeef4aa51;else if(DATARMNET737bbd41c3<=
+(0xd11+230-0xdf3))DATARMNET248f120dd5=DATARMNETd98d415fb5;else if(
+DATARMNET737bbd41c3<=(0xd35+210-0xdff))DATARMNET248f120dd5=DATARMNETdfdeffceab;
+else if(DATARMNET737bbd41c3<=(0xeb7+1158-0x132d))DATARMNET248f120dd5=
+DATARMNET1f1b9609b1;else if(DATARMNET737bbd41c3<=(0xeb7+1174-0x132d))
+DATARMNET248f120dd5=DATARMNET3d2f808692;else DATARMNET248f120dd5=
+DATARMNET970526891e;DATARMNETa00cda79d0(DATARMNET248f120dd5);DATARMNETd74aeaa49a
+=list_first_entry(&DATARMNETaa568481cf->DATARMNETb76b79d0d5,struct 
+rmnet_frag_descriptor,list);DATARMNETd74aeaa49a->fraglist=(0xd26+209-0xdf6);
+DATARMNETd74aeaa49a->gso_segs=DATARMNET737bbd41c3;DATARMNETd74aeaa49a->hash=
+DATARMNETaa568481cf->DATARMNET381f1cadc4;list_splice_tail_init(&
+DATARMNETaa568481cf->DATARMNETb76b79d0d5,DATARMNET6f9bfa17e6);
+DATARMNETaa568481cf->DATARMNET1db11fa85e=(0xd2d+202-0xdf7);DATARMNETaa568481cf->
+DATARMNETcf28ae376b=(0xd2d+202-0xdf7);}void DATARMNETa3055c21f2(struct 
 DATARMNETd7c9631acd*DATARMNETaa568481cf,struct list_head*DATARMNET6f9bfa17e6){
 struct DATARMNET70f3b87b5d*DATARMNETe05748b000=DATARMNETc2a630b113();struct 
 rmnet_frag_descriptor*DATARMNETd74aeaa49a,*DATARMNETa1625e27e2,*
 DATARMNET0386f6f82a;struct DATARMNET4287f07234*DATARMNET699c2c62cd=&
 DATARMNETaa568481cf->DATARMNET78fd20ce0e;u32 DATARMNET567bdc7221=
 DATARMNET699c2c62cd->DATARMNET4ca5ac9de1+DATARMNET699c2c62cd->
-DATARMNET0aeee57ceb;if(!DATARMNETaa568481cf->DATARMNET1db11fa85e)return;
+DATARMNET0aeee57ceb;if(!DATARMNETaa568481cf->DATARMNET1db11fa85e)return;if(
+DATARMNET3faccb1c68(DATARMNETaa568481cf)){DATARMNETb63317aedb(
+DATARMNETaa568481cf,DATARMNET6f9bfa17e6);return;}
 DATARMNETd74aeaa49a=list_first_entry(&DATARMNETaa568481cf->DATARMNETb76b79d0d5,
 struct rmnet_frag_descriptor,list);if(!DATARMNETd74aeaa49a->gso_segs)
 DATARMNETd74aeaa49a->gso_segs=(0xd26+209-0xdf6);DATARMNETd74aeaa49a->gso_size=
@@ -144,19 +208,24 @@ DATARMNET4791268d67,DATARMNETae0201901a,DATARMNETaa568481cf,DATARMNETbd5d7d96d8)
 {if(DATARMNETaa568481cf->DATARMNET1db11fa85e){DATARMNET737bbd41c3++;
 DATARMNETa3055c21f2(DATARMNETaa568481cf,DATARMNET6f9bfa17e6);}}return 
 DATARMNET737bbd41c3;}void DATARMNET33aa5df9ef(struct DATARMNETd7c9631acd*
-DATARMNETaa568481cf,struct DATARMNETd812bcdbb5*DATARMNET5fe4c722a8){if(
-DATARMNET5fe4c722a8->DATARMNETf1b6b0a6cc){memcpy(&DATARMNETaa568481cf->
-DATARMNET78fd20ce0e,&DATARMNET5fe4c722a8->DATARMNET144d119066,sizeof(
-DATARMNETaa568481cf->DATARMNET78fd20ce0e));DATARMNETaa568481cf->
-DATARMNET381f1cadc4=DATARMNET5fe4c722a8->DATARMNET645e8912b8;DATARMNETaa568481cf
-->DATARMNET1978d5d8de=(DATARMNET5fe4c722a8->DATARMNET719f68fb88->gso_size)?:
-DATARMNET5fe4c722a8->DATARMNET1ef22e4c76;}if(DATARMNET5fe4c722a8->
-DATARMNET144d119066.DATARMNET7fa8b2acbf==DATARMNETfd5c3d30e5)DATARMNETaa568481cf
-->DATARMNET78fd20ce0e.DATARMNETbc28a5970f+=DATARMNET5fe4c722a8->
-DATARMNET1ef22e4c76;list_add_tail(&DATARMNET5fe4c722a8->DATARMNET719f68fb88->
-list,&DATARMNETaa568481cf->DATARMNETb76b79d0d5);DATARMNETaa568481cf->
-DATARMNET1db11fa85e++;DATARMNETaa568481cf->DATARMNETcf28ae376b+=
-DATARMNET5fe4c722a8->DATARMNET1ef22e4c76;}bool DATARMNETfbf5798e15(struct 
+DATARMNETaa568481cf,struct DATARMNETd812bcdbb5*DATARMNET5fe4c722a8){u64 
+DATARMNET44885580f8;if(DATARMNET5fe4c722a8->DATARMNETf1b6b0a6cc){memcpy(&
+DATARMNETaa568481cf->DATARMNET78fd20ce0e,&DATARMNET5fe4c722a8->
+DATARMNET144d119066,sizeof(DATARMNETaa568481cf->DATARMNET78fd20ce0e));
+DATARMNETaa568481cf->DATARMNET381f1cadc4=DATARMNET5fe4c722a8->
+DATARMNET645e8912b8;DATARMNETaa568481cf->DATARMNET1978d5d8de=(
+DATARMNET5fe4c722a8->DATARMNET719f68fb88->gso_size)?:DATARMNET5fe4c722a8->
+DATARMNET1ef22e4c76;}if(DATARMNET5fe4c722a8->DATARMNET144d119066.
+DATARMNET7fa8b2acbf==DATARMNETfd5c3d30e5)DATARMNETaa568481cf->
+DATARMNET78fd20ce0e.DATARMNETbc28a5970f+=DATARMNET5fe4c722a8->
+DATARMNET1ef22e4c76;if(!DATARMNETaa568481cf->DATARMNET1db11fa85e){
+DATARMNET44885580f8=DATARMNETf1d1b8287f(DATARMNET153273ef73);DATARMNETaa568481cf
+->DATARMNETf6b4bad2a9=(DATARMNET44885580f8)?ktime_get_ns()+DATARMNET44885580f8*
+NSEC_PER_USEC:(0xd2d+202-0xdf7);}list_add_tail(&DATARMNET5fe4c722a8->
+DATARMNET719f68fb88->list,&DATARMNETaa568481cf->DATARMNETb76b79d0d5);
+DATARMNETaa568481cf->DATARMNET1db11fa85e++;DATARMNETaa568481cf->
+DATARMNETcf28ae376b+=DATARMNET5fe4c722a8->DATARMNET1ef22e4c76;}bool 
+DATARMNETfbf5798e15(struct 
 DATARMNETd812bcdbb5*DATARMNET5fe4c722a8,struct list_head*DATARMNET6f9bfa17e6){
 struct DATARMNETd7c9631acd*DATARMNETaa568481cf;bool DATARMNET885970f252=false;u8
  DATARMNET9695aa5b1d=DATARMNET5fe4c722a8->DATARMNET144d119066.
@@ -177,13 +246,27 @@ DATARMNET645e8912b8;hash_add(DATARMNET4791268d67,&DATARMNETaa568481cf->
 DATARMNETbd5d7d96d8,DATARMNETaa568481cf->DATARMNET381f1cadc4);goto 
 DATARMNETc6f994577c;}return false;}void DATARMNETb98b78b8e3(void){struct 
 DATARMNETd7c9631acd*DATARMNETaa568481cf;struct hlist_node*DATARMNET0386f6f82a;
-int DATARMNETae0201901a;hash_for_each_safe(DATARMNET4791268d67,
-DATARMNETae0201901a,DATARMNET0386f6f82a,DATARMNETaa568481cf,DATARMNETbd5d7d96d8)
-hash_del(&DATARMNETaa568481cf->DATARMNETbd5d7d96d8);}int DATARMNETdbcaf01255(
-void){struct DATARMNET70f3b87b5d*DATARMNETe05748b000=DATARMNETc2a630b113();u8 
-DATARMNETefc9df3df2;for(DATARMNETefc9df3df2=(0xd2d+202-0xdf7);
-DATARMNETefc9df3df2<DATARMNET78d9393ac8;DATARMNETefc9df3df2++){struct 
-DATARMNETd7c9631acd*DATARMNETaa568481cf;DATARMNETaa568481cf=&DATARMNETe05748b000
-->DATARMNETebb45c8d86.DATARMNET2846a01cce[DATARMNETefc9df3df2];INIT_LIST_HEAD(&
-DATARMNETaa568481cf->DATARMNETb76b79d0d5);INIT_HLIST_NODE(&DATARMNETaa568481cf->
-DATARMNETbd5d7d96d8);}return DATARMNET0529bb9c4e;}
+int DATARMNETae0201901a;hash_for_each_safe(
+DATARMNET4791268d67,DATARMNETae0201901a,DATARMNET0386f6f82a,DATARMNETaa568481cf,
+DATARMNETbd5d7d96d8)hash_del(&DATARMNETaa568481cf->DATARMNETbd5d7d96d8);}void 
+DATARMNET9a3e5b7c21(void){struct DATARMNET70f3b87b5d*DATARMNETe05748b000=
+DATARMNETc2a630b113();DATARMNET664568fcd0();DATARMNETe05748b000->
+DATARMNETa6c2f8e1d4=true;DATARMNET6a76048590();hrtimer_cancel(&
+DATARMNETe05748b000->DATARMNET71d5ece65b);tasklet_kill(&DATARMNETe05748b000->
+DATARMNET8b0d3e61fa);}int DATARMNETdbcaf01255(void){struct DATARMNET70f3b87b5d*
+DATARMNETe05748b000=DATARMNETc2a630b113();u8 DATARMNETefc9df3df2;for(
+DATARMNETefc9df3df2=(0xd2d+202-0xdf7);DATARMNETefc9df3df2<DATARMNET78d9393ac8;
+DATARMNETefc9df3df2++){struct DATARMNETd7c9631acd*DATARMNETaa568481cf;
+DATARMNETaa568481cf=&DATARMNETe05748b000->DATARMNETebb45c8d86.
+DATARMNET2846a01cce[DATARMNETefc9df3df2];INIT_LIST_HEAD(&DATARMNETaa568481cf->
+DATARMNETb76b79d0d5);INIT_HLIST_NODE(&DATARMNETaa568481cf->DATARMNETbd5d7d96d8);
+}hrtimer_init(&DATARMNETe05748b000->DATARMNET71d5ece65b,CLOCK_MONOTONIC,
+HRTIMER_MODE_ABS_SOFT);DATARMNETe05748b000->DATARMNET71d5ece65b.function=
+DATARMNET4c72735045;
+#if LINUX_VERSION_CODE < KERNEL_VERSION(5, 9, 0)
+tasklet_init(&DATARMNETe05748b000->DATARMNET8b0d3e61fa,DATARMNET5a1e0f7c39,
+(0xd2d+202-0xdf7));
+#else
+tasklet_setup(&DATARMNETe05748b000->DATARMNET8b0d3e61fa,DATARMNET5a1e0f7c39);
+#endif
+DATARMNETe05748b000->DATARMNETa6c2f8e1d4=false;return DATARMNET0529bb9c4e;}
@@ -19,9 +19,10 @@ enum{DATARMNET7af645849a,DATARMNETb0bd5db24d,DATARMNET0413b43080,};enum{
 DATARMNETa2ddeec85f,DATARMNET2d89680280=DATARMNETa2ddeec85f,DATARMNET03daf91a60,
 DATARMNET88a9920663,DATARMNET5fe3af8828,DATARMNETaccb69cf16=DATARMNET5fe3af8828,
 };struct DATARMNETd7c9631acd{struct hlist_node DATARMNETbd5d7d96d8;struct 
-list_head DATARMNETb76b79d0d5;struct DATARMNET4287f07234 DATARMNET78fd20ce0e;u32
- DATARMNET381f1cadc4;u16 DATARMNETcf28ae376b;u32 DATARMNETd3a1a2b9b5;u16 
-DATARMNET1978d5d8de;u8 DATARMNET1db11fa85e;};struct DATARMNET907d58c807{struct 
+list_head DATARMNETb76b79d0d5;struct DATARMNET4287f07234 DATARMNET78fd20ce0e;u64
+ DATARMNETf6b4bad2a9;u32 DATARMNET381f1cadc4;u16 DATARMNETcf28ae376b;u32 
+DATARMNETd3a1a2b9b5;u16 DATARMNET1978d5d8de;u8 DATARMNET1db11fa85e;};struct 
+DATARMNET907d58c807{struct 
 DATARMNETd7c9631acd DATARMNET2846a01cce[DATARMNET78d9393ac8];u8 
 DATARMNET8dfc11cccd;u8 DATARMNET57d435b225;};void DATARMNETd4230b6bfe(void);void
  DATARMNET560e127137(void);int DATARMNET241493ab9a(u64 DATARMNET0470698d6c,u64 
@@ -32,6 +33,7 @@ DATARMNETc38c135c9f(u32 DATARMNET3f8cc6fc24,struct list_head*DATARMNET6f9bfa17e6
 DATARMNET33aa5df9ef(struct DATARMNETd7c9631acd*DATARMNETaa568481cf,struct 
 DATARMNETd812bcdbb5*DATARMNET5fe4c722a8);bool DATARMNETfbf5798e15(struct 
 DATARMNETd812bcdbb5*DATARMNET5fe4c722a8,struct list_head*DATARMNET6f9bfa17e6);
-void DATARMNETb98b78b8e3(void);int DATARMNETdbcaf01255(void);
+void DATARMNETb98b78b8e3(void);void DATARMNET9a3e5b7c21(void);int 
+DATARMNETdbcaf01255(void);
 #endif
 
@@ -14,5 +14,7 @@
 #define DATARMNET5833be0738
 #include <linux/types.h>
 enum{DATARMNETdf66588a73,DATARMNET9c85bb95a3,DATARMNET6d2ed4b822,
-DATARMNET94aa767bca,};u64 DATARMNETf1d1b8287f(u32 DATARMNET4c4a5ce272);
+DATARMNETd8a4747448,DATARMNET60793d2cab,DATARMNETef1c8818c4,DATARMNET153273ef73,
+DATARMNET94aa767bca,};u64 DATARMNETf1d1b8287f(u32 
+DATARMNET4c4a5ce272);
 #endif
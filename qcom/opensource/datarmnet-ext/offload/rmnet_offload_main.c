@@ -218,13 +218,25 @@ DATARMNETba38823a2f(void){rcu_assign_pointer(rmnet_perf_desc_entry,NULL);}bool
 DATARMNET19eb0de3b2(void){void(*DATARMNET27ebcde4bf)(struct 
 rmnet_frag_descriptor*DATARMNET9d1b321642,struct rmnet_port*DATARMNETf0d9de7e2f)
 ;rcu_read_lock();DATARMNET27ebcde4bf=rcu_dereference(rmnet_perf_desc_entry);
-rcu_read_unlock();return DATARMNET27ebcde4bf!=NULL;}void DATARMNETc70e73c8d4(
-struct list_head*DATARMNETb5730f5283){struct DATARMNET70f3b87b5d*
-DATARMNETe05748b000=DATARMNETc2a630b113();struct rmnet_frag_descriptor*
-DATARMNET9d1b321642,*DATARMNET0386f6f82a;list_for_each_entry_safe(
-DATARMNET9d1b321642,DATARMNET0386f6f82a,DATARMNETb5730f5283,list){
-DATARMNETe26a68d20e(DATARMNET9d1b321642->len);DATARMNETa00cda79d0(
-DATARMNET65843ad009);list_del_init(&DATARMNET9d1b321642->list);
+rcu_read_unlock();return DATARMNET27ebcde4bf!=NULL;}static void 
+DATARMNET047415b293(struct rmnet_frag_descriptor*DATARMNETd74aeaa49a,struct 
+list_head*DATARMNETb5730f5283){struct DATARMNET70f3b87b5d*DATARMNETe05748b000=
+DATARMNETc2a630b113();struct rmnet_frag_descriptor*DATARMNET9d1b321642=
+DATARMNETd74aeaa49a;u16 DATARMNET737bbd41c3=DATARMNETd74aeaa49a->gso_segs;
+LIST_HEAD(DATARMNETae92ad8503);DATARMNETd74aeaa49a->fraglist=(0xd2d+202-0xdf7);
+DATARMNETd74aeaa49a->gso_segs=(0xd2d+202-0xdf7);while(--DATARMNET737bbd41c3&&!
+list_is_last(&DATARMNET9d1b321642->list,DATARMNETb5730f5283))DATARMNET9d1b321642
+=list_next_entry(DATARMNET9d1b321642,list);list_cut_position(&
+DATARMNETae92ad8503,DATARMNETb5730f5283,&DATARMNET9d1b321642->list);
+rmnet_frag_deliver_fraglist(&DATARMNETae92ad8503,DATARMNETe05748b000->
+DATARMNET403589239f);}void DATARMNETc70e73c8d4(struct list_head*
+DATARMNETb5730f5283){struct DATARMNET70f3b87b5d*DATARMNETe05748b000=
+DATARMNETc2a630b113();struct rmnet_frag_descriptor*DATARMNET9d1b321642;while(!
+list_empty(DATARMNETb5730f5283)){DATARMNET9d1b321642=list_first_entry(
+DATARMNETb5730f5283,struct rmnet_frag_descriptor,list);DATARMNETe26a68d20e(
+DATARMNET9d1b321642->len);DATARMNETa00cda79d0(DATARMNET65843ad009);if(
+DATARMNET9d1b321642->fraglist){DATARMNET047415b293(DATARMNET9d1b321642,
+DATARMNETb5730f5283);continue;}list_del_init(&DATARMNET9d1b321642->list);
 rmnet_frag_deliver(DATARMNET9d1b321642,DATARMNETe05748b000->DATARMNET403589239f)
 ;}}void DATARMNET19d190f2bd(struct DATARMNETd812bcdbb5*DATARMNET458b70e7e5,
 struct list_head*DATARMNET6f9bfa17e6){struct rmnet_frag_descriptor*
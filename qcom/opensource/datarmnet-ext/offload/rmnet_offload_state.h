@@ -12,6 +12,7 @@
 
 #ifndef DATARMNETc03e325706
 #define DATARMNETc03e325706
+#include <linux/interrupt.h>
 #include "rmnet_offload_engine.h"
 #include "rmnet_map.h"
 #include "rmnet_descriptor.h"
@@ -24,7 +25,9 @@ DATARMNETe2251ce433;u32 DATARMNET7f59b108db;bool DATARMNETc2832b8f85;bool
 DATARMNETb165d2c5c4;};struct DATARMNET70f3b87b5d{struct rmnet_port*
 DATARMNET403589239f;struct DATARMNET74bb35b8f2 DATARMNETa9f2b2f677;struct 
 qmi_rmnet_ps_ind DATARMNET341393eda2;struct DATARMNET907d58c807 
-DATARMNETebb45c8d86;u8 DATARMNETcb2b3ae8e4;};struct DATARMNET70f3b87b5d*
+DATARMNETebb45c8d86;struct hrtimer DATARMNET71d5ece65b;struct tasklet_struct 
+DATARMNET8b0d3e61fa;bool DATARMNETa6c2f8e1d4;u8 DATARMNETcb2b3ae8e4;};
+struct DATARMNET70f3b87b5d*
 DATARMNETc2a630b113(void);
 #endif
 
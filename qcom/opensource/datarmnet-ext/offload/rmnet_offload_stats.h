@@ -20,7 +20,10 @@ DATARMNETddf572458d,DATARMNET47a963957c,DATARMNETb322de38be,DATARMNET38317c7efd,
 DATARMNET31c0e41f5a,DATARMNET0cd1fa0d98,DATARMNET1c0d243816,DATARMNETc34a778ea2,
 DATARMNETbc56977b7e,DATARMNETc9b8ef90d1,DATARMNET92f3434694,DATARMNETa76d93355c,
 DATARMNET3067ea3199,DATARMNETf335e26298,DATARMNET8e1480cff2,DATARMNET787b04223a,
-DATARMNETa121404606,DATARMNETd04f96aa13,};void DATARMNETbad3b5165e(u32 
+DATARMNETa121404606,DATARMNETffeef4aa51,DATARMNETd98d415fb5,DATARMNETdfdeffceab,
+DATARMNET1f1b9609b1,DATARMNET3d2f808692,DATARMNET970526891e,DATARMNETc4e6fafd7b,
+DATARMNET3d0f297124,DATARMNETdf5d0c39ac,DATARMNETec3c348714,DATARMNETceb1110673,
+DATARMNET2b6e0d4c91,DATARMNETd04f96aa13,};void DATARMNETbad3b5165e(u32 
 DATARMNET248f120dd5,u64 DATARMNETb639f6e1b1);void DATARMNETa00cda79d0(u32 
 DATARMNET248f120dd5);
 #endif
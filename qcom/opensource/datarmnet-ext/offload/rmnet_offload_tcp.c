@@ -55,7 +55,10 @@ DATARMNETaa568481cf,struct DATARMNETd812bcdbb5*DATARMNET5fe4c722a8){u64
 DATARMNET7457d496cb;u32 DATARMNET95acece3fc;if(DATARMNET2818ea93ec(
 DATARMNET5fe4c722a8)){DATARMNETa00cda79d0(DATARMNETb322de38be);return 
 DATARMNET7af645849a;}if(!DATARMNETaa568481cf->DATARMNET1db11fa85e)return 
-DATARMNET0413b43080;if(DATARMNET829fcf5939(DATARMNETaa568481cf,
+DATARMNET0413b43080;if(DATARMNETaa568481cf->DATARMNET1db11fa85e>=
+DATARMNETf1d1b8287f(DATARMNET60793d2cab)){DATARMNETa00cda79d0(
+DATARMNET3d0f297124);return DATARMNETb0bd5db24d;}if(DATARMNET829fcf5939(
+DATARMNETaa568481cf,
 DATARMNET5fe4c722a8)){DATARMNETa00cda79d0(DATARMNET38317c7efd);return 
 DATARMNETb0bd5db24d;}if(DATARMNET5fe4c722a8->DATARMNET144d119066.
 DATARMNETbc28a5970f^DATARMNETaa568481cf->DATARMNET78fd20ce0e.DATARMNETbc28a5970f
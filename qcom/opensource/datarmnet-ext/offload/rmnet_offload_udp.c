@@ -18,7 +18,10 @@
 static int DATARMNETdf8e0dc3a0(struct DATARMNETd7c9631acd*DATARMNETaa568481cf,
 struct DATARMNETd812bcdbb5*DATARMNET5fe4c722a8){u64 DATARMNET71c7d18d88;u16 
 DATARMNET95acece3fc;if(!DATARMNETaa568481cf->DATARMNET1db11fa85e)return 
-DATARMNET0413b43080;DATARMNET95acece3fc=(DATARMNET5fe4c722a8->
+DATARMNET0413b43080;if(DATARMNETaa568481cf->DATARMNET1db11fa85e>=
+DATARMNETf1d1b8287f(DATARMNETef1c8818c4)){DATARMNETa00cda79d0(
+DATARMNETdf5d0c39ac);return DATARMNETb0bd5db24d;}DATARMNET95acece3fc=(
+DATARMNET5fe4c722a8->
 DATARMNET719f68fb88->gso_size)?:DATARMNET5fe4c722a8->DATARMNET1ef22e4c76;if(
 DATARMNET95acece3fc!=DATARMNETaa568481cf->DATARMNET1978d5d8de){
 DATARMNETa00cda79d0(DATARMNETbc56977b7e);return DATARMNETb0bd5db24d;}
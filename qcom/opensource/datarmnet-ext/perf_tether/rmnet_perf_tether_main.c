@@ -8,6 +8,11 @@
 
 #include <linux/module.h>
 #include <net/tcp.h>
+#include <linux/etherdevice.h>
+#include <linux/rculist.h>
+#include <net/arp.h>
+#include <net/ndisc.h>
+#include <net/netfilter/nf_conntrack.h>
 #include "rmnet_descriptor.h"
 #include "rmnet_map.h"
 MODULE_LICENSE("\x47\x50\x4c\x20\x76\x32");static char*verinfo[]={
@@ -19,15 +24,17 @@ verinfo,
 ,struct rmnet_frag_descriptor*DATARMNET9d1b321642,struct iphdr*
 DATARMNET86f1f2cdc9);extern void(*rmnet_perf_tether_egress_hook)(struct sk_buff*
 DATARMNET543491eb0f);extern void(*rmnet_perf_tether_cmd_hook)(u8 
-DATARMNET07b1a05079,u64 DATARMNETcc6099cb14);struct DATARMNETf9eee4068d{u8 
-DATARMNETd0ef85194f;};static struct DATARMNETf9eee4068d*DATARMNET8a1e9920bf;
-unsigned int configure_knob1 __read_mostly=(0xd2d+202-0xdf7);module_param(
-configure_knob1,uint,(0xdb7+6665-0x261c));unsigned int knob1 __read_mostly=
-(0xd2d+202-0xdf7);module_param(knob1,uint,(0xdb7+6665-0x261c));unsigned int 
-configure_knob2 __read_mostly=(0xd2d+202-0xdf7);module_param(configure_knob2,
-uint,(0xdb7+6665-0x261c));unsigned int knob2 __read_mostly=(0xd2d+202-0xdf7);
-module_param(knob2,uint,(0xdb7+6665-0x261c));static DEFINE_SPINLOCK(
-DATARMNETcf56327171);
+DATARMNET07b1a05079,u64 DATARMNETcc6099cb14);extern int(*
+rmnet_perf_tether_fwd_hook)(struct sk_buff*DATARMNET543491eb0f);struct 
+DATARMNETf9eee4068d{u8 DATARMNETd0ef85194f;};static struct DATARMNETf9eee4068d*
+DATARMNET8a1e9920bf;unsigned int configure_knob1 __read_mostly=(0xd2d+202-0xdf7)
+;module_param(configure_knob1,uint,(0xdb7+6665-0x261c));unsigned int knob1 
+__read_mostly=(0xd2d+202-0xdf7);module_param(knob1,uint,(0xdb7+6665-0x261c));
+unsigned int configure_knob2 __read_mostly=(0xd2d+202-0xdf7);module_param(
+configure_knob2,uint,(0xdb7+6665-0x261c));unsigned int knob2 __read_mostly=
+(0xd2d+202-0xdf7);module_param(knob2,uint,(0xdb7+6665-0x261c));unsigned int 
+knob3 __read_mostly=(0xd2d+202-0xdf7);module_param(knob3,uint,
+(0xdb7+6665-0x261c));static DEFINE_SPINLOCK(DATARMNETcf56327171);
 #define DATARMNETd063f2edce ((0xef7+1112-0x131d))
 #define DATARMNET4c845df513 \
 	(const_ilog2(DATARMNETd063f2edce))
@@ -139,23 +146,197 @@ s6_addr,sizeof(struct in6_addr));DATARMNET63b1a086d5->DATARMNETdfd47b00ff[
 (0xd35+210-0xdff)]=ipv6_hdr(DATARMNET543491eb0f)->nexthdr;DATARMNET63b1a086d5->
 DATARMNETdfd47b00ff[9]=tcp_hdr(DATARMNET543491eb0f)->dest;DATARMNET63b1a086d5->
 DATARMNETdfd47b00ff[(0xd27+224-0xdfd)]=tcp_hdr(DATARMNET543491eb0f)->source;
-DATARMNET63b1a086d5->DATARMNET4b119c4ff3=(0xd20+231-0xdfc);}}void 
+DATARMNET63b1a086d5->DATARMNET4b119c4ff3=(0xd20+231-0xdfc);}}struct 
+DATARMNET623162afe4{__be32 DATARMNETa95a39551b[(0xd11+230-0xdf3)];__be32 
+DATARMNETc40f3a066a[(0xd11+230-0xdf3)];__be16 DATARMNET7c1ad7d159;__be16 
+DATARMNETbc682ecb05;u8 DATARMNET6c8d1f71c9;u8 DATARMNETc55d367bb5;u16 
+DATARMNETd8075beddf;};struct DATARMNETb8e9bbf420{struct hlist_node 
+DATARMNETa65782e647;struct rcu_head DATARMNET9a0601ce3b;struct 
+DATARMNET623162afe4 DATARMNETf00ec0a044;__be32 DATARMNETc40f3a066a[
+(0xd11+230-0xdf3)];__be16 DATARMNETbc682ecb05;u8 DATARMNETf2bbe3d8bf[ETH_ALEN];
+u8 DATARMNET5711d3989a[ETH_ALEN];int DATARMNET55e7a71e10;struct nf_conn*
+DATARMNET221d6879be;unsigned long DATARMNET8bc42f0992;u32 DATARMNET2fcfaa490a;};
+static DEFINE_SPINLOCK(DATARMNETfcdfa1e54f);static DEFINE_HASHTABLE(
+DATARMNETec8d4c45b2,(0xd35+210-0xdff));static u32 DATARMNETd2ca75215f;static 
+void DATARMNETfa9dac00a6(struct rcu_head*DATARMNET9a0601ce3b){struct 
+DATARMNETb8e9bbf420*DATARMNETac7b340dcf=container_of(DATARMNET9a0601ce3b,struct 
+DATARMNETb8e9bbf420,DATARMNET9a0601ce3b);nf_ct_put(DATARMNETac7b340dcf->
+DATARMNET221d6879be);kfree(DATARMNETac7b340dcf);}static void DATARMNET005c2a19ca
+(struct DATARMNETb8e9bbf420*DATARMNETac7b340dcf){if(hlist_unhashed(&
+DATARMNETac7b340dcf->DATARMNETa65782e647))return;hash_del_rcu(&
+DATARMNETac7b340dcf->DATARMNETa65782e647);DATARMNETd2ca75215f--;call_rcu(&
+DATARMNETac7b340dcf->DATARMNET9a0601ce3b,DATARMNETfa9dac00a6);}static void 
+DATARMNET68046739c1(struct DATARMNETb8e9bbf420*DATARMNETac7b340dcf){unsigned 
+long DATARMNETfb0677cc3c;spin_lock_irqsave(&DATARMNETfcdfa1e54f,
+DATARMNETfb0677cc3c);DATARMNET005c2a19ca(DATARMNETac7b340dcf);
+spin_unlock_irqrestore(&DATARMNETfcdfa1e54f,DATARMNETfb0677cc3c);}static bool 
+DATARMNET16e35bc5f6(struct DATARMNETb8e9bbf420*DATARMNETac7b340dcf){return 
+time_after(jiffies,READ_ONCE(DATARMNETac7b340dcf->DATARMNET8bc42f0992)+
+(0xdf7+4336-0x1ec9)*HZ)||nf_ct_is_dying(DATARMNETac7b340dcf->DATARMNET221d6879be
+);}static struct DATARMNETb8e9bbf420*DATARMNETaf7719520a(struct 
+DATARMNET623162afe4*DATARMNETf00ec0a044,u32 hash){struct DATARMNETb8e9bbf420*
+DATARMNETac7b340dcf;hash_for_each_possible_rcu(DATARMNETec8d4c45b2,
+DATARMNETac7b340dcf,DATARMNETa65782e647,hash){if(DATARMNETac7b340dcf->
+DATARMNET2fcfaa490a==hash&&!memcmp(&DATARMNETac7b340dcf->DATARMNETf00ec0a044,
+DATARMNETf00ec0a044,sizeof(*DATARMNETf00ec0a044)))return DATARMNETac7b340dcf;}
+return NULL;}static void DATARMNET4f7d94574e(bool DATARMNETffddc0c1f4){struct 
+DATARMNETb8e9bbf420*DATARMNETac7b340dcf;struct hlist_node*DATARMNET0386f6f82a;
+int DATARMNETae0201901a;hash_for_each_safe(DATARMNETec8d4c45b2,
+DATARMNETae0201901a,DATARMNET0386f6f82a,DATARMNETac7b340dcf,DATARMNETa65782e647)
+{if(DATARMNETffddc0c1f4||DATARMNET16e35bc5f6(DATARMNETac7b340dcf))
+DATARMNET005c2a19ca(DATARMNETac7b340dcf);}}static void DATARMNET180df2ffd2(
+struct sk_buff*DATARMNET543491eb0f){const struct nf_conntrack_tuple*
+DATARMNETd084d27834;const struct nf_conntrack_tuple*DATARMNET149594ba65;enum 
+ip_conntrack_info DATARMNET13c1a204fd;struct DATARMNETb8e9bbf420*
+DATARMNETac7b340dcf;struct DATARMNET623162afe4 DATARMNETf00ec0a044;struct 
+neighbour*DATARMNET07c8c11f6e;struct net_device*dev;unsigned long 
+DATARMNETfb0677cc3c;struct nf_conn*DATARMNET221d6879be;u32 hash;if(!
+DATARMNET543491eb0f->skb_iif)return;DATARMNET221d6879be=nf_ct_get(
+DATARMNET543491eb0f,&DATARMNET13c1a204fd);if(!DATARMNET221d6879be||
+DATARMNET13c1a204fd!=IP_CT_ESTABLISHED)return;if(nf_ct_protonum(
+DATARMNET221d6879be)!=IPPROTO_TCP&&nf_ct_protonum(DATARMNET221d6879be)!=
+IPPROTO_UDP)return;DATARMNETd084d27834=&DATARMNET221d6879be->tuplehash[
+IP_CT_DIR_ORIGINAL].tuple;DATARMNET149594ba65=&DATARMNET221d6879be->tuplehash[
+IP_CT_DIR_REPLY].tuple;memset(&DATARMNETf00ec0a044,(0xd2d+202-0xdf7),sizeof(
+DATARMNETf00ec0a044));memcpy(DATARMNETf00ec0a044.DATARMNETa95a39551b,&
+DATARMNET149594ba65->src.u3,sizeof(DATARMNETf00ec0a044.DATARMNETa95a39551b));
+memcpy(DATARMNETf00ec0a044.DATARMNETc40f3a066a,&DATARMNET149594ba65->dst.u3,
+sizeof(DATARMNETf00ec0a044.DATARMNETc40f3a066a));DATARMNETf00ec0a044.
+DATARMNET7c1ad7d159=DATARMNET149594ba65->src.u.all;DATARMNETf00ec0a044.
+DATARMNETbc682ecb05=DATARMNET149594ba65->dst.u.all;DATARMNETf00ec0a044.
+DATARMNET6c8d1f71c9=DATARMNET149594ba65->dst.protonum;DATARMNETf00ec0a044.
+DATARMNETc55d367bb5=DATARMNET149594ba65->src.l3num;hash=jhash2((u32*)&
+DATARMNETf00ec0a044,sizeof(DATARMNETf00ec0a044)/sizeof(u32),(0xd2d+202-0xdf7));
+DATARMNETac7b340dcf=DATARMNETaf7719520a(&DATARMNETf00ec0a044,hash);if(
+nf_ct_protonum(DATARMNET221d6879be)==IPPROTO_TCP&&(tcp_hdr(DATARMNET543491eb0f)
+->fin||tcp_hdr(DATARMNET543491eb0f)->rst)){if(DATARMNETac7b340dcf)
+DATARMNET68046739c1(DATARMNETac7b340dcf);return;}if(DATARMNETac7b340dcf){if(
+DATARMNETac7b340dcf->DATARMNET221d6879be==DATARMNET221d6879be&&!nf_ct_is_dying(
+DATARMNET221d6879be)){WRITE_ONCE(DATARMNETac7b340dcf->DATARMNET8bc42f0992,
+jiffies);return;}DATARMNET68046739c1(DATARMNETac7b340dcf);}dev=
+dev_get_by_index_rcu(&init_net,DATARMNET543491eb0f->skb_iif);if(!dev||dev->type
+!=ARPHRD_ETHER||dev->addr_len!=ETH_ALEN)return;if(DATARMNETf00ec0a044.
+DATARMNETc55d367bb5==NFPROTO_IPV4)DATARMNET07c8c11f6e=__ipv4_neigh_lookup_noref(
+dev,(__force u32)DATARMNETd084d27834->src.u3.ip);else DATARMNET07c8c11f6e=
+__ipv6_neigh_lookup_noref(dev,&DATARMNETd084d27834->src.u3.in6);if(!
+DATARMNET07c8c11f6e||!(READ_ONCE(DATARMNET07c8c11f6e->nud_state)&NUD_VALID))
+return;DATARMNETac7b340dcf=kzalloc(sizeof(*DATARMNETac7b340dcf),GFP_ATOMIC);if(!
+DATARMNETac7b340dcf)return;memcpy(&DATARMNETac7b340dcf->DATARMNETf00ec0a044,&
+DATARMNETf00ec0a044,sizeof(DATARMNETf00ec0a044));memcpy(DATARMNETac7b340dcf->
+DATARMNETc40f3a066a,&DATARMNETd084d27834->src.u3,sizeof(DATARMNETac7b340dcf->
+DATARMNETc40f3a066a));DATARMNETac7b340dcf->DATARMNETbc682ecb05=
+DATARMNETd084d27834->src.u.all;neigh_ha_snapshot(DATARMNETac7b340dcf->
+DATARMNETf2bbe3d8bf,DATARMNET07c8c11f6e,dev);ether_addr_copy(DATARMNETac7b340dcf
+->DATARMNET5711d3989a,dev->dev_addr);DATARMNETac7b340dcf->DATARMNET55e7a71e10=
+dev->ifindex;DATARMNETac7b340dcf->DATARMNET8bc42f0992=jiffies;
+DATARMNETac7b340dcf->DATARMNET2fcfaa490a=hash;if(nf_ct_protonum(
+DATARMNET221d6879be)==IPPROTO_TCP){spin_lock_bh(&DATARMNET221d6879be->lock);
+DATARMNET221d6879be->proto.tcp.seen[(0xd2d+202-0xdf7)].flags|=
+IP_CT_TCP_FLAG_BE_LIBERAL;DATARMNET221d6879be->proto.tcp.seen[(0xd26+209-0xdf6)]
+.flags|=IP_CT_TCP_FLAG_BE_LIBERAL;spin_unlock_bh(&DATARMNET221d6879be->lock);}
+nf_conntrack_get(&DATARMNET221d6879be->ct_general);DATARMNETac7b340dcf->
+DATARMNET221d6879be=DATARMNET221d6879be;spin_lock_irqsave(&DATARMNETfcdfa1e54f,
+DATARMNETfb0677cc3c);if(DATARMNETd2ca75215f>=(0xc37+794-0xd51))
+DATARMNET4f7d94574e(false);if(DATARMNETd2ca75215f>=(0xc37+794-0xd51)||
+DATARMNETaf7719520a(&DATARMNETf00ec0a044,hash)){spin_unlock_irqrestore(&
+DATARMNETfcdfa1e54f,DATARMNETfb0677cc3c);nf_ct_put(DATARMNET221d6879be);kfree(
+DATARMNETac7b340dcf);return;}hash_add_rcu(DATARMNETec8d4c45b2,&
+DATARMNETac7b340dcf->DATARMNETa65782e647,hash);DATARMNETd2ca75215f++;
+spin_unlock_irqrestore(&DATARMNETfcdfa1e54f,DATARMNETfb0677cc3c);}int 
+DATARMNET4230dfeb72(struct sk_buff*DATARMNET543491eb0f){struct 
+DATARMNETb8e9bbf420*DATARMNETac7b340dcf;struct DATARMNET623162afe4 
+DATARMNETf00ec0a044;struct net_device*dev;struct ethhdr*DATARMNETf0bec38360;
+__sum16*DATARMNET269ce0262c=NULL;__be16*DATARMNETee44e9a726;unsigned int 
+DATARMNETdd2bc347ad;u8 DATARMNET6c8d1f71c9;if(!knob3||!READ_ONCE(
+DATARMNETd2ca75215f))return(0xd2d+202-0xdf7);memset(&DATARMNETf00ec0a044,
+(0xd2d+202-0xdf7),sizeof(DATARMNETf00ec0a044));if(DATARMNET543491eb0f->protocol
+==htons(ETH_P_IP)){struct iphdr*DATARMNETd77fe789ee;if(!pskb_may_pull(
+DATARMNET543491eb0f,sizeof(*DATARMNETd77fe789ee)))return(0xd2d+202-0xdf7);
+DATARMNETd77fe789ee=ip_hdr(DATARMNET543491eb0f);if(DATARMNETd77fe789ee->ihl!=
+(0xd0a+237-0xdf2)||ip_is_fragment(DATARMNETd77fe789ee)||DATARMNETd77fe789ee->ttl
+<=(0xd26+209-0xdf6))return(0xd2d+202-0xdf7);DATARMNETdd2bc347ad=sizeof(*
+DATARMNETd77fe789ee);DATARMNET6c8d1f71c9=DATARMNETd77fe789ee->protocol;
+DATARMNETf00ec0a044.DATARMNETa95a39551b[(0xd2d+202-0xdf7)]=DATARMNETd77fe789ee->
+saddr;DATARMNETf00ec0a044.DATARMNETc40f3a066a[(0xd2d+202-0xdf7)]=
+DATARMNETd77fe789ee->daddr;DATARMNETf00ec0a044.DATARMNETc55d367bb5=NFPROTO_IPV4;
+}else if(DATARMNET543491eb0f->protocol==htons(ETH_P_IPV6)){struct ipv6hdr*
+DATARMNET466187aabf;if(!pskb_may_pull(DATARMNET543491eb0f,sizeof(*
+DATARMNET466187aabf)))return(0xd2d+202-0xdf7);DATARMNET466187aabf=ipv6_hdr(
+DATARMNET543491eb0f);if(DATARMNET466187aabf->hop_limit<=(0xd26+209-0xdf6))return
+(0xd2d+202-0xdf7);DATARMNETdd2bc347ad=sizeof(*DATARMNET466187aabf);
+DATARMNET6c8d1f71c9=DATARMNET466187aabf->nexthdr;memcpy(DATARMNETf00ec0a044.
+DATARMNETa95a39551b,&DATARMNET466187aabf->saddr,sizeof(DATARMNETf00ec0a044.
+DATARMNETa95a39551b));memcpy(DATARMNETf00ec0a044.DATARMNETc40f3a066a,&
+DATARMNET466187aabf->daddr,sizeof(DATARMNETf00ec0a044.DATARMNETc40f3a066a));
+DATARMNETf00ec0a044.DATARMNETc55d367bb5=NFPROTO_IPV6;}else{return
+(0xd2d+202-0xdf7);}if(DATARMNET6c8d1f71c9==IPPROTO_TCP){if(!pskb_may_pull(
+DATARMNET543491eb0f,DATARMNETdd2bc347ad+sizeof(struct tcphdr)))return
+(0xd2d+202-0xdf7);}else if(DATARMNET6c8d1f71c9==IPPROTO_UDP){if(!pskb_may_pull(
+DATARMNET543491eb0f,DATARMNETdd2bc347ad+sizeof(struct udphdr)))return
+(0xd2d+202-0xdf7);}else{return(0xd2d+202-0xdf7);}DATARMNETee44e9a726=(__be16*)(
+DATARMNET543491eb0f->data+DATARMNETdd2bc347ad);DATARMNETf00ec0a044.
+DATARMNET7c1ad7d159=DATARMNETee44e9a726[(0xd2d+202-0xdf7)];DATARMNETf00ec0a044.
+DATARMNETbc682ecb05=DATARMNETee44e9a726[(0xd26+209-0xdf6)];DATARMNETf00ec0a044.
+DATARMNET6c8d1f71c9=DATARMNET6c8d1f71c9;DATARMNETac7b340dcf=DATARMNETaf7719520a(
+&DATARMNETf00ec0a044,jhash2((u32*)&DATARMNETf00ec0a044,sizeof(
+DATARMNETf00ec0a044)/sizeof(u32),(0xd2d+202-0xdf7)));if(!DATARMNETac7b340dcf)
+return(0xd2d+202-0xdf7);if(DATARMNET16e35bc5f6(DATARMNETac7b340dcf)||(
+DATARMNET6c8d1f71c9==IPPROTO_TCP&&(((struct tcphdr*)DATARMNETee44e9a726)->fin||(
+(struct tcphdr*)DATARMNETee44e9a726)->rst))){DATARMNET68046739c1(
+DATARMNETac7b340dcf);return(0xd2d+202-0xdf7);}dev=dev_get_by_index_rcu(&init_net
+,DATARMNETac7b340dcf->DATARMNET55e7a71e10);if(!dev||!netif_running(dev))return
+(0xd2d+202-0xdf7);if(!skb_is_gso(DATARMNET543491eb0f)&&DATARMNET543491eb0f->len>
+dev->mtu)return(0xd2d+202-0xdf7);if(skb_cow_head(DATARMNET543491eb0f,ETH_HLEN))
+return(0xd2d+202-0xdf7);DATARMNETee44e9a726=(__be16*)(DATARMNET543491eb0f->data+
+DATARMNETdd2bc347ad);if(DATARMNET6c8d1f71c9==IPPROTO_TCP){DATARMNET269ce0262c=&(
+(struct tcphdr*)DATARMNETee44e9a726)->check;}else if(((struct udphdr*)
+DATARMNETee44e9a726)->check||DATARMNET543491eb0f->ip_summed==CHECKSUM_PARTIAL){
+DATARMNET269ce0262c=&((struct udphdr*)DATARMNETee44e9a726)->check;}if(
+DATARMNETf00ec0a044.DATARMNETc55d367bb5==NFPROTO_IPV4){struct iphdr*
+DATARMNETd77fe789ee=ip_hdr(DATARMNET543491eb0f);if(DATARMNETd77fe789ee->daddr!=
+DATARMNETac7b340dcf->DATARMNETc40f3a066a[(0xd2d+202-0xdf7)]){csum_replace4(&
+DATARMNETd77fe789ee->check,DATARMNETd77fe789ee->daddr,DATARMNETac7b340dcf->
+DATARMNETc40f3a066a[(0xd2d+202-0xdf7)]);if(DATARMNET269ce0262c)
+inet_proto_csum_replace4(DATARMNET269ce0262c,DATARMNET543491eb0f,
+DATARMNETd77fe789ee->daddr,DATARMNETac7b340dcf->DATARMNETc40f3a066a[
+(0xd2d+202-0xdf7)],true);DATARMNETd77fe789ee->daddr=DATARMNETac7b340dcf->
+DATARMNETc40f3a066a[(0xd2d+202-0xdf7)];}ip_decrease_ttl(DATARMNETd77fe789ee);}
+else{struct ipv6hdr*DATARMNET466187aabf=ipv6_hdr(DATARMNET543491eb0f);if(memcmp(
+&DATARMNET466187aabf->daddr,DATARMNETac7b340dcf->DATARMNETc40f3a066a,sizeof(
+DATARMNET466187aabf->daddr))){if(DATARMNET269ce0262c)inet_proto_csum_replace16(
+DATARMNET269ce0262c,DATARMNET543491eb0f,DATARMNET466187aabf->daddr.s6_addr32,
+DATARMNETac7b340dcf->DATARMNETc40f3a066a,true);memcpy(&DATARMNET466187aabf->
+daddr,DATARMNETac7b340dcf->DATARMNETc40f3a066a,sizeof(DATARMNET466187aabf->daddr
+));}DATARMNET466187aabf->hop_limit--;}if(DATARMNETee44e9a726[(0xd26+209-0xdf6)]
+!=DATARMNETac7b340dcf->DATARMNETbc682ecb05){if(DATARMNET269ce0262c)
+inet_proto_csum_replace2(DATARMNET269ce0262c,DATARMNET543491eb0f,
+DATARMNETee44e9a726[(0xd26+209-0xdf6)],DATARMNETac7b340dcf->DATARMNETbc682ecb05,
+false);DATARMNETee44e9a726[(0xd26+209-0xdf6)]=DATARMNETac7b340dcf->
+DATARMNETbc682ecb05;}if(DATARMNET6c8d1f71c9==IPPROTO_UDP&&DATARMNET269ce0262c&&!
+*DATARMNET269ce0262c)*DATARMNET269ce0262c=CSUM_MANGLED_0;DATARMNETf0bec38360=
+skb_push(DATARMNET543491eb0f,ETH_HLEN);ether_addr_copy(DATARMNETf0bec38360->
+h_dest,DATARMNETac7b340dcf->DATARMNETf2bbe3d8bf);ether_addr_copy(
+DATARMNETf0bec38360->h_source,DATARMNETac7b340dcf->DATARMNET5711d3989a);
+DATARMNETf0bec38360->h_proto=DATARMNET543491eb0f->protocol;skb_reset_mac_header(
+DATARMNET543491eb0f);skb_reset_mac_len(DATARMNET543491eb0f);DATARMNET543491eb0f
+->dev=dev;dev_queue_xmit(DATARMNET543491eb0f);return(0xd26+209-0xdf6);}void 
 DATARMNET6ab362e985(struct sk_buff*DATARMNET543491eb0f){int DATARMNET76bafbc6ce=
 (0xd2d+202-0xdf7);u32 hash;unsigned long DATARMNETfb0677cc3c;struct 
 DATARMNETb477d446e7*DATARMNET63b1a086d5;struct hlist_node*DATARMNET0386f6f82a;
-int DATARMNETae0201901a;struct net_device*dev;if(!configure_knob1&&!
-configure_knob2)return;if(!DATARMNET543491eb0f->skb_iif)return;dev=
-__dev_get_by_index(&init_net,DATARMNET543491eb0f->skb_iif);if(!dev)return;hash=
-DATARMNET233bccd449(DATARMNET543491eb0f,&DATARMNET76bafbc6ce,(0xd2d+202-0xdf7),
-(0xd26+209-0xdf6));if(!DATARMNET76bafbc6ce)return;spin_lock_irqsave(&
-DATARMNETcf56327171,DATARMNETfb0677cc3c);DATARMNET63b1a086d5=
-list_first_entry_or_null(&DATARMNETc588a190d4,struct DATARMNETb477d446e7,list);
-if(DATARMNET63b1a086d5){list_del(&DATARMNET63b1a086d5->list);DATARMNET63b1a086d5
-->hash=hash;DATARMNET9eb31df630(DATARMNET63b1a086d5,DATARMNET543491eb0f);
-hash_add(DATARMNET031f18e039,&DATARMNET63b1a086d5->hlist,DATARMNET63b1a086d5->
-hash);}else{hash_for_each_safe(DATARMNET031f18e039,DATARMNETae0201901a,
-DATARMNET0386f6f82a,DATARMNET63b1a086d5,hlist){hash_del(&DATARMNET63b1a086d5->
-hlist);DATARMNET63b1a086d5->hash=hash;DATARMNET9eb31df630(DATARMNET63b1a086d5,
+int DATARMNETae0201901a;struct net_device*dev;if(knob3)DATARMNET180df2ffd2(
+DATARMNET543491eb0f);if(!configure_knob1&&!configure_knob2)return;if(!
+DATARMNET543491eb0f->skb_iif)return;dev=__dev_get_by_index(&init_net,
+DATARMNET543491eb0f->skb_iif);if(!dev)return;hash=DATARMNET233bccd449(
+DATARMNET543491eb0f,&DATARMNET76bafbc6ce,(0xd2d+202-0xdf7),(0xd26+209-0xdf6));if
+(!DATARMNET76bafbc6ce)return;spin_lock_irqsave(&DATARMNETcf56327171,
+DATARMNETfb0677cc3c);DATARMNET63b1a086d5=list_first_entry_or_null(&
+DATARMNETc588a190d4,struct DATARMNETb477d446e7,list);if(DATARMNET63b1a086d5){
+list_del(&DATARMNET63b1a086d5->list);DATARMNET63b1a086d5->hash=hash;
+DATARMNET9eb31df630(DATARMNET63b1a086d5,DATARMNET543491eb0f);hash_add(
+DATARMNET031f18e039,&DATARMNET63b1a086d5->hlist,DATARMNET63b1a086d5->hash);}else
+{hash_for_each_safe(DATARMNET031f18e039,DATARMNETae0201901a,DATARMNET0386f6f82a,
+DATARMNET63b1a086d5,hlist){hash_del(&DATARMNET63b1a086d5->hlist);
+DATARMNET63b1a086d5->hash=hash;DATARMNET9eb31df630(DATARMNET63b1a086d5,
 DATARMNET543491eb0f);hash_add(DATARMNET031f18e039,&DATARMNET63b1a086d5->hlist,
 DATARMNET63b1a086d5->hash);break;}}spin_unlock_irqrestore(&DATARMNETcf56327171,
 DATARMNETfb0677cc3c);}void DATARMNET136e008d70(u8 DATARMNET07b1a05079,u64 
@@ -180,12 +361,14 @@ DATARMNETba8c503d04=DATARMNET7bd625a8c0;DATARMNETcd32395e82->DATARMNETc59f891d69
 dev_put(dev);}void DATARMNET5fe3ffe2ab(void){rcu_assign_pointer(
 rmnet_perf_tether_ingress_hook,DATARMNETe70d5ec61a);rcu_assign_pointer(
 rmnet_perf_tether_egress_hook,DATARMNET6ab362e985);rcu_assign_pointer(
-rmnet_perf_tether_cmd_hook,DATARMNET136e008d70);}void DATARMNET229327cbd2(void){
+rmnet_perf_tether_cmd_hook,DATARMNET136e008d70);rcu_assign_pointer(
+rmnet_perf_tether_fwd_hook,DATARMNET4230dfeb72);}void DATARMNET229327cbd2(void){
 rcu_assign_pointer(rmnet_perf_tether_ingress_hook,NULL);rcu_assign_pointer(
 rmnet_perf_tether_egress_hook,NULL);rcu_assign_pointer(
-rmnet_perf_tether_cmd_hook,NULL);}static int DATARMNETaa549ce89a(void){int 
-DATARMNETefc9df3df2;DATARMNET8a1e9920bf=kzalloc(sizeof(*DATARMNET8a1e9920bf),
-GFP_KERNEL);if(!DATARMNET8a1e9920bf){pr_err(
+rmnet_perf_tether_cmd_hook,NULL);rcu_assign_pointer(rmnet_perf_tether_fwd_hook,
+NULL);}static int DATARMNETaa549ce89a(void){int DATARMNETefc9df3df2;
+DATARMNET8a1e9920bf=kzalloc(sizeof(*DATARMNET8a1e9920bf),GFP_KERNEL);if(!
+DATARMNET8a1e9920bf){pr_err(
 "\x25\x73\x28\x29\x3a\x20\x52\x65\x73\x6f\x75\x72\x63\x65\x20\x61\x6c\x6c\x6f\x63\x61\x74\x69\x6f\x6e\x20\x66\x61\x69\x6c\x65\x64" "\n"
 ,__func__);return-(0xd26+209-0xdf6);}DATARMNET8a1e9920bf->DATARMNETd0ef85194f++;
 for(DATARMNETefc9df3df2=(0xd2d+202-0xdf7);DATARMNETefc9df3df2<
@@ -203,12 +386,15 @@ DATARMNET66219231cc(void){struct DATARMNETb477d446e7*DATARMNET63b1a086d5,*
 DATARMNET2133db01db;list_for_each_entry_safe(DATARMNET63b1a086d5,
 DATARMNET2133db01db,&DATARMNETc588a190d4,list){list_del(&DATARMNET63b1a086d5->
 list);kfree(DATARMNET63b1a086d5);}}static void DATARMNET3ece352201(void){
-DATARMNET229327cbd2();DATARMNET66219231cc();DATARMNET2b8220b2f3();kfree(
-DATARMNET8a1e9920bf);DATARMNET8a1e9920bf=NULL;}static int DATARMNET6e31e62d2e(
-struct notifier_block*DATARMNET272c159b3c,unsigned long DATARMNET4abd997295,void
-*DATARMNET3f254bae11){struct net_device*DATARMNET00dcb79bc4=
-netdev_notifier_info_to_dev(DATARMNET3f254bae11);int DATARMNETb14e52a504;(void)
-DATARMNET272c159b3c;if(!DATARMNET00dcb79bc4||strncmp(DATARMNET00dcb79bc4->name,
+unsigned long DATARMNETfb0677cc3c;DATARMNET229327cbd2();DATARMNET66219231cc();
+DATARMNET2b8220b2f3();spin_lock_irqsave(&DATARMNETfcdfa1e54f,DATARMNETfb0677cc3c
+);DATARMNET4f7d94574e(true);spin_unlock_irqrestore(&DATARMNETfcdfa1e54f,
+DATARMNETfb0677cc3c);kfree(DATARMNET8a1e9920bf);DATARMNET8a1e9920bf=NULL;}static
+ int DATARMNET6e31e62d2e(struct notifier_block*DATARMNET272c159b3c,unsigned long
+ DATARMNET4abd997295,void*DATARMNET3f254bae11){struct net_device*
+DATARMNET00dcb79bc4=netdev_notifier_info_to_dev(DATARMNET3f254bae11);int 
+DATARMNETb14e52a504;(void)DATARMNET272c159b3c;if(!DATARMNET00dcb79bc4||strncmp(
+DATARMNET00dcb79bc4->name,
 "\x72\x6d\x6e\x65\x74\x5f\x64\x61\x74\x61",(0xd27+224-0xdfd)))goto 
 DATARMNETaabe3a05f8;switch(DATARMNET4abd997295){case NETDEV_REGISTER:if(
 DATARMNET8a1e9920bf){DATARMNET8a1e9920bf->DATARMNETd0ef85194f++;goto 
@@ -229,5 +415,5 @@ DATARMNETd9d8382fca={.notifier_call=DATARMNET6e31e62d2e,.priority=
 register_netdevice_notifier(&DATARMNETd9d8382fca);}static void __exit 
 DATARMNET50e3d76d94(void){pr_info(
 "\x25\x73\x28\x29\x3a\x20\x65\x78\x69\x74\x69\x6e\x67" "\n",__func__);
-unregister_netdevice_notifier(&DATARMNETd9d8382fca);}module_init(
+unregister_netdevice_notifier(&DATARMNETd9d8382fca);rcu_barrier();}module_init(
 DATARMNET5e4be08a32);module_exit(DATARMNET50e3d76d94);
@@ -17,6 +17,7 @@
 #include <linux/errno.h>
 #include <linux/skbuff.h>
 #include <linux/rtnetlink.h>
+#include <linux/skb_array.h>
 #include <net/pkt_sched.h>
 static char*verinfo[]={"\x37\x34\x31\x35\x39\x32\x31\x63",
 "\x61\x65\x32\x34\x34\x61\x39\x64"};module_param_array(verinfo,charp,NULL,
@@ -24,84 +25,118 @@ static char*verinfo[]={"\x37\x34\x31\x35\x39\x32\x31\x63",
 "\x56\x65\x72\x73\x69\x6f\x6e\x20\x6f\x66\x20\x74\x68\x65\x20\x64\x72\x69\x76\x65\x72"
 );static const char*DATARMNETf1bb41174a="\x31\x2e\x30";
 #define DATARMNETe632b2e0b0 (0xd11+230-0xdf3)
+#define DATARMNETc954ec6b5a (0xd26+209-0xdf6)
 static const u8 DATARMNET93bdeed8cb[TC_PRIO_MAX+(0xd26+209-0xdf6)]={
 (0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),
-(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd2d+202-0xdf7),(0xd26+209-0xdf6),
+(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd2d+202-0xdf7),(0xd2d+202-0xdf7),
 (0xd1f+216-0xdf5),(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),
 (0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4),(0xd18+223-0xdf4)};static 
-const int DATARMNET91bbdde74c[DATARMNETe632b2e0b0]={(0xbf7+4421-0x1c3c)*
-(0xdf7+2629-0x143c),(0xef7+694-0x112d)*(0xdf7+2629-0x143c),(0xef7+1142-0x132d)*
-(0xdf7+2629-0x143c),(0xeb7+1174-0x132d)*(0xdf7+2629-0x143c)};static const int 
-DATARMNET9dd1382d86[DATARMNETe632b2e0b0]={(0xd35+210-0xdff),(0xd03+244-0xdf1),
-(0xd11+230-0xdf3),(0xd1f+216-0xdf5)};struct DATARMNET74e95d25df{struct 
-qdisc_skb_head DATARMNETb4180393e4[DATARMNETe632b2e0b0];int DATARMNET1de7b3d891[
-DATARMNETe632b2e0b0];int DATARMNETf9afebb887[DATARMNETe632b2e0b0];};static int 
-DATARMNET3a797cc4e9(struct sk_buff*DATARMNET543491eb0f,struct Qdisc*
-DATARMNET9b0193c8c4,struct sk_buff**DATARMNET6af05df5b3){struct 
+const int DATARMNET91bbdde74c[DATARMNETe632b2e0b0]={(0xd2d+202-0xdf7),
+(0xdd7+1850-0x14d1)*(0xdf7+2629-0x143c),(0xeb7+1174-0x132d)*(0xdf7+2629-0x143c),
+(0xeb7+1158-0x132d)*(0xdf7+2629-0x143c)};struct DATARMNET74e95d25df{struct 
+skb_array DATARMNETb4180393e4[DATARMNETe632b2e0b0];int DATARMNET48792d49f4[
+DATARMNETe632b2e0b0];u8 DATARMNET3855e0f6f9;atomic_t DATARMNET2e5cf1a8d7;
+unsigned int DATARMNET8b61f0c3ea;};static int DATARMNET3a797cc4e9(
+struct sk_buff*DATARMNET543491eb0f,struct Qdisc*DATARMNET9b0193c8c4,struct 
+sk_buff**DATARMNET6af05df5b3){struct DATARMNET74e95d25df*DATARMNETe823dcf978=
+qdisc_priv(DATARMNET9b0193c8c4);unsigned int DATARMNET5affe290b8=qdisc_pkt_len(
+DATARMNET543491eb0f);struct skb_array*q;q=&DATARMNETe823dcf978->
+DATARMNETb4180393e4[DATARMNET93bdeed8cb[DATARMNET543491eb0f->priority&
+TC_PRIO_MAX]];if(unlikely((unsigned int)atomic_inc_return(&DATARMNETe823dcf978
+->DATARMNET2e5cf1a8d7)>READ_ONCE(DATARMNETe823dcf978->DATARMNET8b61f0c3ea))||
+unlikely(skb_array_produce(q,DATARMNET543491eb0f))){atomic_dec(&
+DATARMNETe823dcf978->DATARMNET2e5cf1a8d7);return qdisc_drop_cpu(
+DATARMNET543491eb0f,DATARMNET9b0193c8c4,DATARMNET6af05df5b3);}
+qdisc_update_stats_at_enqueue(DATARMNET9b0193c8c4,DATARMNET5affe290b8);return 
+NET_XMIT_SUCCESS;}static struct sk_buff*DATARMNET374aab8ea9(struct 
+DATARMNET74e95d25df*DATARMNETe823dcf978){struct sk_buff*DATARMNET543491eb0f;
+struct skb_array*q;u8 DATARMNET2372d14a3d;u8 DATARMNET141c3f0338=(0xd2d+202-
+0xdf7);for(DATARMNET2372d14a3d=(0xd2d+202-0xdf7);DATARMNET2372d14a3d<
+DATARMNETc954ec6b5a;DATARMNET2372d14a3d++){q=&DATARMNETe823dcf978->
+DATARMNETb4180393e4[DATARMNET2372d14a3d];if(__skb_array_empty(q))continue;return
+ __skb_array_consume(q);}while(DATARMNET141c3f0338<DATARMNETe632b2e0b0-
+DATARMNETc954ec6b5a){DATARMNET2372d14a3d=DATARMNETe823dcf978->
+DATARMNET3855e0f6f9;q=&DATARMNETe823dcf978->DATARMNETb4180393e4[
+DATARMNET2372d14a3d];DATARMNET543491eb0f=__skb_array_peek(q);if(!
+DATARMNET543491eb0f){DATARMNETe823dcf978->DATARMNET48792d49f4[
+DATARMNET2372d14a3d]=(0xd2d+202-0xdf7);DATARMNET141c3f0338++;goto 
+DATARMNET34ccd5cb0d;}DATARMNET141c3f0338=(0xd2d+202-0xdf7);if(
+DATARMNETe823dcf978->DATARMNET48792d49f4[DATARMNET2372d14a3d]>=(int)
+qdisc_pkt_len(DATARMNET543491eb0f)){DATARMNETe823dcf978->DATARMNET48792d49f4[
+DATARMNET2372d14a3d]-=qdisc_pkt_len(DATARMNET543491eb0f);return 
+__skb_array_consume(q);}DATARMNETe823dcf978->DATARMNET48792d49f4[
+DATARMNET2372d14a3d]+=DATARMNET91bbdde74c[DATARMNET2372d14a3d];
+DATARMNET34ccd5cb0d:if(++DATARMNETe823dcf978->DATARMNET3855e0f6f9>=
+DATARMNETe632b2e0b0)DATARMNETe823dcf978->DATARMNET3855e0f6f9=DATARMNETc954ec6b5a
+;}return NULL;}static struct sk_buff*DATARMNET11bbc6360d(struct Qdisc*
+DATARMNET9b0193c8c4){struct DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(
+DATARMNET9b0193c8c4);struct sk_buff*DATARMNET543491eb0f;bool DATARMNET821e1bf3ba
+=true;DATARMNETfd820fc48c:DATARMNET543491eb0f=DATARMNET374aab8ea9(
+DATARMNETe823dcf978);if(likely(DATARMNET543491eb0f)){atomic_dec(&
+DATARMNETe823dcf978->DATARMNET2e5cf1a8d7);qdisc_update_stats_at_dequeue(
+DATARMNET9b0193c8c4,DATARMNET543491eb0f);}else if(
+DATARMNET821e1bf3ba&&READ_ONCE(DATARMNET9b0193c8c4->state)&QDISC_STATE_NON_EMPTY
+){clear_bit(__QDISC_STATE_MISSED,&DATARMNET9b0193c8c4->state);clear_bit(
+__QDISC_STATE_DRAINING,&DATARMNET9b0193c8c4->state);smp_mb__after_atomic();
+DATARMNET821e1bf3ba=false;goto DATARMNETfd820fc48c;}return DATARMNET543491eb0f;}
+static struct sk_buff*DATARMNET5842e6aac7(struct Qdisc*DATARMNET9b0193c8c4){
+struct sk_buff*DATARMNET543491eb0f=skb_peek(&DATARMNET9b0193c8c4->gso_skb);if(!
+DATARMNET543491eb0f){DATARMNET543491eb0f=DATARMNET11bbc6360d(DATARMNET9b0193c8c4
+);if(DATARMNET543491eb0f){__skb_queue_head(&DATARMNET9b0193c8c4->gso_skb,
+DATARMNET543491eb0f);qdisc_update_stats_at_enqueue(DATARMNET9b0193c8c4,
+qdisc_pkt_len(DATARMNET543491eb0f));}}return DATARMNET543491eb0f;}static 
+int DATARMNET757a7de682(struct Qdisc*DATARMNET9b0193c8c4,struct nlattr*
+DATARMNET8bdeb8bf5c,struct netlink_ext_ack*DATARMNET79a1f177ed){struct 
 DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(DATARMNET9b0193c8c4);unsigned
- int DATARMNET5affe290b8=qdisc_pkt_len(DATARMNET543491eb0f);struct 
-qdisc_skb_head*q;if(likely(DATARMNET9b0193c8c4->q.qlen<qdisc_dev(
-DATARMNET9b0193c8c4)->tx_queue_len)){q=&DATARMNETe823dcf978->DATARMNETb4180393e4
-[DATARMNET93bdeed8cb[DATARMNET543491eb0f->priority&TC_PRIO_MAX]];
-__qdisc_enqueue_tail(DATARMNET543491eb0f,q);qdisc_update_stats_at_enqueue(
-DATARMNET9b0193c8c4,DATARMNET5affe290b8);return NET_XMIT_SUCCESS;}return 
-qdisc_drop(DATARMNET543491eb0f,DATARMNET9b0193c8c4,DATARMNET6af05df5b3);}static 
-u8 DATARMNETf9ac3daa83(struct DATARMNET74e95d25df*DATARMNETe823dcf978){int 
-DATARMNET2372d14a3d,DATARMNET70fa801d65=DATARMNETe632b2e0b0;for(
+ int DATARMNETdd3d769504=qdisc_dev(DATARMNET9b0193c8c4)->tx_queue_len;int 
+DATARMNET2372d14a3d;if(!DATARMNETdd3d769504)return-EINVAL;for(
 DATARMNET2372d14a3d=(0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;
-DATARMNET2372d14a3d++){if(!DATARMNETe823dcf978->DATARMNETb4180393e4[
-DATARMNET2372d14a3d].qlen)continue;if(DATARMNETe823dcf978->DATARMNET1de7b3d891[
-DATARMNET2372d14a3d]<=(0xd2d+202-0xdf7)||DATARMNETe823dcf978->
-DATARMNETf9afebb887[DATARMNET2372d14a3d]<=(0xd2d+202-0xdf7)){if(
-DATARMNET2372d14a3d<DATARMNET70fa801d65)DATARMNET70fa801d65=DATARMNET2372d14a3d;
-continue;}return DATARMNET2372d14a3d;}for(DATARMNET2372d14a3d=(0xd2d+202-0xdf7);
-DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++){
-DATARMNETe823dcf978->DATARMNET1de7b3d891[DATARMNET2372d14a3d]=
-DATARMNET9dd1382d86[DATARMNET2372d14a3d];DATARMNETe823dcf978->
-DATARMNETf9afebb887[DATARMNET2372d14a3d]=DATARMNET91bbdde74c[DATARMNET2372d14a3d
-];}return DATARMNET70fa801d65;}static struct sk_buff*DATARMNET11bbc6360d(struct 
-Qdisc*DATARMNET9b0193c8c4){struct DATARMNET74e95d25df*DATARMNETe823dcf978=
-qdisc_priv(DATARMNET9b0193c8c4);struct sk_buff*DATARMNET543491eb0f=NULL;u8 
-DATARMNET2372d14a3d;DATARMNET2372d14a3d=DATARMNETf9ac3daa83(DATARMNETe823dcf978)
-;if(DATARMNET2372d14a3d<DATARMNETe632b2e0b0){DATARMNET543491eb0f=
-__qdisc_dequeue_head(&DATARMNETe823dcf978->DATARMNETb4180393e4[
-DATARMNET2372d14a3d]);if(likely(DATARMNET543491eb0f)){DATARMNETe823dcf978->
-DATARMNET1de7b3d891[DATARMNET2372d14a3d]--;DATARMNETe823dcf978->
-DATARMNETf9afebb887[DATARMNET2372d14a3d]-=qdisc_pkt_len(DATARMNET543491eb0f);
-qdisc_update_stats_at_dequeue(DATARMNET9b0193c8c4,DATARMNET543491eb0f);}}return 
-DATARMNET543491eb0f;}static struct sk_buff*DATARMNET5842e6aac7(struct Qdisc*
-DATARMNET9b0193c8c4){struct DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(
-DATARMNET9b0193c8c4);struct sk_buff*DATARMNET543491eb0f=NULL;u8 
-DATARMNET2372d14a3d;DATARMNET2372d14a3d=DATARMNETf9ac3daa83(DATARMNETe823dcf978)
-;if(DATARMNET2372d14a3d<DATARMNETe632b2e0b0)DATARMNET543491eb0f=
-DATARMNETe823dcf978->DATARMNETb4180393e4[DATARMNET2372d14a3d].head;return 
-DATARMNET543491eb0f;}static int DATARMNET757a7de682(struct Qdisc*
-DATARMNET9b0193c8c4,struct nlattr*DATARMNET8bdeb8bf5c,struct netlink_ext_ack*
-DATARMNET79a1f177ed){struct DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(
-DATARMNET9b0193c8c4);int DATARMNET2372d14a3d;for(DATARMNET2372d14a3d=
-(0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++)
-{qdisc_skb_head_init(&DATARMNETe823dcf978->DATARMNETb4180393e4[
-DATARMNET2372d14a3d]);DATARMNETe823dcf978->DATARMNET1de7b3d891[
-DATARMNET2372d14a3d]=DATARMNET9dd1382d86[DATARMNET2372d14a3d];
-DATARMNETe823dcf978->DATARMNETf9afebb887[DATARMNET2372d14a3d]=
-DATARMNET91bbdde74c[DATARMNET2372d14a3d];}DATARMNET9b0193c8c4->flags|=
-TCQ_F_CAN_BYPASS;return(0xd2d+202-0xdf7);}static void DATARMNET9593ab9587(struct
- Qdisc*DATARMNET9b0193c8c4){struct DATARMNET74e95d25df*DATARMNETe823dcf978=
-qdisc_priv(DATARMNET9b0193c8c4);int DATARMNET2372d14a3d;for(DATARMNET2372d14a3d=
-(0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++)
-{kfree_skb_list(DATARMNETe823dcf978->DATARMNETb4180393e4[DATARMNET2372d14a3d].
-head);qdisc_skb_head_init(&DATARMNETe823dcf978->DATARMNETb4180393e4[
-DATARMNET2372d14a3d]);DATARMNETe823dcf978->DATARMNET1de7b3d891[
-DATARMNET2372d14a3d]=DATARMNET9dd1382d86[DATARMNET2372d14a3d];
-DATARMNETe823dcf978->DATARMNETf9afebb887[DATARMNET2372d14a3d]=
-DATARMNET91bbdde74c[DATARMNET2372d14a3d];}}static struct Qdisc_ops 
-DATARMNET9afaec21de __read_mostly={.id="\x72\x6d\x6e\x65\x74\x5f\x73\x63\x68",.
-priv_size=sizeof(struct DATARMNET74e95d25df),.enqueue=DATARMNET3a797cc4e9,.
+DATARMNET2372d14a3d++){if(skb_array_init(&DATARMNETe823dcf978->
+DATARMNETb4180393e4[DATARMNET2372d14a3d],DATARMNETdd3d769504,GFP_KERNEL))return
+-ENOMEM;DATARMNETe823dcf978->DATARMNET48792d49f4[DATARMNET2372d14a3d]=(0xd2d+202
+-0xdf7);}DATARMNETe823dcf978->DATARMNET3855e0f6f9=DATARMNETc954ec6b5a;atomic_set
+(&DATARMNETe823dcf978->DATARMNET2e5cf1a8d7,(0xd2d+202-0xdf7));
+DATARMNETe823dcf978->DATARMNET8b61f0c3ea=DATARMNETdd3d769504;DATARMNET9b0193c8c4
+->flags|=TCQ_F_CAN_BYPASS;return(0xd2d+202-0xdf7);}static void 
+DATARMNET9593ab9587(struct Qdisc*DATARMNET9b0193c8c4){
+struct DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(DATARMNET9b0193c8c4);
+struct sk_buff*DATARMNET543491eb0f;int DATARMNET2372d14a3d;for(
+DATARMNET2372d14a3d=(0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;
+DATARMNET2372d14a3d++){struct skb_array*q=&DATARMNETe823dcf978->
+DATARMNETb4180393e4[DATARMNET2372d14a3d];DATARMNETe823dcf978->
+DATARMNET48792d49f4[DATARMNET2372d14a3d]=(0xd2d+202-0xdf7);if(!q->ring.queue)
+continue;while((DATARMNET543491eb0f=__skb_array_consume(q))!=NULL)kfree_skb(
+DATARMNET543491eb0f);}atomic_set(&DATARMNETe823dcf978->DATARMNET2e5cf1a8d7,(
+0xd2d+202-0xdf7));for_each_possible_cpu(DATARMNET2372d14a3d){struct 
+gnet_stats_queue*DATARMNETa754d37d7b;DATARMNETa754d37d7b=per_cpu_ptr(
+DATARMNET9b0193c8c4->cpu_qstats,DATARMNET2372d14a3d);DATARMNETa754d37d7b->
+backlog=(0xd2d+202-0xdf7);DATARMNETa754d37d7b->qlen=(0xd2d+202-0xdf7);}}static 
+void DATARMNET8e58908bcd(struct Qdisc*DATARMNET9b0193c8c4){struct 
+DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(DATARMNET9b0193c8c4);int 
+DATARMNET2372d14a3d;for(DATARMNET2372d14a3d=(0xd2d+202-0xdf7);
+DATARMNET2372d14a3d<DATARMNETe632b2e0b0;DATARMNET2372d14a3d++){struct skb_array*
+q=&DATARMNETe823dcf978->DATARMNETb4180393e4[DATARMNET2372d14a3d];if(!q->ring.
+queue)continue;ptr_ring_cleanup(&q->ring,NULL);}}static int DATARMNET9f504f52d0(
+struct Qdisc*DATARMNET9b0193c8c4,unsigned int DATARMNETdd3d769504){struct 
+DATARMNET74e95d25df*DATARMNETe823dcf978=qdisc_priv(DATARMNET9b0193c8c4);struct 
+skb_array*DATARMNETce55237488[DATARMNETe632b2e0b0];int DATARMNET2372d14a3d;for(
+DATARMNET2372d14a3d=(0xd2d+202-0xdf7);DATARMNET2372d14a3d<DATARMNETe632b2e0b0;
+DATARMNET2372d14a3d++)DATARMNETce55237488[DATARMNET2372d14a3d]=&
+DATARMNETe823dcf978->DATARMNETb4180393e4[DATARMNET2372d14a3d];
+DATARMNET2372d14a3d=skb_array_resize_multiple(DATARMNETce55237488,
+DATARMNETe632b2e0b0,DATARMNETdd3d769504,GFP_KERNEL);if(!DATARMNET2372d14a3d)
+WRITE_ONCE(DATARMNETe823dcf978->DATARMNET8b61f0c3ea,DATARMNETdd3d769504);return 
+DATARMNET2372d14a3d;}static struct Qdisc_ops 
+DATARMNET9afaec21de __read_mostly={.id=
+"\x72\x6d\x6e\x65\x74\x5f\x73\x63\x68"
+,.priv_size=sizeof(struct DATARMNET74e95d25df),.enqueue=DATARMNET3a797cc4e9,.
 dequeue=DATARMNET11bbc6360d,.peek=DATARMNET5842e6aac7,.init=DATARMNET757a7de682,
-.reset=DATARMNET9593ab9587,.owner=THIS_MODULE,};static int __init 
-DATARMNETe97da0a844(void){pr_info(
-"\x73\x63\x68\x3a\x20\x69\x6e\x69\x74\x20\x28\x25\x73\x29" "\n",
-DATARMNETf1bb41174a);return register_qdisc(&DATARMNET9afaec21de);}static void 
+.reset=DATARMNET9593ab9587,.destroy=DATARMNET8e58908bcd,.change_tx_queue_len=
+DATARMNET9f504f52d0,.static_flags=TCQ_F_NOLOCK|TCQ_F_CPUSTATS,.owner=THIS_MODULE
+,};static int __init DATARMNETe97da0a844(void){pr_info(
+"\x73\x63\x68\x3a\x20\x69\x6e\x69\x74\x20\x28\x25\x73\x29" "\n"
+,DATARMNETf1bb41174a);return register_qdisc(&DATARMNET9afaec21de);}static void 
 __exit DATARMNET1dc9099e88(void){unregister_qdisc(&DATARMNET9afaec21de);}
-MODULE_LICENSE("\x47\x50\x4c\x20\x76\x32");module_init(DATARMNETe97da0a844);
-module_exit(DATARMNET1dc9099e88);
+MODULE_LICENSE(
+"\x47\x50\x4c\x20\x76\x32"
+);module_init(DATARMNETe97da0a844);module_exit(DATARMNET1dc9099e88);
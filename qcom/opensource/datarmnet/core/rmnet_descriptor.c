@@ -17,8 +17,10 @@
 #include <linux/ip.h>
 #include <linux/ipv6.h>
 #include <linux/inet.h>
+#include <linux/version.h>
 #include <net/ipv6.h>
 #include <net/ip6_checksum.h>
+#include <net/udp.h>
 #include "rmnet_config.h"
 #include "rmnet_descriptor.h"
 #include "rmnet_handlers.h"
@@ -1068,6 +1070,171 @@ void rmnet_frag_deliver(struct rmnet_frag_descriptor *frag_desc,
 }
 EXPORT_SYMBOL(rmnet_frag_deliver);
 
+/* Whether the local socket a UDP flow is delivered to takes fraglist GSO skbs
+ * as is, or at least would have resegmented the frags based ones too.
+ */
+static bool rmnet_udp_sk_accepts_fraglist(struct sock *sk)
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 5, 0)
+	return udp_test_bit(ACCEPT_FRAGLIST, sk) ||
+	       !udp_test_bit(ACCEPT_L4, sk);
+#else
+	return udp_sk(sk)->accept_udp_fraglist ||
+	       !udp_sk(sk)->accept_udp_l4;
+#endif
+}
+
+/* Check whether the UDP flow of frag_desc can be delivered as a fraglist skb.
+ * Forwarded flows and sockets without UDP_GRO can, but a UDP_GRO socket only
+ * accepts SKB_GSO_UDP_L4 and would have udp_unexpected_gso() split the chain,
+ * so those flows have to keep the frags based coalescing.
+ */
+bool rmnet_frag_udp_fraglist_ok(struct rmnet_frag_descriptor *frag_desc)
+{
+	struct net_device *dev __maybe_unused = frag_desc->dev;
+	struct udphdr *up, __up;
+	struct sock *sk = NULL;
+	bool ok;
+
+	up = rmnet_frag_header_ptr(frag_desc, frag_desc->ip_len, sizeof(*up),
+				   &__up);
+	if (!up)
+		return false;
+
+	if (frag_desc->ip_proto == 4) {
+#if IS_ENABLED(CONFIG_NF_TPROXY_IPV4) || IS_ENABLED(CONFIG_NF_SOCKET_IPV4)
+		struct iphdr *iph, __iph;
+
+		iph = rmnet_frag_header_ptr(frag_desc, 0, sizeof(*iph),
+					    &__iph);
+		if (!iph)
+			return false;
+
+		sk = udp4_lib_lookup(dev_net(dev), iph->saddr, up->source,
+				     iph->daddr, up->dest, dev->ifindex);
+#else
+		/* no socket lookup available, assume a UDP_GRO receiver */
+		return false;
+#endif
+	} else if (frag_desc->ip_proto == 6) {
+#if IS_ENABLED(CONFIG_IPV6) && \
+	(IS_ENABLED(CONFIG_NF_TPROXY_IPV6) || IS_ENABLED(CONFIG_NF_SOCKET_IPV6))
+		struct ipv6hdr *ip6h, __ip6h;
+
+		ip6h = rmnet_frag_header_ptr(frag_desc, 0, sizeof(*ip6h),
+					     &__ip6h);
+		if (!ip6h)
+			return false;
+
+		sk = udp6_lib_lookup(dev_net(dev), &ip6h->saddr, up->source,
+				     &ip6h->daddr, up->dest, dev->ifindex);
+#else
+		return false;
+#endif
+	} else {
+		return false;
+	}
+
+	/* not for a local socket, the flow is forwarded */
+	if (!sk)
+		return true;
+
+	ok = rmnet_udp_sk_accepts_fraglist(sk);
+	sock_put(sk);
+
+	return ok;
+}
+EXPORT_SYMBOL(rmnet_frag_udp_fraglist_ok);
+
+/* Deliver a list of frag descriptors holding equal sized UDP datagrams of the
+ * same flow as a single SKB_GSO_UDP_L4 | SKB_GSO_FRAGLIST skb. Every datagram
+ * keeps its own headers, so the stack can split the chain back up with
+ * skb_segment_list() for sockets that have not enabled UDP_GRO. Callers check
+ * rmnet_frag_udp_fraglist_ok() first.
+ */
+void rmnet_frag_deliver_fraglist(struct list_head *desc_list,
+				 struct rmnet_port *port)
+{
+	struct rmnet_frag_descriptor *frag_desc, *tmp;
+	struct sk_buff *head_skb = NULL, *tail = NULL, *skb;
+	struct skb_shared_info *shinfo;
+	u16 segs = 1;
+
+	list_for_each_entry_safe(frag_desc, tmp, desc_list, list) {
+		struct udphdr *up, __up;
+		__sum16 check;
+
+		up = rmnet_frag_header_ptr(frag_desc, frag_desc->ip_len,
+					   sizeof(*up), &__up);
+		if (!up) {
+			rmnet_recycle_frag_descriptor(frag_desc, port);
+			continue;
+		}
+
+		check = up->check;
+		skb = rmnet_alloc_skb(frag_desc, port);
+		rmnet_recycle_frag_descriptor(frag_desc, port);
+		if (!skb)
+			continue;
+
+		/* The hardware has validated the checksum already. Put back
+		 * the original value that rmnet_frag_partial_csum() replaced
+		 * so each segment is valid on its own once split.
+		 */
+		udp_hdr(skb)->check = check;
+		skb->ip_summed = CHECKSUM_UNNECESSARY;
+
+		if (!head_skb) {
+			head_skb = skb;
+			continue;
+		}
+
+		/* Members start at the payload like GRO fraglist segments */
+		skb_pull(skb, skb_transport_offset(skb) +
+			      sizeof(struct udphdr));
+		if (!tail)
+			skb_shinfo(head_skb)->frag_list = skb;
+		else
+			tail->next = skb;
+
+		tail = skb;
+		head_skb->len += skb->len;
+		head_skb->data_len += skb->len;
+		head_skb->truesize += skb->truesize;
+		segs++;
+	}
+
+	if (!head_skb)
+		return;
+
+	if (segs > 1) {
+		unsigned int ip_len = skb_transport_offset(head_skb);
+
+		shinfo = skb_shinfo(head_skb);
+		shinfo->gso_size = ntohs(udp_hdr(head_skb)->len) -
+				   sizeof(struct udphdr);
+		shinfo->gso_type = SKB_GSO_UDP_L4 | SKB_GSO_FRAGLIST;
+		shinfo->gso_segs = segs;
+
+		/* Headers of the head skb describe the whole chain */
+		if (head_skb->protocol == htons(ETH_P_IP)) {
+			struct iphdr *iph = ip_hdr(head_skb);
+
+			iph->tot_len = htons(head_skb->len);
+			iph->check = 0;
+			iph->check = ip_fast_csum(iph, iph->ihl);
+		} else {
+			ipv6_hdr(head_skb)->payload_len =
+				htons(head_skb->len - sizeof(struct ipv6hdr));
+		}
+
+		udp_hdr(head_skb)->len = htons(head_skb->len - ip_len);
+	}
+
+	rmnet_deliver_skb(head_skb, port);
+}
+EXPORT_SYMBOL(rmnet_frag_deliver_fraglist);
+
 static void __rmnet_frag_segment_data(struct rmnet_frag_descriptor *coal_desc,
 				      struct rmnet_port *port,
 				      struct list_head *list, u8 pkt_id,
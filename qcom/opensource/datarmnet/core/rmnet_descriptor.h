@@ -59,7 +59,8 @@ struct rmnet_frag_descriptor {
 	   tcp_seq_set:1,
 	   flush_shs:1,
 	   tcp_flags_set:1,
-	   reserved:2;
+	   fraglist:1,
+	   reserved:1;
 };
 
 /* Descriptor management */
@@ -93,6 +94,9 @@ void rmnet_frag_deaggregate(struct sk_buff *skb, struct rmnet_port *port,
 			    struct list_head *list, u32 priority);
 void rmnet_frag_deliver(struct rmnet_frag_descriptor *frag_desc,
 			struct rmnet_port *port);
+bool rmnet_frag_udp_fraglist_ok(struct rmnet_frag_descriptor *frag_desc);
+void rmnet_frag_deliver_fraglist(struct list_head *desc_list,
+				 struct rmnet_port *port);
 int rmnet_frag_process_next_hdr_packet(struct rmnet_frag_descriptor *frag_desc,
 				       struct rmnet_port *port,
 				       struct list_head *list,
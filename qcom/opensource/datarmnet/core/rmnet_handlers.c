@@ -107,6 +107,11 @@ int (*rmnet_shs_skb_entry_wq)(struct sk_buff *skb,
 			      struct rmnet_shs_clnt_s *cfg) __rcu __read_mostly;
 EXPORT_SYMBOL(rmnet_shs_skb_entry_wq);
 
+/* perf_tether forwarding hook. Returns nonzero if the packet was consumed */
+typedef int (*rmnet_perf_tether_fwd_hook_t)(struct sk_buff *skb);
+rmnet_perf_tether_fwd_hook_t rmnet_perf_tether_fwd_hook __rcu __read_mostly;
+EXPORT_SYMBOL(rmnet_perf_tether_fwd_hook);
+
 /* Generic handler */
 
 void
@@ -114,6 +119,7 @@ rmnet_deliver_skb(struct sk_buff *skb, struct rmnet_port *port)
 {
 	int (*rmnet_shs_stamp)(struct sk_buff *skb,
 			       struct rmnet_shs_clnt_s *cfg);
+	rmnet_perf_tether_fwd_hook_t rmnet_perf_tether_fwd;
 
 	trace_rmnet_low(RMNET_MODULE, RMNET_DLVR_SKB, 0xDEF, 0xDEF,
 			0xDEF, 0xDEF, (void *)skb, NULL);
@@ -123,6 +129,15 @@ rmnet_deliver_skb(struct sk_buff *skb, struct rmnet_port *port)
 	skb->pkt_type = PACKET_HOST;
 	skb_set_mac_header(skb, 0);
 
+	/* Learned tethered flows go straight to the tethering device */
+	rcu_read_lock();
+	rmnet_perf_tether_fwd = rcu_dereference(rmnet_perf_tether_fwd_hook);
+	if (rmnet_perf_tether_fwd && rmnet_perf_tether_fwd(skb)) {
+		rcu_read_unlock();
+		return;
+	}
+	rcu_read_unlock();
+
 	/* Low latency packets use a different balancing scheme */
 	if (skb->priority == 0xda1a)
 		goto skip_shs;
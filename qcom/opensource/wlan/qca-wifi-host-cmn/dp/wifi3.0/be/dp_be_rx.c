@@ -468,7 +468,10 @@ more_data:
 			break;
 	}
 done:
-	dp_rx_srng_access_end(int_ctx, soc, hal_ring_hdl);
+	if (dp_rx_attempt_coalescing(soc, reo_ring_num, num_rx_bufs_reaped))
+		dp_rx_srng_access_end_reap(int_ctx, soc, hal_ring_hdl);
+	else
+		dp_rx_srng_access_end(int_ctx, soc, hal_ring_hdl);
 
 	replenish_soc = dp_rx_replensih_soc_get(soc, reo_ring_num);
 	for (mac_id = 0; mac_id < MAX_PDEV_CNT; mac_id++) {
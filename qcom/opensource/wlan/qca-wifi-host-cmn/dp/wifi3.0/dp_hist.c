@@ -21,71 +21,55 @@
 #include <cdp_txrx_hist_struct.h>
 #include "dp_hist.h"
 
-/*
- * dp_hist_sw_enq_dbucket: Sofware enqueue delay bucket in ms
- * @index_0 = 0_1 ms
- * @index_1 = 1_2 ms
- * @index_2 = 2_3 ms
- * @index_3 = 3_4 ms
- * @index_4 = 4_5 ms
- * @index_5 = 5_6 ms
- * @index_6 = 6_7 ms
- * @index_7 = 7_8 ms
- * @index_8 = 8_9 ms
- * @index_8 = 9+ ms
- */
-static uint16_t dp_hist_sw_enq_dbucket[CDP_HIST_BUCKET_MAX] = {
-	0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+/* Max sum of the sample counts used to weight averages when merging */
+#define DP_HIST_AVG_WEIGHT_MAX 0x7fffffff
 
 /*
- * cdp_hist_fw2hw_dbucket: HW enqueue to Completion Delay
- * @index_0 = 0_10 ms
- * @index_1 = 10_20 ms
- * @index_2 = 20_30ms
- * @index_3 = 30_40 ms
- * @index_4 = 40_50 ms
- * @index_5 = 50_60 ms
- * @index_6 = 60_70 ms
- * @index_7 = 70_80 ms
- * @index_8 = 80_90 ms
- * @index_9 = 90+ ms
- */
-static uint16_t dp_hist_fw2hw_dbucket[CDP_HIST_BUCKET_MAX] = {
-	0, 10, 20, 30, 40, 50, 60, 70, 80, 90};
-
-/*
- * dp_hist_reap2stack_bucket: Reap to stack bucket
- * @index_0 = 0_5 ms
- * @index_1 = 5_10 ms
- * @index_2 = 10_15 ms
- * @index_3 = 15_20 ms
- * @index_4 = 20_25 ms
- * @index_5 = 25_30 ms
- * @index_6 = 30_35 ms
- * @index_7 = 35_40 ms
- * @index_8 = 40_45 ms
- * @index_9 = 45+ ms
+ * Bucket widths of the delay histograms in ms. Bucket i holds delays in
+ * [i * width, (i + 1) * width) and the last bucket everything above.
+ *
+ * DP_HIST_SW_ENQ_BUCKET_WIDTH: software enqueue delay, 0_1 ms ... 9+ ms
+ * DP_HIST_FW2HW_BUCKET_WIDTH: HW enqueue to completion delay,
+ *			       0_10 ms ... 90+ ms
+ * DP_HIST_REAP2STACK_BUCKET_WIDTH: reap to stack delay, 0_5 ms ... 45+ ms
  */
-static uint16_t dp_hist_reap2stack_bucket[CDP_HIST_BUCKET_MAX] = {
-	0, 5, 10, 15, 20, 25, 30, 35, 40, 45};
+#define DP_HIST_SW_ENQ_BUCKET_WIDTH 1
+#define DP_HIST_FW2HW_BUCKET_WIDTH 10
+#define DP_HIST_REAP2STACK_BUCKET_WIDTH 5
 
 /*
  * dp_hist_find_bucket_idx: Find the bucket index
- * @bucket_array: Bucket array
+ * @hist_type: Histogram type
  * @value: Frequency value
  *
- * Return: The bucket index
+ * The bucket widths are compile time constants, so the division is turned
+ * into a multiply and the index is found in constant time.
+ *
+ * Return: The bucket index, CDP_HIST_BUCKET_MAX for an unknown type
  */
-static int dp_hist_find_bucket_idx(int16_t *bucket_array, int value)
+static inline int dp_hist_find_bucket_idx(enum cdp_hist_types hist_type,
+					  int value)
 {
-	uint8_t idx = CDP_HIST_BUCKET_0;
+	uint32_t idx;
+
+	if (qdf_unlikely(value < 0))
+		return CDP_HIST_BUCKET_0;
 
-	for (; idx < (CDP_HIST_BUCKET_MAX - 1); idx++) {
-		if (value < bucket_array[idx + 1])
-			break;
+	switch (hist_type) {
+	case CDP_HIST_TYPE_SW_ENQEUE_DELAY:
+		idx = (uint32_t)value / DP_HIST_SW_ENQ_BUCKET_WIDTH;
+		break;
+	case CDP_HIST_TYPE_HW_COMP_DELAY:
+		idx = (uint32_t)value / DP_HIST_FW2HW_BUCKET_WIDTH;
+		break;
+	case CDP_HIST_TYPE_REAP_STACK:
+		idx = (uint32_t)value / DP_HIST_REAP2STACK_BUCKET_WIDTH;
+		break;
+	default:
+		return CDP_HIST_BUCKET_MAX;
 	}
 
-	return idx;
+	return idx < CDP_HIST_BUCKET_MAX ? idx : CDP_HIST_BUCKET_MAX - 1;
 }
 
 /*
@@ -97,32 +81,13 @@ static int dp_hist_find_bucket_idx(int16_t *bucket_array, int value)
  */
 static void dp_hist_fill_buckets(struct cdp_hist_bucket *hist_bucket, int value)
 {
-	enum cdp_hist_types hist_type;
-	int idx = CDP_HIST_BUCKET_MAX;
+	int idx;
 
 	if (qdf_unlikely(!hist_bucket))
 		return;
 
-	hist_type = hist_bucket->hist_type;
-
 	/* Identify the bucket the bucket and update. */
-	switch (hist_type) {
-	case CDP_HIST_TYPE_SW_ENQEUE_DELAY:
-		idx =  dp_hist_find_bucket_idx(&dp_hist_sw_enq_dbucket[0],
-					       value);
-		break;
-	case CDP_HIST_TYPE_HW_COMP_DELAY:
-		idx =  dp_hist_find_bucket_idx(&dp_hist_fw2hw_dbucket[0],
-					       value);
-		break;
-	case CDP_HIST_TYPE_REAP_STACK:
-		idx =  dp_hist_find_bucket_idx(
-				&dp_hist_reap2stack_bucket[0], value);
-		break;
-	default:
-		break;
-	}
-
+	idx = dp_hist_find_bucket_idx(hist_bucket->hist_type, value);
 	if (idx == CDP_HIST_BUCKET_MAX)
 		return;
 
@@ -163,6 +128,23 @@ void dp_hist_update_stats(struct cdp_hist_stats *hist_stats, int value)
 			((value - hist_stats->avg) >> HIST_AVG_WEIGHT_DENOM);
 }
 
+/*
+ * dp_hist_num_samples(): Get the number of samples in a histogram
+ * @hist_stats: Hist stats object
+ *
+ * Return: number of samples
+ */
+static uint64_t dp_hist_num_samples(struct cdp_hist_stats *hist_stats)
+{
+	uint64_t num = 0;
+	uint8_t index;
+
+	for (index = 0; index < CDP_HIST_BUCKET_MAX; index++)
+		num += hist_stats->hist.freq[index];
+
+	return num;
+}
+
 /*
  * dp_copy_hist_stats(): Copy the histogram stats
  * @src_hist_stats: Source histogram stats
@@ -175,6 +157,9 @@ void dp_copy_hist_stats(struct cdp_hist_stats *src_hist_stats,
 {
 	uint8_t index;
 
+	if (!dp_hist_num_samples(src_hist_stats))
+		return;
+
 	for (index = 0; index < CDP_HIST_BUCKET_MAX; index++)
 		dst_hist_stats->hist.freq[index] =
 			src_hist_stats->hist.freq[index];
@@ -188,19 +173,47 @@ void dp_copy_hist_stats(struct cdp_hist_stats *src_hist_stats,
  * @src_hist_stats: Source histogram stats
  * @dst_hist_stats: Destination histogram stats
  *
+ * Per context histograms are only merged here, on read. The average of
+ * @dst_hist_stats is weighted by the number of samples of each side and an
+ * empty source leaves @dst_hist_stats untouched.
+ *
  * Return: void
  */
 void dp_accumulate_hist_stats(struct cdp_hist_stats *src_hist_stats,
 			      struct cdp_hist_stats *dst_hist_stats)
 {
+	uint64_t src_num, dst_num;
+	int64_t avg;
 	uint8_t index;
 
+	src_num = dp_hist_num_samples(src_hist_stats);
+	if (!src_num)
+		return;
+
+	dst_num = dp_hist_num_samples(dst_hist_stats);
+	if (!dst_num) {
+		dp_copy_hist_stats(src_hist_stats, dst_hist_stats);
+		return;
+	}
+
 	for (index = 0; index < CDP_HIST_BUCKET_MAX; index++)
 		dst_hist_stats->hist.freq[index] +=
 			src_hist_stats->hist.freq[index];
 	dst_hist_stats->min = QDF_MIN(src_hist_stats->min, dst_hist_stats->min);
 	dst_hist_stats->max = QDF_MAX(src_hist_stats->max, dst_hist_stats->max);
-	dst_hist_stats->avg = (src_hist_stats->avg + dst_hist_stats->avg) >> 1;
+
+	/* keep the weights small enough for a 32 bit divisor */
+	while (src_num + dst_num > DP_HIST_AVG_WEIGHT_MAX) {
+		src_num = (src_num >> 1) + 1;
+		dst_num = (dst_num >> 1) + 1;
+	}
+
+	avg = (int64_t)src_hist_stats->avg * src_num +
+	      (int64_t)dst_hist_stats->avg * dst_num;
+	if (avg < 0)
+		dst_hist_stats->avg = -(int)qdf_do_div(-avg, src_num + dst_num);
+	else
+		dst_hist_stats->avg = qdf_do_div(avg, src_num + dst_num);
 }
 
 /*
@@ -213,4 +226,5 @@ void dp_hist_init(struct cdp_hist_stats *hist_stats,
 {
 	qdf_mem_zero(hist_stats, sizeof(*hist_stats));
 	hist_stats->hist.hist_type = hist_type;
+	hist_stats->min = DP_HIST_MIN_INIT;
 }
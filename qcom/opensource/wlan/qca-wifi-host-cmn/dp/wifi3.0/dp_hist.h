@@ -25,6 +25,8 @@
 #define __DP_HIST_H_
 
 #define HIST_AVG_WEIGHT_DENOM 4
+/* Min of a histogram without samples */
+#define DP_HIST_MIN_INIT 0x7fffffff
 
 /*
  * dp_hist_update_stats: Update histogram stats
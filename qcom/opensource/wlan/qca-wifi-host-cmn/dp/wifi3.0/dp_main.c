@@ -6922,6 +6922,7 @@ dp_peer_create_wifi3(struct cdp_soc_t *soc_hdl, uint8_t vdev_id,
 
 	/* store provided params */
 	peer->vdev = vdev;
+	peer->vdev_id = vdev->vdev_id;
 	DP_PEER_SET_TYPE(peer, peer_type);
 	/* get the vdev reference for new peer */
 	dp_vdev_get_ref(soc, vdev, DP_MOD_ID_CHILD);
@@ -7100,6 +7101,7 @@ QDF_STATUS dp_peer_mlo_setup(
 			 */
 			mld_peer->vdev = dp_vdev_get_ref_by_id(soc, vdev_id,
 							       DP_MOD_ID_CHILD);
+			mld_peer->vdev_id = vdev_id;
 		}
 
 		/* associate mld and link peer */
@@ -7876,6 +7878,16 @@ free_vdev:
 
 qdf_export_symbol(dp_vdev_unref_delete);
 
+/*
+ * dp_peer_free_rcu() - free peer memory after its RCU grace period
+ * @head: rcu head embedded in the peer
+ *
+ */
+static void dp_peer_free_rcu(qdf_rcu_head_t *head)
+{
+	qdf_mem_free(qdf_container_of(head, struct dp_peer, rcu));
+}
+
 /*
  * dp_peer_unref_delete() - unref and delete peer
  * @peer_handle:    Datapath peer handle
@@ -7961,7 +7973,8 @@ void dp_peer_unref_delete(struct dp_peer *peer, enum dp_mod_id mod_id)
 		dp_monitor_peer_detach(soc, peer);
 
 		qdf_spinlock_destroy(&peer->peer_state_lock);
-		qdf_mem_free(peer);
+		/* hash lookups walk the bins without peer_hash_lock */
+		qdf_call_rcu(&peer->rcu, dp_peer_free_rcu);
 
 		/*
 		 * Decrement ref count taken at peer create
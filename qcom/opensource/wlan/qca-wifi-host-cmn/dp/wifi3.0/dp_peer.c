@@ -317,8 +317,8 @@ void dp_peer_find_hash_add(struct dp_soc *soc, struct dp_peer *peer)
 		 * this ensures that if two entries with the same MAC address
 		 * are stored, the one added first will be found first.
 		 */
-		TAILQ_INSERT_TAIL(&soc->peer_hash.bins[index], peer,
-				  hash_list_elem);
+		qdf_tailq_insert_tail_rcu(&soc->peer_hash.bins[index], peer,
+					  hash_list_elem);
 
 		qdf_spin_unlock_bh(&soc->peer_hash_lock);
 	} else if (peer->peer_type == CDP_MLD_PEER_TYPE) {
@@ -332,6 +332,8 @@ void dp_peer_find_hash_add(struct dp_soc *soc, struct dp_peer *peer)
 /*
  * dp_peer_find_hash_find() - returns peer from peer_hash_table matching
  *                            vdev_id and mac_address
+ *
+ * The link peer table is walked under RCU without taking peer_hash_lock.
  * @soc: soc handle
  * @peer_mac_addr: peer mac address
  * @mac_addr_is_aligned: is mac addr alligned
@@ -364,21 +366,26 @@ struct dp_peer *dp_peer_find_hash_find(struct dp_soc *soc,
 	}
 	/* search link peer table firstly */
 	index = dp_peer_find_hash_index(soc, mac_addr);
-	qdf_spin_lock_bh(&soc->peer_hash_lock);
-	TAILQ_FOREACH(peer, &soc->peer_hash.bins[index], hash_list_elem) {
-		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0 &&
-		    ((peer->vdev->vdev_id == vdev_id) ||
-		     (vdev_id == DP_VDEV_ALL))) {
-			/* take peer reference before returning */
-			if (dp_peer_get_ref(soc, peer, mod_id) !=
-						QDF_STATUS_SUCCESS)
-				peer = NULL;
+	qdf_rcu_read_lock();
+	qdf_tailq_foreach_rcu(peer, &soc->peer_hash.bins[index],
+			      hash_list_elem) {
+		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr))
+			continue;
 
-			qdf_spin_unlock_bh(&soc->peer_hash_lock);
+		/*
+		 * RCU keeps the peer memory valid, but not its vdev, so the
+		 * cached vdev id is checked before taking a reference. Peers
+		 * already being deleted are skipped.
+		 */
+		if (peer->vdev_id != vdev_id && vdev_id != DP_VDEV_ALL)
+			continue;
+
+		if (dp_peer_get_ref(soc, peer, mod_id) == QDF_STATUS_SUCCESS) {
+			qdf_rcu_read_unlock();
 			return peer;
 		}
 	}
-	qdf_spin_unlock_bh(&soc->peer_hash_lock);
+	qdf_rcu_read_unlock();
 
 	if (soc->arch_ops.mlo_peer_find_hash_find)
 		return soc->arch_ops.mlo_peer_find_hash_find(soc, peer_mac_addr,
@@ -417,8 +424,8 @@ void dp_peer_find_hash_remove(struct dp_soc *soc, struct dp_peer *peer)
 			}
 		}
 		QDF_ASSERT(found);
-		TAILQ_REMOVE(&soc->peer_hash.bins[index], peer,
-			     hash_list_elem);
+		qdf_tailq_remove_rcu(&soc->peer_hash.bins[index], peer,
+				     hash_list_elem);
 
 		dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
 		qdf_spin_unlock_bh(&soc->peer_hash_lock);
@@ -528,7 +535,8 @@ void dp_peer_find_hash_add(struct dp_soc *soc, struct dp_peer *peer)
 	 * the same MAC address are stored, the one added first will be
 	 * found first.
 	 */
-	TAILQ_INSERT_TAIL(&soc->peer_hash.bins[index], peer, hash_list_elem);
+	qdf_tailq_insert_tail_rcu(&soc->peer_hash.bins[index], peer,
+				  hash_list_elem);
 
 	qdf_spin_unlock_bh(&soc->peer_hash_lock);
 }
@@ -554,21 +562,26 @@ struct dp_peer *dp_peer_find_hash_find(
 		mac_addr = &local_mac_addr_aligned;
 	}
 	index = dp_peer_find_hash_index(soc, mac_addr);
-	qdf_spin_lock_bh(&soc->peer_hash_lock);
-	TAILQ_FOREACH(peer, &soc->peer_hash.bins[index], hash_list_elem) {
-		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr) == 0 &&
-		    ((peer->vdev->vdev_id == vdev_id) ||
-		     (vdev_id == DP_VDEV_ALL))) {
-			/* take peer reference before returning */
-			if (dp_peer_get_ref(soc, peer, mod_id) !=
-						QDF_STATUS_SUCCESS)
-				peer = NULL;
+	qdf_rcu_read_lock();
+	qdf_tailq_foreach_rcu(peer, &soc->peer_hash.bins[index],
+			      hash_list_elem) {
+		if (dp_peer_find_mac_addr_cmp(mac_addr, &peer->mac_addr))
+			continue;
 
-			qdf_spin_unlock_bh(&soc->peer_hash_lock);
+		/*
+		 * RCU keeps the peer memory valid, but not its vdev, so the
+		 * cached vdev id is checked before taking a reference. Peers
+		 * already being deleted are skipped.
+		 */
+		if (peer->vdev_id != vdev_id && vdev_id != DP_VDEV_ALL)
+			continue;
+
+		if (dp_peer_get_ref(soc, peer, mod_id) == QDF_STATUS_SUCCESS) {
+			qdf_rcu_read_unlock();
 			return peer;
 		}
 	}
-	qdf_spin_unlock_bh(&soc->peer_hash_lock);
+	qdf_rcu_read_unlock();
 	return NULL; /* failure */
 }
 
@@ -592,7 +605,8 @@ void dp_peer_find_hash_remove(struct dp_soc *soc, struct dp_peer *peer)
 		}
 	}
 	QDF_ASSERT(found);
-	TAILQ_REMOVE(&soc->peer_hash.bins[index], peer, hash_list_elem);
+	qdf_tailq_remove_rcu(&soc->peer_hash.bins[index], peer,
+			     hash_list_elem);
 
 	dp_peer_unref_delete(peer, DP_MOD_ID_CONFIG);
 	qdf_spin_unlock_bh(&soc->peer_hash_lock);
@@ -823,7 +837,8 @@ struct dp_mec_entry *dp_peer_mec_hash_find_by_pdevid(struct dp_soc *soc,
 	mac_addr = &local_mac_addr_aligned;
 
 	index = dp_peer_mec_hash_index(soc, mac_addr);
-	TAILQ_FOREACH(mecentry, &soc->mec_hash.bins[index], hash_list_elem) {
+	qdf_tailq_foreach_rcu(mecentry, &soc->mec_hash.bins[index],
+			      hash_list_elem) {
 		if ((pdev_id == mecentry->pdev_id) &&
 		    !dp_peer_find_mac_addr_cmp(mac_addr, &mecentry->mac_addr))
 			return mecentry;
@@ -847,7 +862,8 @@ static inline void dp_peer_mec_hash_add(struct dp_soc *soc,
 
 	index = dp_peer_mec_hash_index(soc, &mecentry->mac_addr);
 	qdf_spin_lock_bh(&soc->mec_lock);
-	TAILQ_INSERT_TAIL(&soc->mec_hash.bins[index], mecentry, hash_list_elem);
+	qdf_tailq_insert_tail_rcu(&soc->mec_hash.bins[index], mecentry,
+				  hash_list_elem);
 	qdf_spin_unlock_bh(&soc->mec_lock);
 }
 
@@ -916,9 +932,20 @@ void dp_peer_mec_detach_entry(struct dp_soc *soc, struct dp_mec_entry *mecentry,
 
 	TAILQ_HEAD(, dp_mec_entry) * free_list = ptr;
 
-	TAILQ_REMOVE(&soc->mec_hash.bins[index], mecentry,
-		     hash_list_elem);
-	TAILQ_INSERT_TAIL(free_list, mecentry, hash_list_elem);
+	qdf_tailq_remove_rcu(&soc->mec_hash.bins[index], mecentry,
+			     hash_list_elem);
+	TAILQ_INSERT_TAIL(free_list, mecentry, free_list_elem);
+}
+
+/**
+ * dp_peer_mec_free_rcu() - free a MEC entry after its RCU grace period
+ * @head: rcu head embedded in the MEC entry
+ *
+ * Return: None
+ */
+static void dp_peer_mec_free_rcu(qdf_rcu_head_t *head)
+{
+	qdf_mem_free(qdf_container_of(head, struct dp_mec_entry, rcu));
 }
 
 void dp_peer_mec_free_list(struct dp_soc *soc, void *ptr)
@@ -927,11 +954,12 @@ void dp_peer_mec_free_list(struct dp_soc *soc, void *ptr)
 
 	TAILQ_HEAD(, dp_mec_entry) * free_list = ptr;
 
-	TAILQ_FOREACH_SAFE(mecentry, free_list, hash_list_elem,
+	TAILQ_FOREACH_SAFE(mecentry, free_list, free_list_elem,
 			   mecentry_next) {
 		dp_peer_debug("%pK: MEC delete for mac_addr " QDF_MAC_ADDR_FMT,
 			      soc, QDF_MAC_ADDR_REF(&mecentry->mac_addr));
-		qdf_mem_free(mecentry);
+		/* lock-free readers may still be walking this entry */
+		qdf_call_rcu(&mecentry->rcu, dp_peer_mec_free_rcu);
 		qdf_atomic_dec(&soc->mec_cnt);
 		DP_STATS_INC(soc, mec.deleted, 1);
 	}
@@ -946,6 +974,7 @@ void dp_peer_mec_free_list(struct dp_soc *soc, void *ptr)
 void dp_peer_mec_hash_detach(struct dp_soc *soc)
 {
 	dp_peer_mec_flush_entries(soc);
+	qdf_rcu_barrier();
 	qdf_mem_free(soc->mec_hash.bins);
 	soc->mec_hash.bins = NULL;
 }
@@ -2813,6 +2842,8 @@ dp_peer_find_detach(struct dp_soc *soc)
 {
 	dp_soc_wds_detach(soc);
 	dp_peer_find_map_detach(soc);
+	/* let deferred peer frees finish before the hash goes away */
+	qdf_rcu_barrier();
 	dp_peer_find_hash_detach(soc);
 	dp_peer_ast_hash_detach(soc);
 	dp_peer_ast_table_detach(soc);
@@ -2823,6 +2854,7 @@ void
 dp_peer_find_detach(struct dp_soc *soc)
 {
 	dp_peer_find_map_detach(soc);
+	qdf_rcu_barrier();
 	dp_peer_find_hash_detach(soc);
 }
 #endif
@@ -21,6 +21,7 @@
 
 #include <qdf_types.h>
 #include <qdf_lock.h>
+#include <qdf_rcu.h>
 #include "dp_types.h"
 
 #ifdef DUMP_REO_QUEUE_INFO_IN_DDR
@@ -731,8 +732,8 @@ QDF_STATUS dp_peer_mec_add_entry(struct dp_soc *soc,
  * within pdev
  * @soc: SoC handle
  *
- * It assumes caller has taken the mec_lock to protect the access to
- * MEC hash table
+ * It assumes caller has taken the mec_lock or is inside
+ * qdf_rcu_read_lock() to protect the access to MEC hash table
  *
  * Return: MEC entry
  */
@@ -39,6 +39,9 @@
 #ifdef FEATURE_WDS
 #include "dp_txrx_wds.h"
 #endif
+#ifdef WLAN_DP_FEATURE_SW_LATENCY_MGR
+#include <dp_swlm.h>
+#endif
 
 #ifdef DUP_RX_DESC_WAR
 void dp_rx_dump_info_and_assert(struct dp_soc *soc,
@@ -2133,6 +2136,30 @@ void dp_rx_update_stats(struct dp_soc *soc, qdf_nbuf_t nbuf)
 	DP_STATS_INC_PKT(soc, rx.ingress, 1,
 			 QDF_NBUF_CB_RX_PKT_LEN(nbuf));
 }
+
+int dp_rx_attempt_coalescing(struct dp_soc *soc, uint8_t ring_id,
+			     uint32_t num_reaped)
+{
+	struct dp_swlm *swlm = &soc->swlm;
+	union swlm_data swlm_query_data;
+	struct dp_swlm_reo_data reo_data;
+	int ret;
+
+	if (!swlm->is_enabled)
+		return 0;
+
+	reo_data.ring_id = ring_id;
+	reo_data.num_reaped = num_reaped;
+	swlm_query_data.reo_data = &reo_data;
+
+	ret = dp_swlm_query_policy(soc, REO_DST, swlm_query_data);
+	if (ret)
+		DP_STATS_INC(swlm, reo[ring_id].coalesce_success, 1);
+	else
+		DP_STATS_INC(swlm, reo[ring_id].coalesce_fail, 1);
+
+	return ret;
+}
 #endif
 
 #ifdef WLAN_FEATURE_PKT_CAPTURE_V2
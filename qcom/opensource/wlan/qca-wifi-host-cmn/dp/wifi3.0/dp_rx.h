@@ -1740,6 +1740,21 @@ dp_rx_srng_access_end(struct dp_intr *int_ctx, struct dp_soc *soc,
 {
 	hal_srng_access_end_unlocked(soc->hal_soc, hal_ring_hdl);
 }
+
+/*
+ * dp_rx_srng_access_end_reap()- End ring access without updating the
+ *				 ring pointer to HW
+ * @int_ctx: pointer to DP interrupt context
+ * @dp_soc - DP soc structure pointer
+ * @hal_ring_hdl - HAL ring handle
+ *
+ * Return - None
+ */
+static inline void
+dp_rx_srng_access_end_reap(struct dp_intr *int_ctx, struct dp_soc *soc,
+			   hal_ring_handle_t hal_ring_hdl)
+{
+}
 #else
 static inline int
 dp_rx_srng_access_start(struct dp_intr *int_ctx, struct dp_soc *soc,
@@ -1754,6 +1769,13 @@ dp_rx_srng_access_end(struct dp_intr *int_ctx, struct dp_soc *soc,
 {
 	dp_srng_access_end(int_ctx, soc, hal_ring_hdl);
 }
+
+static inline void
+dp_rx_srng_access_end_reap(struct dp_intr *int_ctx, struct dp_soc *soc,
+			   hal_ring_handle_t hal_ring_hdl)
+{
+	hal_srng_access_end_reap(soc->hal_soc, hal_ring_hdl);
+}
 #endif
 
 #endif /* QCA_HOST_MODE_WIFI_DISABLED */
@@ -1966,11 +1988,31 @@ QDF_STATUS dp_rx_desc_nbuf_sanity_check(struct dp_soc *soc,
 
 #ifdef WLAN_DP_FEATURE_SW_LATENCY_MGR
 void dp_rx_update_stats(struct dp_soc *soc, qdf_nbuf_t nbuf);
+
+/**
+ * dp_rx_attempt_coalescing() - Check and attempt REO destination ring TP
+ *				write coalescing
+ * @soc: Datapath soc handle
+ * @ring_id: REO destination ring id
+ * @num_reaped: Num entries reaped in the current ring access
+ *
+ * Returns: 1, if coalescing is to be done
+ *	    0, if coalescing is not to be done
+ */
+int dp_rx_attempt_coalescing(struct dp_soc *soc, uint8_t ring_id,
+			     uint32_t num_reaped);
 #else
 static inline
 void dp_rx_update_stats(struct dp_soc *soc, qdf_nbuf_t nbuf)
 {
 }
+
+static inline int dp_rx_attempt_coalescing(struct dp_soc *soc,
+					   uint8_t ring_id,
+					   uint32_t num_reaped)
+{
+	return 0;
+}
 #endif
 
 /**
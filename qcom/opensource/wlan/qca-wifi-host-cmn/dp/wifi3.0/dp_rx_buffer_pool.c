@@ -115,6 +115,49 @@ void dp_rx_buffer_pool_nbuf_free(struct dp_soc *soc, qdf_nbuf_t nbuf, u8 mac_id)
 	qdf_nbuf_queue_head_enqueue_tail(&buff_pool->emerg_nbuf_q, nbuf);
 }
 
+/**
+ * dp_rx_refill_buff_pool_update_target() - size the refill pool fill level
+ * @buff_pool: refill buffer pool
+ *
+ * The consumption rate is sampled from how far the replenish paths moved
+ * the consumer index since the previous refill run. It follows increases
+ * at once and decays slowly, and the pool is kept at a few rate windows
+ * worth of buffers so that bursts are served from the pool while the
+ * refill thread catches up.
+ *
+ * Return: None
+ */
+static void
+dp_rx_refill_buff_pool_update_target(struct rx_refill_buff_pool *buff_pool)
+{
+	uint32_t tail = qdf_atomic_read(&buff_pool->tail);
+	unsigned long now = qdf_get_system_timestamp();
+	uint32_t elapsed = now - buff_pool->last_ts;
+	uint32_t rate;
+	uint32_t target;
+
+	if (elapsed < DP_RX_REFILL_RATE_WINDOW_MS)
+		return;
+
+	rate = (tail - buff_pool->last_tail) * DP_RX_REFILL_RATE_WINDOW_MS /
+	       elapsed;
+	if (rate > buff_pool->cons_rate)
+		buff_pool->cons_rate = rate;
+	else
+		buff_pool->cons_rate = (buff_pool->cons_rate * 3 + rate) >> 2;
+
+	buff_pool->last_tail = tail;
+	buff_pool->last_ts = now;
+
+	target = buff_pool->cons_rate * DP_RX_REFILL_BUFF_POOL_HEADROOM;
+	if (target < DP_RX_REFILL_BUFF_POOL_MIN_LEVEL)
+		target = DP_RX_REFILL_BUFF_POOL_MIN_LEVEL;
+	else if (target > buff_pool->max_bufq_len)
+		target = buff_pool->max_bufq_len;
+
+	buff_pool->target_level = target;
+}
+
 void dp_rx_refill_buff_pool_enqueue(struct dp_soc *soc)
 {
 	struct rx_desc_pool *rx_desc_pool;
@@ -123,10 +166,10 @@ void dp_rx_refill_buff_pool_enqueue(struct dp_soc *soc)
 	qdf_nbuf_t nbuf;
 	QDF_STATUS ret;
 	int count, i;
-	uint16_t num_refill;
-	uint16_t total_num_refill;
-	uint16_t total_count = 0;
-	uint16_t head, tail;
+	uint32_t num_refill;
+	uint32_t total_num_refill;
+	uint32_t total_count = 0;
+	uint32_t head, level;
 
 	if (!soc)
 		return;
@@ -137,13 +180,15 @@ void dp_rx_refill_buff_pool_enqueue(struct dp_soc *soc)
 	if (!buff_pool->is_initialized)
 		return;
 
-	head = buff_pool->head;
-	tail = buff_pool->tail;
-	if (tail > head)
-		total_num_refill = (tail - head - 1);
-	else
-		total_num_refill = (DP_RX_REFILL_BUFF_POOL_SIZE - head +
-				    tail - 1);
+	dp_rx_refill_buff_pool_update_target(buff_pool);
+
+	/* only this thread moves head, consumers can only free up slots */
+	head = qdf_atomic_read(&buff_pool->head);
+	level = head - (uint32_t)qdf_atomic_read(&buff_pool->tail);
+	if (level >= buff_pool->target_level)
+		return;
+
+	total_num_refill = buff_pool->target_level - level;
 
 	while (total_num_refill) {
 		if (total_num_refill > DP_RX_REFILL_BUFF_POOL_BURST)
@@ -168,16 +213,21 @@ void dp_rx_refill_buff_pool_enqueue(struct dp_soc *soc)
 				continue;
 			}
 
-			buff_pool->buf_elem[head++] = nbuf;
-			head &= (DP_RX_REFILL_BUFF_POOL_SIZE - 1);
+			buff_pool->buf_elem[head &
+					    (DP_RX_REFILL_BUFF_POOL_SIZE - 1)] =
+									nbuf;
+			head++;
 			count++;
 		}
 
-		if (count) {
-			buff_pool->head = head;
-			total_num_refill -= count;
-			total_count += count;
-		}
+		if (!count)
+			break;
+
+		/* buffers must be visible before they are published */
+		qdf_wmb();
+		qdf_atomic_set(&buff_pool->head, head);
+		total_num_refill -= num_refill;
+		total_count += count;
 	}
 
 	DP_STATS_INC(buff_pool->dp_pdev,
@@ -188,20 +238,31 @@ void dp_rx_refill_buff_pool_enqueue(struct dp_soc *soc)
 static inline qdf_nbuf_t dp_rx_refill_buff_pool_dequeue_nbuf(struct dp_soc *soc)
 {
 	struct rx_refill_buff_pool *buff_pool = &soc->rx_refill_buff_pool;
-	qdf_nbuf_t nbuf = NULL;
-	uint16_t head, tail;
+	qdf_nbuf_t nbuf;
+	int32_t tail, old;
 
-	head = buff_pool->head;
-	tail = buff_pool->tail;
+	tail = qdf_atomic_read(&buff_pool->tail);
 
-	if (head == tail)
-		return NULL;
+	do {
+		if (tail == qdf_atomic_read(&buff_pool->head))
+			return NULL;
 
-	nbuf = buff_pool->buf_elem[tail++];
-	tail &= (DP_RX_REFILL_BUFF_POOL_SIZE - 1);
-	buff_pool->tail = tail;
+		/* pairs with the barrier before head is published */
+		qdf_rmb();
+		nbuf = buff_pool->buf_elem[tail &
+					   (DP_RX_REFILL_BUFF_POOL_SIZE - 1)];
 
-	return nbuf;
+		/*
+		 * The slot cannot be refilled before tail moves past it, so
+		 * nbuf is still ours if nobody else claimed it meanwhile.
+		 */
+		old = qdf_atomic_cmpxchg(&buff_pool->tail, tail,
+					 (int32_t)((uint32_t)tail + 1));
+		if (old == tail)
+			return nbuf;
+
+		tail = old;
+	} while (true);
 }
 
 qdf_nbuf_t
@@ -276,7 +337,7 @@ static void dp_rx_refill_buff_pool_init(struct dp_soc *soc, u8 mac_id)
 	qdf_nbuf_t nbuf;
 	struct rx_refill_buff_pool *buff_pool = &soc->rx_refill_buff_pool;
 	QDF_STATUS ret;
-	uint16_t head = 0;
+	uint32_t head = 0;
 	int i;
 
 	if (!wlan_cfg_is_rx_refill_buffer_pool_enabled(soc->wlan_cfg_ctx)) {
@@ -286,10 +347,14 @@ static void dp_rx_refill_buff_pool_init(struct dp_soc *soc, u8 mac_id)
 	}
 
 	buff_pool->max_bufq_len = DP_RX_REFILL_BUFF_POOL_SIZE;
+	buff_pool->target_level = buff_pool->max_bufq_len;
+	buff_pool->cons_rate = 0;
+	buff_pool->last_tail = 0;
+	buff_pool->last_ts = qdf_get_system_timestamp();
 	buff_pool->dp_pdev = dp_get_pdev_for_lmac_id(soc, 0);
-	buff_pool->tail = 0;
+	qdf_atomic_init(&buff_pool->tail);
 
-	for (i = 0; i < (buff_pool->max_bufq_len - 1); i++) {
+	for (i = 0; i < buff_pool->max_bufq_len; i++) {
 		nbuf = qdf_nbuf_alloc(soc->osdev, rx_desc_pool->buf_size,
 				      RX_BUFFER_RESERVATION,
 				      rx_desc_pool->buf_alignment, FALSE);
@@ -308,11 +373,10 @@ static void dp_rx_refill_buff_pool_init(struct dp_soc *soc, u8 mac_id)
 		head++;
 	}
 
-	buff_pool->head =  head;
+	qdf_atomic_set(&buff_pool->head, head);
 
 	dp_info("RX refill buffer pool required allocation: %u actual allocation: %u",
-		buff_pool->max_bufq_len,
-		buff_pool->head);
+		buff_pool->max_bufq_len, head);
 
 	buff_pool->is_initialized = true;
 }
@@ -373,7 +437,8 @@ static void dp_rx_refill_buff_pool_deinit(struct dp_soc *soc, u8 mac_id)
 	}
 
 	dp_info("Rx refill buffers freed during deinit %u head: %u, tail: %u",
-		count, buff_pool->head, buff_pool->tail);
+		count, (uint32_t)qdf_atomic_read(&buff_pool->head),
+		(uint32_t)qdf_atomic_read(&buff_pool->tail));
 
 	buff_pool->is_initialized = false;
 }
@@ -105,20 +105,17 @@ dp_rx_buffer_pool_nbuf_map(struct dp_soc *soc,
 static inline void dp_rx_schedule_refill_thread(struct dp_soc *soc)
 {
 	struct rx_refill_buff_pool *buff_pool = &soc->rx_refill_buff_pool;
-	uint16_t head = buff_pool->head;
-	uint16_t tail = buff_pool->tail;
-	uint16_t num_refill;
+	uint32_t target = buff_pool->target_level;
+	uint32_t level;
 
 	if (!buff_pool->is_initialized)
 		return;
 
-	if (tail > head)
-		num_refill = (tail - head - 1);
-	else
-		num_refill = (DP_RX_REFILL_BUFF_POOL_SIZE - head + tail - 1);
+	level = (uint32_t)qdf_atomic_read(&buff_pool->head) -
+		(uint32_t)qdf_atomic_read(&buff_pool->tail);
 
 	if (soc->cdp_soc.ol_ops->dp_rx_sched_refill_thread &&
-	    num_refill >= DP_RX_REFILL_THRD_THRESHOLD)
+	    level + (target >> DP_RX_REFILL_THRD_THRESHOLD_SHIFT) <= target)
 		soc->cdp_soc.ol_ops->dp_rx_sched_refill_thread(
 						dp_soc_to_cdp_soc_t(soc));
 }
@@ -6140,6 +6140,22 @@ void dp_print_per_ring_stats(struct dp_soc *soc)
 		DP_PRINT_STATS("Total packets on ring %u: %llu",
 			       ring, total_packets);
 	}
+
+	for (ring = 0; ring < MAX_REO_DEST_RINGS; ring++) {
+		uint64_t time_ns = soc->stats.rx.reap_time_ns[ring];
+		uint64_t msdus = soc->stats.rx.reap_msdus[ring];
+
+		if (!msdus)
+			continue;
+
+		/* qdf_do_div() takes a 32 bit divisor */
+		while (msdus > 0xffffffff) {
+			time_ns >>= 1;
+			msdus >>= 1;
+		}
+		DP_PRINT_STATS("Process time per MSDU on ring %u: %llu ns", ring,
+			       qdf_do_div(time_ns, (uint32_t)msdus));
+	}
 }
 
 void dp_txrx_path_stats(struct dp_soc *soc)
@@ -227,6 +227,23 @@ dp_tx_outstanding_dec(struct dp_pdev *pdev)
 	dp_update_tx_desc_stats(pdev);
 }
 
+/**
+ * dp_tx_outstanding_sub - Decrement outstanding tx desc values by a batch
+ * @pdev: DP pdev handle
+ * @count: number of completed descriptors
+ *
+ * Return: void
+ */
+static inline void
+dp_tx_outstanding_sub(struct dp_pdev *pdev, uint32_t count)
+{
+	struct dp_soc *soc = pdev->soc;
+
+	qdf_atomic_sub(count, &pdev->num_tx_outstanding);
+	qdf_atomic_sub(count, &soc->num_tx_outstanding);
+	dp_update_tx_desc_stats(pdev);
+}
+
 #else //QCA_TX_LIMIT_CHECK
 static inline bool
 dp_tx_limit_check(struct dp_vdev *vdev)
@@ -253,6 +270,13 @@ dp_tx_outstanding_dec(struct dp_pdev *pdev)
 	qdf_atomic_dec(&pdev->num_tx_outstanding);
 	dp_update_tx_desc_stats(pdev);
 }
+
+static inline void
+dp_tx_outstanding_sub(struct dp_pdev *pdev, uint32_t count)
+{
+	qdf_atomic_sub(count, &pdev->num_tx_outstanding);
+	dp_update_tx_desc_stats(pdev);
+}
 #endif //QCA_TX_LIMIT_CHECK
 
 #ifdef WLAN_FEATURE_DP_TX_DESC_HISTORY
@@ -4399,6 +4423,25 @@ void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
 			      tx_status != HAL_TX_TQM_RR_FRAME_ACKED);
 	}
 }
+
+/*
+ * dp_tx_update_peer_basic_stats_bulk(): Update peer basic stats for a batch
+ * @peer: Datapath peer handle
+ * @num: number of completed packets
+ * @bytes: total length of the completed packets
+ * @failed: number of packets not acked
+ *
+ * Return: none
+ */
+static inline void
+dp_tx_update_peer_basic_stats_bulk(struct dp_peer *peer, uint32_t num,
+				   uint32_t bytes, uint32_t failed)
+{
+	if (!peer->hw_txrx_stats_en) {
+		DP_STATS_INC_PKT(peer, tx.comp_pkt, num, bytes);
+		DP_STATS_INC(peer, tx.tx_failed, failed);
+	}
+}
 #elif defined(QCA_VDEV_STATS_HW_OFFLOAD_SUPPORT)
 void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
 				   uint8_t tx_status, bool update)
@@ -4410,6 +4453,16 @@ void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
 	}
 }
 
+static inline void
+dp_tx_update_peer_basic_stats_bulk(struct dp_peer *peer, uint32_t num,
+				   uint32_t bytes, uint32_t failed)
+{
+	if (!peer->hw_txrx_stats_en) {
+		DP_STATS_INC_PKT(peer, tx.comp_pkt, num, bytes);
+		DP_STATS_INC(peer, tx.tx_failed, failed);
+	}
+}
+
 #else
 void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
 				   uint8_t tx_status, bool update)
@@ -4418,8 +4471,102 @@ void dp_tx_update_peer_basic_stats(struct dp_peer *peer, uint32_t length,
 	DP_STATS_INCC(peer, tx.tx_failed, 1,
 		      tx_status != HAL_TX_TQM_RR_FRAME_ACKED);
 }
+
+static inline void
+dp_tx_update_peer_basic_stats_bulk(struct dp_peer *peer, uint32_t num,
+				   uint32_t bytes, uint32_t failed)
+{
+	DP_STATS_INC_PKT(peer, tx.comp_pkt, num, bytes);
+	DP_STATS_INC(peer, tx.tx_failed, failed);
+}
 #endif
 
+#define DP_TX_COMP_PEER_CACHE_SIZE 8
+
+/**
+ * struct dp_tx_comp_peer_cache - per-batch peer lookup and stats cache
+ * @num: number of valid entries
+ * @entry: cached peers
+ * @entry.peer_id: peer id the entry was looked up for
+ * @entry.peer: referenced peer, NULL if the lookup failed
+ * @entry.num: completed simple packets not yet added to peer stats
+ * @entry.bytes: bytes of those packets
+ * @entry.failed: how many of those packets were not acked
+ *
+ * Completions of one reap loop usually belong to a handful of peers, so
+ * peers are referenced once per batch and basic stats are added once per
+ * peer instead of once per packet.
+ */
+struct dp_tx_comp_peer_cache {
+	uint8_t num;
+	struct {
+		uint16_t peer_id;
+		struct dp_peer *peer;
+		uint32_t num;
+		uint32_t bytes;
+		uint32_t failed;
+	} entry[DP_TX_COMP_PEER_CACHE_SIZE];
+};
+
+/**
+ * dp_tx_comp_peer_cache_flush() - add cached stats and release the peers
+ * @cache: peer cache
+ *
+ * Return: none
+ */
+static void dp_tx_comp_peer_cache_flush(struct dp_tx_comp_peer_cache *cache)
+{
+	uint8_t i;
+
+	for (i = 0; i < cache->num; i++) {
+		if (!cache->entry[i].peer)
+			continue;
+
+		if (cache->entry[i].num)
+			dp_tx_update_peer_basic_stats_bulk(
+						cache->entry[i].peer,
+						cache->entry[i].num,
+						cache->entry[i].bytes,
+						cache->entry[i].failed);
+		dp_peer_unref_delete(cache->entry[i].peer, DP_MOD_ID_TX_COMP);
+	}
+	cache->num = 0;
+}
+
+/**
+ * dp_tx_comp_peer_cache_get() - find or add the cache entry of a peer id
+ * @soc: core txrx main context
+ * @cache: peer cache
+ * @peer_id: peer id of the completed descriptor
+ *
+ * Return: index of the entry
+ */
+static inline uint8_t
+dp_tx_comp_peer_cache_get(struct dp_soc *soc,
+			  struct dp_tx_comp_peer_cache *cache,
+			  uint16_t peer_id)
+{
+	uint8_t i;
+
+	for (i = 0; i < cache->num; i++) {
+		if (cache->entry[i].peer_id == peer_id)
+			return i;
+	}
+
+	if (qdf_unlikely(cache->num == DP_TX_COMP_PEER_CACHE_SIZE))
+		dp_tx_comp_peer_cache_flush(cache);
+
+	i = cache->num++;
+	cache->entry[i].peer_id = peer_id;
+	cache->entry[i].peer = dp_peer_get_ref_by_id(soc, peer_id,
+						     DP_MOD_ID_TX_COMP);
+	cache->entry[i].num = 0;
+	cache->entry[i].bytes = 0;
+	cache->entry[i].failed = 0;
+
+	return i;
+}
+
 /**
  * dp_tx_comp_process_desc_list() - Tx complete software descriptor handler
  * @soc: core txrx main context
@@ -4438,31 +4585,39 @@ dp_tx_comp_process_desc_list(struct dp_soc *soc,
 	struct dp_tx_desc_s *desc;
 	struct dp_tx_desc_s *next;
 	struct hal_tx_completion_status ts;
-	struct dp_peer *peer = NULL;
-	uint16_t peer_id = DP_INVALID_PEER;
+	struct dp_tx_comp_peer_cache peer_cache;
+	struct dp_peer *peer;
+	struct dp_pdev *pdev = NULL;
+	uint32_t pdev_done = 0;
+	qdf_nbuf_t nbuf_head = NULL;
+	qdf_nbuf_t nbuf_tail = NULL;
+	uint8_t idx;
 
+	peer_cache.num = 0;
 	desc = comp_head;
 
 	while (desc) {
-		if (peer_id != desc->peer_id) {
-			if (peer)
-				dp_peer_unref_delete(peer,
-						     DP_MOD_ID_TX_COMP);
-			peer_id = desc->peer_id;
-			peer = dp_peer_get_ref_by_id(soc, peer_id,
-						     DP_MOD_ID_TX_COMP);
-		}
+		idx = dp_tx_comp_peer_cache_get(soc, &peer_cache,
+						desc->peer_id);
+		peer = peer_cache.entry[idx].peer;
 
 		if (qdf_likely(desc->flags & DP_TX_DESC_FLAG_SIMPLE)) {
-			struct dp_pdev *pdev = desc->pdev;
+			if (qdf_likely(peer)) {
+				peer_cache.entry[idx].num++;
+				peer_cache.entry[idx].bytes += desc->length;
+				if (desc->tx_status !=
+				    HAL_TX_TQM_RR_FRAME_ACKED)
+					peer_cache.entry[idx].failed++;
+			}
 
-			if (qdf_likely(peer))
-				dp_tx_update_peer_basic_stats(peer,
-							      desc->length,
-							      desc->tx_status,
-							      false);
-			qdf_assert(pdev);
-			dp_tx_outstanding_dec(pdev);
+			qdf_assert(desc->pdev);
+			if (pdev != desc->pdev) {
+				if (pdev_done)
+					dp_tx_outstanding_sub(pdev, pdev_done);
+				pdev = desc->pdev;
+				pdev_done = 0;
+			}
+			pdev_done++;
 
 			/*
 			 * Calling a QDF WRAPPER here is creating signifcant
@@ -4476,7 +4631,15 @@ dp_tx_comp_process_desc_list(struct dp_soc *soc,
 							   desc->dma_addr,
 							   QDF_DMA_TO_DEVICE,
 							   desc->length);
-			qdf_nbuf_free(desc->nbuf);
+
+			/* collect the nbufs and free them in one go below */
+			qdf_nbuf_set_next(desc->nbuf, NULL);
+			if (nbuf_tail)
+				qdf_nbuf_set_next(nbuf_tail, desc->nbuf);
+			else
+				nbuf_head = desc->nbuf;
+			nbuf_tail = desc->nbuf;
+
 			dp_tx_desc_free(soc, desc, desc->pool_id);
 			desc = next;
 			continue;
@@ -4492,8 +4655,12 @@ dp_tx_comp_process_desc_list(struct dp_soc *soc,
 		dp_tx_desc_release(desc, desc->pool_id);
 		desc = next;
 	}
-	if (peer)
-		dp_peer_unref_delete(peer, DP_MOD_ID_TX_COMP);
+
+	if (pdev_done)
+		dp_tx_outstanding_sub(pdev, pdev_done);
+
+	dp_tx_comp_peer_cache_flush(&peer_cache);
+	qdf_nbuf_list_consume(nbuf_head);
 }
 
 #ifdef WLAN_FEATURE_RX_SOFTIRQ_TIME_LIMIT
@@ -62,6 +62,369 @@ dp_tx_desc_pool_counter_initialize(struct dp_tx_desc_pool_s *tx_desc_pool,
 }
 #endif
 
+#ifdef DP_TX_DESC_PCPU_CACHE
+/**
+ * dp_tx_desc_cache_create() - allocate per-CPU descriptor caches
+ * @num_cache: filled with the number of caches allocated
+ *
+ * Return: cache array, NULL on failure
+ */
+static struct dp_tx_desc_cache *dp_tx_desc_cache_create(uint16_t *num_cache)
+{
+	struct dp_tx_desc_cache *cache;
+	uint16_t num = num_possible_cpus();
+	uint16_t i;
+
+	*num_cache = 0;
+	cache = qdf_mem_malloc(num * sizeof(*cache));
+	if (!cache) {
+		dp_err("tx desc cache alloc fail, using pool only");
+		return NULL;
+	}
+
+	for (i = 0; i < num; i++)
+		qdf_spinlock_create(&cache[i].lock);
+
+	*num_cache = num;
+
+	return cache;
+}
+
+/**
+ * dp_tx_desc_cache_destroy() - free per-CPU descriptor caches
+ * @cache: cache array
+ * @num_cache: number of entries in @cache
+ *
+ * Return: None
+ */
+static void dp_tx_desc_cache_destroy(struct dp_tx_desc_cache *cache,
+				     uint16_t num_cache)
+{
+	uint16_t i;
+
+	if (!cache)
+		return;
+
+	for (i = 0; i < num_cache; i++)
+		qdf_spinlock_destroy(&cache[i].lock);
+
+	qdf_mem_free(cache);
+}
+
+/**
+ * dp_tx_desc_cache_reset() - forget cached descriptors of a pool
+ * @cache: cache array
+ * @num_cache: number of entries in @cache
+ *
+ * Only for pool teardown, when no tx or completion can run.
+ *
+ * Return: None
+ */
+static void dp_tx_desc_cache_reset(struct dp_tx_desc_cache *cache,
+				   uint16_t num_cache)
+{
+	uint16_t i;
+
+	if (!cache)
+		return;
+
+	for (i = 0; i < num_cache; i++)
+		cache[i].count = 0;
+}
+
+#define DP_TX_DESC_POOL_CACHE_ATTACH(_pool) \
+	((_pool)->cache = dp_tx_desc_cache_create(&(_pool)->num_cache))
+
+#define DP_TX_DESC_POOL_CACHE_DETACH(_pool) \
+do { \
+	dp_tx_desc_cache_destroy((_pool)->cache, (_pool)->num_cache); \
+	(_pool)->cache = NULL; \
+	(_pool)->num_cache = 0; \
+} while (0)
+
+#define DP_TX_DESC_POOL_CACHE_RESET(_pool) \
+	dp_tx_desc_cache_reset((_pool)->cache, (_pool)->num_cache)
+
+#ifdef QCA_LL_TX_FLOW_CONTROL_V2
+/**
+ * dp_tx_desc_cache_reserve() - descriptors a refill must leave in the pool
+ * @pool: flow pool
+ *
+ * Return: highest stop threshold of the pool
+ */
+#ifdef QCA_AC_BASED_FLOW_CONTROL
+static inline uint16_t dp_tx_desc_cache_reserve(struct dp_tx_desc_pool_s *pool)
+{
+	return pool->stop_th[DP_TH_BE_BK];
+}
+#else
+static inline uint16_t dp_tx_desc_cache_reserve(struct dp_tx_desc_pool_s *pool)
+{
+	return pool->stop_th;
+}
+#endif
+
+void dp_tx_desc_cache_refill(struct dp_tx_desc_pool_s *pool,
+			     struct dp_tx_desc_cache *cache)
+{
+	qdf_spin_lock_bh(&pool->flow_pool_lock);
+	/*
+	 * Never take the pool down to a stop threshold in one batch; the
+	 * last descriptors above it are handed out one by one so that
+	 * dp_tx_is_threshold_reached() sees every value of avail_desc.
+	 */
+	if (pool->status == FLOW_POOL_ACTIVE_UNPAUSED &&
+	    pool->avail_desc > dp_tx_desc_cache_reserve(pool) +
+			       DP_TX_DESC_CACHE_BATCH) {
+		while (cache->count < DP_TX_DESC_CACHE_BATCH)
+			cache->elem[cache->count++] =
+				dp_tx_get_desc_flow_pool(pool);
+	}
+	qdf_spin_unlock_bh(&pool->flow_pool_lock);
+}
+
+void dp_tx_desc_cache_flush(struct dp_tx_desc_pool_s *pool,
+			    struct dp_tx_desc_cache *cache, uint16_t num)
+{
+	qdf_spin_lock_bh(&pool->flow_pool_lock);
+	while (num-- && cache->count)
+		dp_tx_put_desc_flow_pool(pool, cache->elem[--cache->count]);
+	qdf_spin_unlock_bh(&pool->flow_pool_lock);
+}
+
+/**
+ * dp_tx_desc_pool_cache_reclaim() - return cached descriptors to a pool
+ * @soc: Handle to DP SoC structure
+ * @pool_id: pool id
+ *
+ * An unpaused pool only reaches the dp_tx_desc_alloc() slow path once the
+ * caches stop being refilled near the stop threshold. Free descriptors
+ * left in the caches of other CPUs are returned at that point, so that
+ * they count against the threshold instead of idling while the pool runs
+ * into it. Must not be called with the pool lock held.
+ *
+ * Return: None
+ */
+void dp_tx_desc_pool_cache_reclaim(struct dp_soc *soc, uint8_t pool_id)
+{
+	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[pool_id];
+
+	if (pool->status == FLOW_POOL_ACTIVE_UNPAUSED &&
+	    dp_tx_desc_pool_cache_held(pool))
+		dp_tx_desc_pool_cache_drain(soc, pool_id);
+}
+
+/**
+ * dp_tx_desc_pool_cache_attach() - allocate per-CPU caches of a tx pool
+ * @soc: Handle to DP SoC structure
+ * @pool_id: pool id
+ *
+ * Flow pools are created and deleted at runtime, their caches are kept
+ * for the lifetime of the soc instead, see dp_tx_flow_control_deinit().
+ *
+ * Return: None
+ */
+void dp_tx_desc_pool_cache_attach(struct dp_soc *soc, uint8_t pool_id)
+{
+	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[pool_id];
+
+	pool->cache_disabled = false;
+	if (!pool->cache)
+		DP_TX_DESC_POOL_CACHE_ATTACH(pool);
+}
+#else
+void dp_tx_desc_cache_refill(struct dp_tx_desc_pool_s *pool,
+			     struct dp_tx_desc_cache *cache)
+{
+	struct dp_tx_desc_s *tx_desc;
+
+	TX_DESC_LOCK_LOCK(&pool->lock);
+	while (pool->freelist && cache->count < DP_TX_DESC_CACHE_BATCH) {
+		tx_desc = pool->freelist;
+		pool->freelist = tx_desc->next;
+		pool->num_allocated++;
+		pool->num_free--;
+		cache->elem[cache->count++] = tx_desc;
+	}
+	TX_DESC_LOCK_UNLOCK(&pool->lock);
+}
+
+void dp_tx_desc_cache_flush(struct dp_tx_desc_pool_s *pool,
+			    struct dp_tx_desc_cache *cache, uint16_t num)
+{
+	struct dp_tx_desc_s *tx_desc;
+
+	TX_DESC_LOCK_LOCK(&pool->lock);
+	while (num-- && cache->count) {
+		tx_desc = cache->elem[--cache->count];
+		tx_desc->next = pool->freelist;
+		pool->freelist = tx_desc;
+		pool->num_allocated--;
+		pool->num_free++;
+	}
+	TX_DESC_LOCK_UNLOCK(&pool->lock);
+}
+
+void dp_tx_desc_pool_cache_attach(struct dp_soc *soc, uint8_t pool_id)
+{
+	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[pool_id];
+
+	if (!pool->cache)
+		DP_TX_DESC_POOL_CACHE_ATTACH(pool);
+}
+#endif /* QCA_LL_TX_FLOW_CONTROL_V2 */
+
+void dp_tx_desc_pool_cache_detach(struct dp_soc *soc, uint8_t pool_id)
+{
+	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[pool_id];
+
+	DP_TX_DESC_POOL_CACHE_DETACH(pool);
+}
+
+/**
+ * dp_tx_desc_pool_cache_drain() - return all cached descriptors to a pool
+ * @soc: Handle to DP SoC structure
+ * @pool_id: pool id
+ *
+ * Must not be called with the pool lock held.
+ *
+ * Return: None
+ */
+void dp_tx_desc_pool_cache_drain(struct dp_soc *soc, uint8_t pool_id)
+{
+	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[pool_id];
+	struct dp_tx_desc_cache *cache;
+	uint16_t i;
+
+	for (i = 0; i < pool->num_cache; i++) {
+		cache = &pool->cache[i];
+		qdf_spin_lock_bh(&cache->lock);
+		if (cache->count)
+			dp_tx_desc_cache_flush(pool, cache, cache->count);
+		qdf_spin_unlock_bh(&cache->lock);
+	}
+}
+
+/**
+ * dp_tx_desc_pool_cache_held() - count free descriptors cached for a pool
+ * @pool: tx descriptor pool
+ *
+ * The per-CPU counts are read without their locks, so the sum is only a
+ * snapshot; it is used to decide whether a drain is worth it.
+ *
+ * Return: number of descriptors held in the per-CPU caches of @pool
+ */
+uint32_t dp_tx_desc_pool_cache_held(struct dp_tx_desc_pool_s *pool)
+{
+	uint32_t held = 0;
+	uint16_t i;
+
+	for (i = 0; i < pool->num_cache; i++)
+		held += READ_ONCE(pool->cache[i].count);
+
+	return held;
+}
+
+/**
+ * dp_tx_desc_pool_cache_dump() - print per-CPU cache statistics of a pool
+ * @pool: tx descriptor pool
+ *
+ * Return: None
+ */
+void dp_tx_desc_pool_cache_dump(struct dp_tx_desc_pool_s *pool)
+{
+	uint64_t hit = 0, miss = 0, scaled_hit, total;
+	uint32_t cached = 0, rate = 0;
+	uint16_t i;
+
+	for (i = 0; i < pool->num_cache; i++) {
+		hit += pool->cache[i].hit;
+		miss += pool->cache[i].miss;
+		cached += pool->cache[i].count;
+	}
+
+	/* qdf_do_div() takes a 32 bit divisor */
+	scaled_hit = hit;
+	total = hit + miss;
+	while (total > 0xFFFFFFFFULL) {
+		scaled_hit >>= 1;
+		total >>= 1;
+	}
+	if (total)
+		rate = qdf_do_div(scaled_hit * 100, total);
+
+	QDF_TRACE(QDF_MODULE_ID_DP, QDF_TRACE_LEVEL_ERROR,
+		  "Desc cache hit %llu :: miss %llu :: hit rate %u%%",
+		  hit, miss, rate);
+	QDF_TRACE(QDF_MODULE_ID_DP, QDF_TRACE_LEVEL_ERROR,
+		  "Desc cache held %u", cached);
+}
+
+void dp_tx_ext_desc_cache_refill(struct dp_tx_ext_desc_pool_s *pool,
+				 struct dp_tx_desc_cache *cache)
+{
+	struct dp_tx_ext_desc_elem_s *elem;
+
+	qdf_spin_lock_bh(&pool->lock);
+	while (pool->num_free && cache->count < DP_TX_DESC_CACHE_BATCH) {
+		elem = pool->freelist;
+		pool->freelist = elem->next;
+		pool->num_free--;
+		cache->elem[cache->count++] = elem;
+	}
+	qdf_spin_unlock_bh(&pool->lock);
+}
+
+void dp_tx_ext_desc_cache_flush(struct dp_tx_ext_desc_pool_s *pool,
+				struct dp_tx_desc_cache *cache, uint16_t num)
+{
+	struct dp_tx_ext_desc_elem_s *elem;
+
+	qdf_spin_lock_bh(&pool->lock);
+	while (num-- && cache->count) {
+		elem = cache->elem[--cache->count];
+		elem->next = pool->freelist;
+		pool->freelist = elem;
+		pool->num_free++;
+	}
+	qdf_spin_unlock_bh(&pool->lock);
+}
+
+void dp_tx_tso_desc_cache_refill(struct dp_tx_tso_seg_pool_s *pool,
+				 struct dp_tx_desc_cache *cache)
+{
+	struct qdf_tso_seg_elem_t *tso_seg;
+
+	qdf_spin_lock_bh(&pool->lock);
+	while (pool->freelist && cache->count < DP_TX_DESC_CACHE_BATCH) {
+		tso_seg = pool->freelist;
+		pool->freelist = tso_seg->next;
+		pool->num_free--;
+		cache->elem[cache->count++] = tso_seg;
+	}
+	qdf_spin_unlock_bh(&pool->lock);
+}
+
+void dp_tx_tso_desc_cache_flush(struct dp_tx_tso_seg_pool_s *pool,
+				struct dp_tx_desc_cache *cache, uint16_t num)
+{
+	struct qdf_tso_seg_elem_t *tso_seg;
+
+	qdf_spin_lock_bh(&pool->lock);
+	while (num-- && cache->count) {
+		tso_seg = cache->elem[--cache->count];
+		tso_seg->next = pool->freelist;
+		pool->freelist = tso_seg;
+		pool->num_free++;
+	}
+	qdf_spin_unlock_bh(&pool->lock);
+}
+#else
+#define DP_TX_DESC_POOL_CACHE_ATTACH(_pool)
+#define DP_TX_DESC_POOL_CACHE_DETACH(_pool)
+#define DP_TX_DESC_POOL_CACHE_RESET(_pool)
+#endif /* DP_TX_DESC_PCPU_CACHE */
+
 /**
  * dp_tx_desc_pool_alloc() - Allocate Tx Descriptor pool(s)
  * @soc Handle to DP SoC structure
@@ -107,6 +470,7 @@ QDF_STATUS dp_tx_desc_pool_alloc(struct dp_soc *soc, uint8_t pool_id,
 		dp_err("Multi page alloc fail, tx desc");
 		return QDF_STATUS_E_NOMEM;
 	}
+	dp_tx_desc_pool_cache_attach(soc, pool_id);
 	return QDF_STATUS_SUCCESS;
 }
 
@@ -126,6 +490,11 @@ void dp_tx_desc_pool_free(struct dp_soc *soc, uint8_t pool_id)
 		dp_desc_multi_pages_mem_free(soc, DP_TX_DESC_TYPE,
 					     &tx_desc_pool->desc_pages, 0,
 					     true);
+
+	/* flow pools keep their caches until dp_tx_flow_control_deinit() */
+#ifndef QCA_LL_TX_FLOW_CONTROL_V2
+	dp_tx_desc_pool_cache_detach(soc, pool_id);
+#endif
 }
 
 /**
@@ -182,6 +551,7 @@ void dp_tx_desc_pool_deinit(struct dp_soc *soc, uint8_t pool_id)
 
 	tx_desc_pool = &soc->tx_desc[pool_id];
 	soc->arch_ops.dp_tx_desc_pool_deinit(soc, tx_desc_pool, pool_id);
+	DP_TX_DESC_POOL_CACHE_RESET(tx_desc_pool);
 	TX_DESC_POOL_MEMBER_CLEAN(tx_desc_pool);
 	TX_DESC_LOCK_DESTROY(&tx_desc_pool->lock);
 }
@@ -249,6 +619,9 @@ QDF_STATUS dp_tx_ext_desc_pool_alloc(struct dp_soc *soc, uint8_t num_pool,
 		}
 	}
 
+	for (pool_id = 0; pool_id < num_pool; pool_id++)
+		DP_TX_DESC_POOL_CACHE_ATTACH(&soc->tx_ext_desc[pool_id]);
+
 	return status;
 
 free_ext_desc_page:
@@ -387,6 +760,7 @@ void dp_tx_ext_desc_pool_free(struct dp_soc *soc, uint8_t num_pool)
 					soc, DP_TX_EXT_DESC_TYPE,
 					&dp_tx_ext_desc_pool->desc_pages,
 					memctx, false);
+		DP_TX_DESC_POOL_CACHE_DETACH(dp_tx_ext_desc_pool);
 	}
 }
 
@@ -403,6 +777,7 @@ void dp_tx_ext_desc_pool_deinit(struct dp_soc *soc, uint8_t num_pool)
 
 	for (pool_id = 0; pool_id < num_pool; pool_id++) {
 		dp_tx_ext_desc_pool = &((soc)->tx_ext_desc[pool_id]);
+		DP_TX_DESC_POOL_CACHE_RESET(dp_tx_ext_desc_pool);
 		qdf_spinlock_destroy(&dp_tx_ext_desc_pool->lock);
 	}
 }
@@ -439,6 +814,10 @@ QDF_STATUS dp_tx_tso_desc_pool_alloc(struct dp_soc *soc, uint8_t num_pool,
 			goto fail;
 		}
 	}
+
+	for (pool_id = 0; pool_id < num_pool; pool_id++)
+		DP_TX_DESC_POOL_CACHE_ATTACH(&soc->tx_tso_desc[pool_id]);
+
 	return QDF_STATUS_SUCCESS;
 
 fail:
@@ -467,6 +846,7 @@ void dp_tx_tso_desc_pool_free(struct dp_soc *soc, uint8_t num_pool)
 		dp_desc_multi_pages_mem_free(soc, DP_TX_TSO_DESC_TYPE,
 					     &tso_desc_pool->desc_pages,
 					     0, true);
+		DP_TX_DESC_POOL_CACHE_DETACH(tso_desc_pool);
 	}
 }
 
@@ -524,6 +904,7 @@ void dp_tx_tso_desc_pool_deinit(struct dp_soc *soc, uint8_t num_pool)
 
 	for (pool_id = 0; pool_id < num_pool; pool_id++) {
 		tso_desc_pool = &soc->tx_tso_desc[pool_id];
+		DP_TX_DESC_POOL_CACHE_RESET(tso_desc_pool);
 		qdf_spin_lock_bh(&tso_desc_pool->lock);
 
 		tso_desc_pool->freelist = NULL;
@@ -134,6 +134,359 @@ QDF_STATUS dp_tx_tso_num_seg_pool_init(struct dp_soc *soc, uint8_t pool_id,
 void dp_tx_tso_num_seg_pool_free(struct dp_soc *soc, uint8_t pool_id);
 void dp_tx_tso_num_seg_pool_deinit(struct dp_soc *soc, uint8_t pool_id);
 
+#ifdef DP_TX_DESC_PCPU_CACHE
+void dp_tx_desc_pool_cache_attach(struct dp_soc *soc, uint8_t pool_id);
+void dp_tx_desc_pool_cache_detach(struct dp_soc *soc, uint8_t pool_id);
+void dp_tx_desc_pool_cache_drain(struct dp_soc *soc, uint8_t pool_id);
+uint32_t dp_tx_desc_pool_cache_held(struct dp_tx_desc_pool_s *pool);
+void dp_tx_desc_pool_cache_reclaim(struct dp_soc *soc, uint8_t pool_id);
+void dp_tx_desc_pool_cache_dump(struct dp_tx_desc_pool_s *pool);
+void dp_tx_desc_cache_refill(struct dp_tx_desc_pool_s *pool,
+			     struct dp_tx_desc_cache *cache);
+void dp_tx_desc_cache_flush(struct dp_tx_desc_pool_s *pool,
+			    struct dp_tx_desc_cache *cache, uint16_t num);
+void dp_tx_ext_desc_cache_refill(struct dp_tx_ext_desc_pool_s *pool,
+				 struct dp_tx_desc_cache *cache);
+void dp_tx_ext_desc_cache_flush(struct dp_tx_ext_desc_pool_s *pool,
+				struct dp_tx_desc_cache *cache, uint16_t num);
+void dp_tx_tso_desc_cache_refill(struct dp_tx_tso_seg_pool_s *pool,
+				 struct dp_tx_desc_cache *cache);
+void dp_tx_tso_desc_cache_flush(struct dp_tx_tso_seg_pool_s *pool,
+				struct dp_tx_desc_cache *cache, uint16_t num);
+
+/**
+ * dp_tx_desc_cache_get() - get the current CPU's descriptor cache
+ * @cache: per-CPU cache array of a pool
+ * @num_cache: number of entries in @cache
+ *
+ * Return: cache of the current CPU, NULL if the pool has none
+ */
+static inline struct dp_tx_desc_cache *
+dp_tx_desc_cache_get(struct dp_tx_desc_cache *cache, uint16_t num_cache)
+{
+	int cpu = qdf_get_cpu();
+
+	if (qdf_unlikely(!cache || cpu >= num_cache))
+		return NULL;
+
+	return &cache[cpu];
+}
+
+#ifdef QCA_LL_TX_FLOW_CONTROL_V2
+/**
+ * dp_tx_desc_cache_usable() - check if a flow pool may be served from cache
+ * @pool: flow pool
+ *
+ * Only unpaused pools use the caches, and refills stop above the highest
+ * stop threshold, so every threshold crossing still happens one
+ * descriptor at a time under flow_pool_lock. Before a pool pauses, the
+ * descriptors cached by all CPUs are returned to it, see
+ * dp_tx_desc_alloc().
+ *
+ * Return: true if the per-CPU caches may be used
+ */
+static inline bool dp_tx_desc_cache_usable(struct dp_tx_desc_pool_s *pool)
+{
+	return !pool->cache_disabled &&
+	       pool->status == FLOW_POOL_ACTIVE_UNPAUSED;
+}
+#else
+static inline bool dp_tx_desc_cache_usable(struct dp_tx_desc_pool_s *pool)
+{
+	return true;
+}
+#endif
+
+/**
+ * dp_tx_desc_cache_alloc() - allocate a tx descriptor from the CPU cache
+ * @soc: Handle to DP SoC structure
+ * @desc_pool_id: pool to allocate from
+ *
+ * The fast path is not lock-free: it takes the spinlock of the current
+ * CPU's cache, which other CPUs only take while draining the pool, and
+ * the pool lock only once per batch.
+ *
+ * Return: tx descriptor, or NULL if the caller has to use the pool
+ */
+static inline struct dp_tx_desc_s *
+dp_tx_desc_cache_alloc(struct dp_soc *soc, uint8_t desc_pool_id)
+{
+	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[desc_pool_id];
+	struct dp_tx_desc_cache *cache;
+	struct dp_tx_desc_s *tx_desc = NULL;
+
+	cache = dp_tx_desc_cache_get(pool->cache, pool->num_cache);
+	if (!cache)
+		return NULL;
+
+	qdf_spin_lock_bh(&cache->lock);
+	if (qdf_unlikely(!dp_tx_desc_cache_usable(pool))) {
+		/* give cached descriptors back so flow control counts them */
+		if (cache->count)
+			dp_tx_desc_cache_flush(pool, cache, cache->count);
+		cache->miss++;
+		qdf_spin_unlock_bh(&cache->lock);
+		return NULL;
+	}
+
+	if (qdf_likely(cache->count)) {
+		cache->hit++;
+	} else {
+		cache->miss++;
+		dp_tx_desc_cache_refill(pool, cache);
+	}
+
+	if (cache->count) {
+		tx_desc = cache->elem[--cache->count];
+		tx_desc->pool_id = desc_pool_id;
+		tx_desc->flags = DP_TX_DESC_FLAG_ALLOCATED;
+		dp_tx_desc_set_magic(tx_desc, DP_TX_MAGIC_PATTERN_INUSE);
+	}
+	qdf_spin_unlock_bh(&cache->lock);
+
+	return tx_desc;
+}
+
+/**
+ * dp_tx_desc_cache_free() - release a tx descriptor to the CPU cache
+ * @soc: Handle to DP SoC structure
+ * @tx_desc: descriptor to release
+ * @desc_pool_id: pool the descriptor belongs to
+ *
+ * Return: true if the descriptor was cached, false if the caller has to
+ *	   release it to the pool
+ */
+static inline bool
+dp_tx_desc_cache_free(struct dp_soc *soc, struct dp_tx_desc_s *tx_desc,
+		      uint8_t desc_pool_id)
+{
+	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[desc_pool_id];
+	struct dp_tx_desc_cache *cache;
+
+	cache = dp_tx_desc_cache_get(pool->cache, pool->num_cache);
+	if (!cache)
+		return false;
+
+	qdf_spin_lock_bh(&cache->lock);
+	if (qdf_unlikely(!dp_tx_desc_cache_usable(pool))) {
+		if (cache->count)
+			dp_tx_desc_cache_flush(pool, cache, cache->count);
+		qdf_spin_unlock_bh(&cache->lock);
+		return false;
+	}
+
+	if (qdf_unlikely(cache->count == DP_TX_DESC_CACHE_SIZE))
+		dp_tx_desc_cache_flush(pool, cache, DP_TX_DESC_CACHE_BATCH);
+
+	tx_desc->vdev_id = DP_INVALID_VDEV_ID;
+	tx_desc->nbuf = NULL;
+	tx_desc->flags = 0;
+	dp_tx_desc_set_magic(tx_desc, DP_TX_MAGIC_PATTERN_FREE);
+	tx_desc->timestamp = 0;
+	cache->elem[cache->count++] = tx_desc;
+	qdf_spin_unlock_bh(&cache->lock);
+
+	return true;
+}
+
+/**
+ * dp_tx_ext_desc_cache_alloc() - allocate an ext descriptor from CPU cache
+ * @soc: Handle to DP SoC structure
+ * @desc_pool_id: pool to allocate from
+ * @elem: filled with the allocated descriptor
+ *
+ * Return: true if @elem was allocated from the cache
+ */
+static inline bool
+dp_tx_ext_desc_cache_alloc(struct dp_soc *soc, uint8_t desc_pool_id,
+			   struct dp_tx_ext_desc_elem_s **elem)
+{
+	struct dp_tx_ext_desc_pool_s *pool = &soc->tx_ext_desc[desc_pool_id];
+	struct dp_tx_desc_cache *cache;
+
+	cache = dp_tx_desc_cache_get(pool->cache, pool->num_cache);
+	if (!cache)
+		return false;
+
+	qdf_spin_lock_bh(&cache->lock);
+	if (qdf_likely(cache->count)) {
+		cache->hit++;
+	} else {
+		cache->miss++;
+		dp_tx_ext_desc_cache_refill(pool, cache);
+	}
+
+	*elem = cache->count ? cache->elem[--cache->count] : NULL;
+	qdf_spin_unlock_bh(&cache->lock);
+
+	return !!*elem;
+}
+
+/**
+ * dp_tx_ext_desc_cache_free() - release an ext descriptor to the CPU cache
+ * @soc: Handle to DP SoC structure
+ * @elem: descriptor to release
+ * @desc_pool_id: pool the descriptor belongs to
+ *
+ * Return: true if the descriptor was cached
+ */
+static inline bool
+dp_tx_ext_desc_cache_free(struct dp_soc *soc,
+			  struct dp_tx_ext_desc_elem_s *elem,
+			  uint8_t desc_pool_id)
+{
+	struct dp_tx_ext_desc_pool_s *pool = &soc->tx_ext_desc[desc_pool_id];
+	struct dp_tx_desc_cache *cache;
+
+	cache = dp_tx_desc_cache_get(pool->cache, pool->num_cache);
+	if (!cache)
+		return false;
+
+	qdf_spin_lock_bh(&cache->lock);
+	if (qdf_unlikely(cache->count == DP_TX_DESC_CACHE_SIZE))
+		dp_tx_ext_desc_cache_flush(pool, cache, DP_TX_DESC_CACHE_BATCH);
+	cache->elem[cache->count++] = elem;
+	qdf_spin_unlock_bh(&cache->lock);
+
+	return true;
+}
+
+#ifdef FEATURE_TSO
+/**
+ * dp_tx_tso_desc_cache_alloc() - allocate a TSO segment from CPU cache
+ * @soc: Handle to DP SoC structure
+ * @pool_id: pool to allocate from
+ * @tso_seg: filled with the allocated segment
+ *
+ * Return: true if @tso_seg was allocated from the cache
+ */
+static inline bool
+dp_tx_tso_desc_cache_alloc(struct dp_soc *soc, uint8_t pool_id,
+			   struct qdf_tso_seg_elem_t **tso_seg)
+{
+	struct dp_tx_tso_seg_pool_s *pool = &soc->tx_tso_desc[pool_id];
+	struct dp_tx_desc_cache *cache;
+
+	cache = dp_tx_desc_cache_get(pool->cache, pool->num_cache);
+	if (!cache)
+		return false;
+
+	qdf_spin_lock_bh(&cache->lock);
+	if (qdf_likely(cache->count)) {
+		cache->hit++;
+	} else {
+		cache->miss++;
+		dp_tx_tso_desc_cache_refill(pool, cache);
+	}
+
+	*tso_seg = cache->count ? cache->elem[--cache->count] : NULL;
+	qdf_spin_unlock_bh(&cache->lock);
+
+	return !!*tso_seg;
+}
+
+/**
+ * dp_tx_tso_desc_cache_free() - release a TSO segment to the CPU cache
+ * @soc: Handle to DP SoC structure
+ * @pool_id: pool the segment belongs to
+ * @tso_seg: segment to release
+ *
+ * Return: true if the segment was cached
+ */
+static inline bool
+dp_tx_tso_desc_cache_free(struct dp_soc *soc, uint8_t pool_id,
+			  struct qdf_tso_seg_elem_t *tso_seg)
+{
+	struct dp_tx_tso_seg_pool_s *pool = &soc->tx_tso_desc[pool_id];
+	struct dp_tx_desc_cache *cache;
+
+	cache = dp_tx_desc_cache_get(pool->cache, pool->num_cache);
+	if (!cache)
+		return false;
+
+	qdf_spin_lock_bh(&cache->lock);
+	if (qdf_unlikely(cache->count == DP_TX_DESC_CACHE_SIZE))
+		dp_tx_tso_desc_cache_flush(pool, cache, DP_TX_DESC_CACHE_BATCH);
+	cache->elem[cache->count++] = tso_seg;
+	qdf_spin_unlock_bh(&cache->lock);
+
+	return true;
+}
+#endif /* FEATURE_TSO */
+#else
+static inline void
+dp_tx_desc_pool_cache_attach(struct dp_soc *soc, uint8_t pool_id)
+{
+}
+
+static inline void
+dp_tx_desc_pool_cache_detach(struct dp_soc *soc, uint8_t pool_id)
+{
+}
+
+static inline void
+dp_tx_desc_pool_cache_drain(struct dp_soc *soc, uint8_t pool_id)
+{
+}
+
+static inline uint32_t
+dp_tx_desc_pool_cache_held(struct dp_tx_desc_pool_s *pool)
+{
+	return 0;
+}
+
+static inline void
+dp_tx_desc_pool_cache_reclaim(struct dp_soc *soc, uint8_t pool_id)
+{
+}
+
+static inline void dp_tx_desc_pool_cache_dump(struct dp_tx_desc_pool_s *pool)
+{
+}
+
+static inline struct dp_tx_desc_s *
+dp_tx_desc_cache_alloc(struct dp_soc *soc, uint8_t desc_pool_id)
+{
+	return NULL;
+}
+
+static inline bool
+dp_tx_desc_cache_free(struct dp_soc *soc, struct dp_tx_desc_s *tx_desc,
+		      uint8_t desc_pool_id)
+{
+	return false;
+}
+
+static inline bool
+dp_tx_ext_desc_cache_alloc(struct dp_soc *soc, uint8_t desc_pool_id,
+			   struct dp_tx_ext_desc_elem_s **elem)
+{
+	return false;
+}
+
+static inline bool
+dp_tx_ext_desc_cache_free(struct dp_soc *soc,
+			  struct dp_tx_ext_desc_elem_s *elem,
+			  uint8_t desc_pool_id)
+{
+	return false;
+}
+
+static inline bool
+dp_tx_tso_desc_cache_alloc(struct dp_soc *soc, uint8_t pool_id,
+			   struct qdf_tso_seg_elem_t **tso_seg)
+{
+	return false;
+}
+
+static inline bool
+dp_tx_tso_desc_cache_free(struct dp_soc *soc, uint8_t pool_id,
+			  struct qdf_tso_seg_elem_t *tso_seg)
+{
+	return false;
+}
+#endif /* DP_TX_DESC_PCPU_CACHE */
+
 #ifdef QCA_LL_TX_FLOW_CONTROL_V2
 void dp_tx_flow_control_init(struct dp_soc *);
 void dp_tx_flow_control_deinit(struct dp_soc *);
@@ -305,6 +658,13 @@ dp_tx_desc_alloc(struct dp_soc *soc, uint8_t desc_pool_id)
 	enum netif_action_type act = WLAN_NETIF_ACTION_TYPE_NONE;
 	enum dp_fl_ctrl_threshold level = DP_TH_BE_BK;
 	enum netif_reason_type reason;
+	bool drain = false;
+
+	tx_desc = dp_tx_desc_cache_alloc(soc, desc_pool_id);
+	if (tx_desc)
+		return tx_desc;
+
+	dp_tx_desc_pool_cache_reclaim(soc, desc_pool_id);
 
 	if (qdf_likely(pool)) {
 		qdf_spin_lock_bh(&pool->flow_pool_lock);
@@ -333,6 +693,8 @@ dp_tx_desc_alloc(struct dp_soc *soc, uint8_t desc_pool_id)
 					reason = WLAN_DATA_FLOW_CTRL_BE_BK;
 					level = DP_TH_BE_BK;
 					pool->status = FLOW_POOL_BE_BK_PAUSED;
+					/* return descs cached after reclaim */
+					drain = true;
 					break;
 				case FLOW_POOL_BE_BK_PAUSED:
 					/* pause network VI queue */
@@ -376,6 +738,8 @@ dp_tx_desc_alloc(struct dp_soc *soc, uint8_t desc_pool_id)
 			pool->pkt_drop_no_desc++;
 		}
 		qdf_spin_unlock_bh(&pool->flow_pool_lock);
+		if (qdf_unlikely(drain))
+			dp_tx_desc_pool_cache_drain(soc, desc_pool_id);
 	} else {
 		soc->pool_stats.pkt_drop_no_pool++;
 	}
@@ -401,6 +765,9 @@ dp_tx_desc_free(struct dp_soc *soc, struct dp_tx_desc_s *tx_desc,
 	enum netif_action_type act = WLAN_WAKE_ALL_NETIF_QUEUE;
 	enum netif_reason_type reason;
 
+	if (dp_tx_desc_cache_free(soc, tx_desc, desc_pool_id))
+		return;
+
 	qdf_spin_lock_bh(&pool->flow_pool_lock);
 	tx_desc->vdev_id = DP_INVALID_VDEV_ID;
 	tx_desc->nbuf = NULL;
@@ -511,6 +878,16 @@ dp_tx_desc_alloc(struct dp_soc *soc, uint8_t desc_pool_id)
 {
 	struct dp_tx_desc_s *tx_desc = NULL;
 	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[desc_pool_id];
+	bool drain;
+
+	tx_desc = dp_tx_desc_cache_alloc(soc, desc_pool_id);
+	if (tx_desc) {
+		hif_pm_runtime_get_noresume(soc->hif_handle,
+					    RTPM_ID_DP_TX_DESC_ALLOC_FREE);
+		return tx_desc;
+	}
+
+	dp_tx_desc_pool_cache_reclaim(soc, desc_pool_id);
 
 	if (pool) {
 		qdf_spin_lock_bh(&pool->flow_pool_lock);
@@ -522,12 +899,18 @@ dp_tx_desc_alloc(struct dp_soc *soc, uint8_t desc_pool_id)
 			dp_tx_desc_set_magic(tx_desc,
 					     DP_TX_MAGIC_PATTERN_INUSE);
 			if (qdf_unlikely(pool->avail_desc < pool->stop_th)) {
+				drain = pool->status ==
+					FLOW_POOL_ACTIVE_UNPAUSED;
 				pool->status = FLOW_POOL_ACTIVE_PAUSED;
 				qdf_spin_unlock_bh(&pool->flow_pool_lock);
 				/* pause network queues */
 				soc->pause_cb(desc_pool_id,
 					       WLAN_STOP_ALL_NETIF_QUEUE,
 					       WLAN_DATA_FLOW_CONTROL);
+				/* return descs cached after reclaim */
+				if (drain)
+					dp_tx_desc_pool_cache_drain(
+						soc, desc_pool_id);
 			} else {
 				qdf_spin_unlock_bh(&pool->flow_pool_lock);
 			}
@@ -569,6 +952,9 @@ dp_tx_desc_free(struct dp_soc *soc, struct dp_tx_desc_s *tx_desc,
 {
 	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[desc_pool_id];
 
+	if (dp_tx_desc_cache_free(soc, tx_desc, desc_pool_id))
+		goto out;
+
 	qdf_spin_lock_bh(&pool->flow_pool_lock);
 	tx_desc->vdev_id = DP_INVALID_VDEV_ID;
 	tx_desc->nbuf = NULL;
@@ -671,6 +1057,10 @@ static inline struct dp_tx_desc_s *dp_tx_desc_alloc(struct dp_soc *soc,
 	struct dp_tx_desc_s *tx_desc = NULL;
 	struct dp_tx_desc_pool_s *pool = &soc->tx_desc[desc_pool_id];
 
+	tx_desc = dp_tx_desc_cache_alloc(soc, desc_pool_id);
+	if (tx_desc)
+		return tx_desc;
+
 	TX_DESC_LOCK_LOCK(&pool->lock);
 
 	tx_desc = pool->freelist;
@@ -753,6 +1143,10 @@ dp_tx_desc_free(struct dp_soc *soc, struct dp_tx_desc_s *tx_desc,
 		uint8_t desc_pool_id)
 {
 	struct dp_tx_desc_pool_s *pool = NULL;
+
+	if (dp_tx_desc_cache_free(soc, tx_desc, desc_pool_id))
+		return;
+
 	tx_desc->vdev_id = DP_INVALID_VDEV_ID;
 	tx_desc->nbuf = NULL;
 	tx_desc->flags = 0;
@@ -905,6 +1299,9 @@ struct dp_tx_ext_desc_elem_s *dp_tx_ext_desc_alloc(struct dp_soc *soc,
 {
 	struct dp_tx_ext_desc_elem_s *c_elem;
 
+	if (dp_tx_ext_desc_cache_alloc(soc, desc_pool_id, &c_elem))
+		return c_elem;
+
 	qdf_spin_lock_bh(&soc->tx_ext_desc[desc_pool_id].lock);
 	if (soc->tx_ext_desc[desc_pool_id].num_free <= 0) {
 		qdf_spin_unlock_bh(&soc->tx_ext_desc[desc_pool_id].lock);
@@ -929,6 +1326,9 @@ struct dp_tx_ext_desc_elem_s *dp_tx_ext_desc_alloc(struct dp_soc *soc,
 static inline void dp_tx_ext_desc_free(struct dp_soc *soc,
 	struct dp_tx_ext_desc_elem_s *elem, uint8_t desc_pool_id)
 {
+	if (dp_tx_ext_desc_cache_free(soc, elem, desc_pool_id))
+		return;
+
 	qdf_spin_lock_bh(&soc->tx_ext_desc[desc_pool_id].lock);
 	elem->next = soc->tx_ext_desc[desc_pool_id].freelist;
 	soc->tx_ext_desc[desc_pool_id].freelist = elem;
@@ -994,6 +1394,9 @@ static inline struct qdf_tso_seg_elem_t *dp_tx_tso_desc_alloc(
 {
 	struct qdf_tso_seg_elem_t *tso_seg = NULL;
 
+	if (dp_tx_tso_desc_cache_alloc(soc, pool_id, &tso_seg))
+		return tso_seg;
+
 	qdf_spin_lock_bh(&soc->tx_tso_desc[pool_id].lock);
 	if (soc->tx_tso_desc[pool_id].freelist) {
 		soc->tx_tso_desc[pool_id].num_free--;
@@ -1020,6 +1423,9 @@ static inline struct qdf_tso_seg_elem_t *dp_tx_tso_desc_alloc(
 static inline void dp_tx_tso_desc_free(struct dp_soc *soc,
 		uint8_t pool_id, struct qdf_tso_seg_elem_t *tso_seg)
 {
+	if (dp_tx_tso_desc_cache_free(soc, pool_id, tso_seg))
+		return;
+
 	qdf_spin_lock_bh(&soc->tx_tso_desc[pool_id].lock);
 	tso_seg->next = soc->tx_tso_desc[pool_id].freelist;
 	soc->tx_tso_desc[pool_id].freelist = tso_seg;
@@ -204,6 +204,41 @@ dp_tx_flow_ctrl_reset_subqueues(struct dp_soc *soc,
 
 #endif
 
+#ifdef DP_TX_DESC_PCPU_CACHE
+/**
+ * dp_tx_flow_pool_cache_disable() - stop using the per-CPU caches of a pool
+ * @soc: Handle to struct dp_soc
+ * @pool: flow pool, flow_pool_lock held by the caller
+ *
+ * Bypass the caches and return their descriptors so that avail_desc is
+ * exact before the pool is deleted. flow_pool_lock is dropped while the
+ * caches are drained, since cache locks nest outside it.
+ *
+ * Return: true if the pool was attached again in the meantime
+ */
+static bool dp_tx_flow_pool_cache_disable(struct dp_soc *soc,
+					  struct dp_tx_desc_pool_s *pool)
+{
+	pool->cache_disabled = true;
+	qdf_spin_unlock_bh(&pool->flow_pool_lock);
+	dp_tx_desc_pool_cache_drain(soc, pool - soc->tx_desc);
+	qdf_spin_lock_bh(&pool->flow_pool_lock);
+
+	if (qdf_unlikely(pool->pool_create_cnt)) {
+		pool->cache_disabled = false;
+		return true;
+	}
+
+	return false;
+}
+#else
+static inline bool dp_tx_flow_pool_cache_disable(struct dp_soc *soc,
+						 struct dp_tx_desc_pool_s *pool)
+{
+	return false;
+}
+#endif
+
 /**
  * dp_tx_dump_flow_pool_info() - dump global_pool and flow_pool info
  *
@@ -255,6 +290,7 @@ void dp_tx_dump_flow_pool_info(struct cdp_soc_t *soc_hdl)
 		QDF_TRACE(QDF_MODULE_ID_DP, QDF_TRACE_LEVEL_ERROR,
 			"Pkt dropped due to unavailablity of descriptors %d",
 			tmp_pool.pkt_drop_no_desc);
+		dp_tx_desc_pool_cache_dump(pool);
 		qdf_spin_lock_bh(&soc->flow_pool_array_lock);
 	}
 	qdf_spin_unlock_bh(&soc->flow_pool_array_lock);
@@ -417,6 +453,12 @@ int dp_tx_delete_flow_pool(struct dp_soc *soc, struct dp_tx_desc_pool_s *pool,
 		return -EAGAIN;
 	}
 
+	if (dp_tx_flow_pool_cache_disable(soc, pool)) {
+		qdf_spin_unlock_bh(&pool->flow_pool_lock);
+		dp_err("pool reattached while draining desc caches");
+		return -EAGAIN;
+	}
+
 	if (pool->avail_desc < pool->pool_size) {
 		pool_status = pool->status;
 		pool->status = FLOW_POOL_INVALID;
@@ -643,8 +685,13 @@ static inline void dp_tx_desc_pool_dealloc(struct dp_soc *soc)
  */
 void dp_tx_flow_control_deinit(struct dp_soc *soc)
 {
+	int i;
+
 	dp_tx_desc_pool_dealloc(soc);
 
+	for (i = 0; i < MAX_TXDESC_POOLS; i++)
+		dp_tx_desc_pool_cache_detach(soc, i);
+
 	qdf_spinlock_destroy(&soc->flow_pool_array_lock);
 }
 
@@ -27,6 +27,7 @@
 #include <qdf_util.h>
 #include <qdf_list.h>
 #include <qdf_lro.h>
+#include <qdf_rcu.h>
 #include <queue.h>
 #include <htt_common.h>
 #include <htt.h>
@@ -154,7 +155,14 @@
 #ifdef WLAN_FEATURE_RX_PREALLOC_BUFFER_POOL
 #define DP_RX_REFILL_BUFF_POOL_SIZE  2048
 #define DP_RX_REFILL_BUFF_POOL_BURST 64
-#define DP_RX_REFILL_THRD_THRESHOLD  512
+/* refill thread is woken once the pool is a quarter below its target */
+#define DP_RX_REFILL_THRD_THRESHOLD_SHIFT 2
+/* lowest fill level the refill thread keeps the pool at */
+#define DP_RX_REFILL_BUFF_POOL_MIN_LEVEL 256
+/* sampling window of the pool consumption rate, in ms */
+#define DP_RX_REFILL_RATE_WINDOW_MS 10
+/* number of rate windows worth of buffers the pool holds */
+#define DP_RX_REFILL_BUFF_POOL_HEADROOM 4
 #endif
 
 #ifdef WLAN_VENDOR_SPECIFIC_BAR_UPDATE
@@ -503,6 +511,31 @@ struct dp_tx_ext_desc_elem_s {
 	struct qdf_tso_num_seg_elem_t *tso_num_desc;
 };
 
+#ifdef DP_TX_DESC_PCPU_CACHE
+#define DP_TX_DESC_CACHE_SIZE 32
+#define DP_TX_DESC_CACHE_BATCH 16
+
+/**
+ * struct dp_tx_desc_cache - per-CPU cache of free descriptors of one pool
+ * @lock: protects the cache, only contended while a pool is drained
+ * @count: number of descriptors in @elem
+ * @elem: cached free descriptors, used as a stack
+ * @hit: allocations served without touching the pool
+ * @miss: allocations that had to go to the pool
+ *
+ * Descriptors move between the cache and the pool freelist in batches of
+ * DP_TX_DESC_CACHE_BATCH, so the pool lock is taken once per batch rather
+ * than once per packet. Lock order is cache lock -> pool lock.
+ */
+struct dp_tx_desc_cache {
+	qdf_spinlock_t lock;
+	uint16_t count;
+	void *elem[DP_TX_DESC_CACHE_SIZE];
+	uint32_t hit;
+	uint32_t miss;
+};
+#endif
+
 /**
  * struct dp_tx_ext_desc_s - Tx Extension Descriptor Pool
  * @elem_count: Number of descriptors in the pool
@@ -513,6 +546,8 @@ struct dp_tx_ext_desc_elem_s {
  * @link_elem_size: size of the link descriptor in cacheable memory used for
  * 		    chaining the extension descriptors
  * @desc_link_pages: multiple page allocation information for link descriptors
+ * @cache: per-CPU descriptor caches
+ * @num_cache: number of entries in @cache
  */
 struct dp_tx_ext_desc_pool_s {
 	uint16_t elem_count;
@@ -524,6 +559,10 @@ struct dp_tx_ext_desc_pool_s {
 	struct dp_tx_ext_desc_elem_s *freelist;
 	qdf_spinlock_t lock;
 	qdf_dma_mem_context(memctx);
+#ifdef DP_TX_DESC_PCPU_CACHE
+	struct dp_tx_desc_cache *cache;
+	uint16_t num_cache;
+#endif
 };
 
 /**
@@ -623,6 +662,8 @@ enum flow_pool_status {
  * @freelist: first free element pointer
  * @desc_pages: multiple page allocation information for actual descriptors
  * @lock: lock for accessing the pool
+ * @cache: per-CPU descriptor caches
+ * @num_cache: number of entries in @cache
  */
 struct dp_tx_tso_seg_pool_s {
 	uint16_t pool_size;
@@ -630,6 +671,10 @@ struct dp_tx_tso_seg_pool_s {
 	struct qdf_tso_seg_elem_t *freelist;
 	struct qdf_mem_multi_page_t desc_pages;
 	qdf_spinlock_t lock;
+#ifdef DP_TX_DESC_PCPU_CACHE
+	struct dp_tx_desc_cache *cache;
+	uint16_t num_cache;
+#endif
 };
 
 /**
@@ -662,6 +707,9 @@ struct dp_tx_tso_num_seg_pool_s {
  * @flow_pool_array_lock: Lock when operating on flow_pool_array.
  * @flow_pool_array: List of allocated flow pools
  * @lock- Lock for descriptor allocation/free from/to the pool
+ * @cache: per-CPU descriptor caches
+ * @num_cache: number of entries in @cache
+ * @cache_disabled: flow pool is being deleted, bypass the caches
  */
 struct dp_tx_desc_pool_s {
 	uint16_t elem_size;
@@ -693,6 +741,11 @@ struct dp_tx_desc_pool_s {
 	uint32_t num_free;
 	qdf_spinlock_t lock;
 #endif
+#ifdef DP_TX_DESC_PCPU_CACHE
+	struct dp_tx_desc_cache *cache;
+	uint16_t num_cache;
+	bool cache_disabled;
+#endif
 };
 
 /**
@@ -1167,6 +1220,10 @@ struct dp_soc_stats {
 
 		/* packet count per core - per ring */
 		uint64_t ring_packets[NR_CPUS][MAX_REO_DEST_RINGS];
+		/* time in ns spent in the rx process path per REO ring */
+		uint64_t reap_time_ns[MAX_REO_DEST_RINGS];
+		/* MSDUs processed by the rx process path per REO ring */
+		uint64_t reap_msdus[MAX_REO_DEST_RINGS];
 	} rx;
 
 #ifdef WLAN_FEATURE_DP_EVENT_HISTORY
@@ -1260,6 +1317,8 @@ struct dp_ast_entry {
  * @pdev_id: pdev ID
  * @vdev_id: vdev ID
  * @hash_list_elem: node in soc MEC hash list (mac address used as hash)
+ * @free_list_elem: node in the local list of entries pending free
+ * @rcu: head used to free the entry after lock-free readers are done
  */
 struct dp_mec_entry {
 	union dp_align_mac_addr mac_addr;
@@ -1268,6 +1327,8 @@ struct dp_mec_entry {
 	uint8_t vdev_id;
 
 	TAILQ_ENTRY(dp_mec_entry) hash_list_elem;
+	TAILQ_ENTRY(dp_mec_entry) free_list_elem;
+	qdf_rcu_head_t rcu;
 };
 
 /* SOC level htt stats */
@@ -1299,13 +1360,31 @@ struct rx_buff_pool {
 	bool is_initialized;
 };
 
+/**
+ * struct rx_refill_buff_pool - ring of pre-allocated, pre-mapped rx buffers
+ * @is_initialized: pool is usable
+ * @head: free running producer index, moved by the refill thread only
+ * @tail: free running consumer index, moved by the replenish paths with
+ *	  a compare and exchange, so several rings may consume concurrently
+ * @dp_pdev: pdev the pool stats are accounted to
+ * @max_bufq_len: number of slots in @buf_elem
+ * @target_level: fill level the refill thread keeps the pool at
+ * @cons_rate: consumption in buffers per DP_RX_REFILL_RATE_WINDOW_MS
+ * @last_tail: @tail when @cons_rate was last sampled
+ * @last_ts: time @cons_rate was last sampled, in ms
+ * @buf_elem: the buffers, indexed by head/tail modulo the pool size
+ */
 struct rx_refill_buff_pool {
 	bool is_initialized;
-	uint16_t head;
-	uint16_t tail;
+	qdf_atomic_t head;
+	qdf_atomic_t tail;
 	struct dp_pdev *dp_pdev;
 	uint16_t max_bufq_len;
-	qdf_nbuf_t buf_elem[2048];
+	uint16_t target_level;
+	uint32_t cons_rate;
+	uint32_t last_tail;
+	unsigned long last_ts;
+	qdf_nbuf_t buf_elem[DP_RX_REFILL_BUFF_POOL_SIZE];
 };
 
 #ifdef DP_TX_HW_DESC_HISTORY
@@ -1461,6 +1540,42 @@ struct dp_last_op_info {
 
 #ifdef WLAN_DP_FEATURE_SW_LATENCY_MGR
 
+/* Number of flows tracked per TCL ring for coalescing decisions */
+#define DP_SWLM_FLOW_TABLE_SIZE 32
+/* Coalescing depth buckets: 0, 1, 2-3, 4-7, 8-15, 16-31, 32-63, 64+ */
+#define DP_SWLM_DEPTH_HIST_MAX 8
+
+/**
+ * enum dp_swlm_flow_class - traffic class of a flow as seen by SWLM
+ * @DP_SWLM_FLOW_UNKNOWN: not classified yet or mixed traffic, coalescing
+ *			  is decided on the ring throughput alone
+ * @DP_SWLM_FLOW_INTERACTIVE: small packets at a low rate, coalescing is
+ *			      skipped to keep the latency down
+ * @DP_SWLM_FLOW_BULK: large packets at a high rate, coalescing is done
+ *		       more aggressively
+ */
+enum dp_swlm_flow_class {
+	DP_SWLM_FLOW_UNKNOWN,
+	DP_SWLM_FLOW_INTERACTIVE,
+	DP_SWLM_FLOW_BULK,
+};
+
+/**
+ * struct dp_swlm_flow - per flow traffic accounting
+ * @hash: flow hash of the packets accounted in this entry
+ * @flow_class: class decided at the end of the last window
+ * @pkts: packets seen in the current window
+ * @bytes: bytes seen in the current window
+ * @window_end: end timestamp of the current window
+ */
+struct dp_swlm_flow {
+	uint32_t hash;
+	uint8_t flow_class;
+	uint32_t pkts;
+	uint32_t bytes;
+	uint64_t window_end;
+};
+
 /**
  * struct dp_swlm_tcl_data - params for tcl register write coalescing
  *			     descision making
@@ -1482,22 +1597,39 @@ struct dp_swlm_tcl_data {
 	uint32_t pkt_len;
 };
 
+/**
+ * struct dp_swlm_reo_data - params for REO destination ring pointer
+ *			     update coalescing decision making
+ * @ring_id: REO destination ring id
+ * @num_reaped: Num entries reaped in the current ring access
+ */
+struct dp_swlm_reo_data {
+	uint8_t ring_id;
+	uint32_t num_reaped;
+};
+
 /**
  * union swlm_data - SWLM query data
  * @tcl_data: data for TCL query in SWLM
+ * @reo_data: data for REO destination ring query in SWLM
  */
 union swlm_data {
 	struct dp_swlm_tcl_data *tcl_data;
+	struct dp_swlm_reo_data *reo_data;
 };
 
 /**
  * struct dp_swlm_ops - SWLM ops
  * @tcl_wr_coalesce_check: handler to check if the current TCL register
  *			   write can be coalesced or not
+ * @reo_wr_coalesce_check: handler to check if the current REO destination
+ *			   ring pointer update can be coalesced or not
  */
 struct dp_swlm_ops {
 	int (*tcl_wr_coalesce_check)(struct dp_soc *soc,
 				     struct dp_swlm_tcl_data *tcl_data);
+	int (*reo_wr_coalesce_check)(struct dp_soc *soc,
+				     struct dp_swlm_reo_data *reo_data);
 };
 
 /**
@@ -1518,6 +1650,20 @@ struct dp_swlm_ops {
  *			   throughput did not meet session threshold
  * @tcl.coalesce_success: Num of TCL HP writes coalesced successfully.
  * @tcl.coalesce_fail: Num of TCL HP writes coalesces failed
+ * @tcl.interactive_flow: Num TCL register write coalescing skips, since the
+ *			  pkt belonged to an interactive flow
+ * @tcl.bulk_flow: Num TCL HP writes considered with the bulk flow
+ *		   thresholds
+ * @tcl.depth_hist: Num TCL HP writes done, bucketed by the number of
+ *		    writes coalesced into each of them
+ * @reo.coalesce_success: Num REO dst ring TP writes coalesced successfully
+ * @reo.coalesce_fail: Num REO dst ring TP writes not coalesced
+ * @reo.tput_criteria_fail: Num REO dst ring TP writes coalescing fails,
+ *			   since the throughput did not meet the threshold
+ * @reo.entries_thresh_reached: Num REO dst ring TP writes flush after the
+ *				coalesced entries threshold was reached
+ * @reo.depth_hist: Num REO dst ring TP writes done, bucketed by the number
+ *		    of writes coalesced into each of them
  */
 struct dp_swlm_stats {
 	struct {
@@ -1531,7 +1677,17 @@ struct dp_swlm_stats {
 		uint32_t tput_criteria_fail;
 		uint32_t coalesce_success;
 		uint32_t coalesce_fail;
+		uint32_t interactive_flow;
+		uint32_t bulk_flow;
+		uint32_t depth_hist[DP_SWLM_DEPTH_HIST_MAX];
 	} tcl[MAX_TCL_DATA_RINGS];
+	struct {
+		uint32_t coalesce_success;
+		uint32_t coalesce_fail;
+		uint32_t tput_criteria_fail;
+		uint32_t entries_thresh_reached;
+		uint32_t depth_hist[DP_SWLM_DEPTH_HIST_MAX];
+	} reo[MAX_REO_DEST_RINGS];
 };
 
 /**
@@ -1549,6 +1705,8 @@ struct dp_swlm_stats {
  * @prev_rx_bytes: Previous RX bytes accounted
  * @expire_time: expiry time for sample
  * @tput_pass_cnt: threshold throughput pass counter
+ * @depth: Num HP writes coalesced since the last HP write
+ * @flows: Flows recently transmitted on this ring, indexed by flow hash
  */
 struct dp_swlm_tcl_params {
 	struct dp_soc *soc;
@@ -1563,6 +1721,25 @@ struct dp_swlm_tcl_params {
 	uint32_t prev_rx_bytes;
 	uint64_t expire_time;
 	uint32_t tput_pass_cnt;
+	uint32_t depth;
+	struct dp_swlm_flow flows[DP_SWLM_FLOW_TABLE_SIZE];
+};
+
+/**
+ * struct dp_swlm_reo_params: Parameters based on REO destination ring for
+ *			      the Software latency manager.
+ * @prev_rx_bytes: Previous RX bytes accounted
+ * @expire_time: expiry time for sample
+ * @tput_pass_cnt: threshold throughput pass counter
+ * @entries_coalesced: Num entries reaped since the last TP write
+ * @depth: Num TP writes coalesced since the last TP write
+ */
+struct dp_swlm_reo_params {
+	uint32_t prev_rx_bytes;
+	uint64_t expire_time;
+	uint32_t tput_pass_cnt;
+	uint32_t entries_coalesced;
+	uint32_t depth;
 };
 
 /**
@@ -1579,7 +1756,19 @@ struct dp_swlm_tcl_params {
  *			      ending the coalescing.
  * @tx_pkt_thresh: Threshold for TX packet count, to begin TCL register
  *		       write coalescing
+ * @flow_window: Time window over which a flow is classified
+ * @interactive_pkt_len: Max average packet length of an interactive flow
+ * @interactive_pkt_thresh: Max packets in a window of an interactive flow
+ * @bulk_pkt_len: Min average packet length of a bulk flow
+ * @bulk_bytes_thresh: Min bytes in a window of a bulk flow
+ * @bulk_thresh_multiplier: Multiplier applied to the bytes threshold of a
+ *			    coalescing session while a bulk flow transmits
+ * @reo_rx_traffic_thresh: Threshold for RX traffic, to begin REO dst ring
+ *			   TP write coalescing
+ * @reo_entries_flush_thresh: Entries threshold to flush the REO dst ring
+ *			      TP write
  * @tcl: TCL ring specific params
+ * @reo: REO destination ring specific params
  */
 
 struct dp_swlm_params {
@@ -1589,7 +1778,16 @@ struct dp_swlm_params {
 	uint32_t time_flush_thresh;
 	uint32_t tx_thresh_multiplier;
 	uint32_t tx_pkt_thresh;
+	uint32_t flow_window;
+	uint32_t interactive_pkt_len;
+	uint32_t interactive_pkt_thresh;
+	uint32_t bulk_pkt_len;
+	uint32_t bulk_bytes_thresh;
+	uint32_t bulk_thresh_multiplier;
+	uint32_t reo_rx_traffic_thresh;
+	uint32_t reo_entries_flush_thresh;
 	struct dp_swlm_tcl_params tcl[MAX_TCL_DATA_RINGS];
+	struct dp_swlm_reo_params reo[MAX_REO_DEST_RINGS];
 };
 
 /**
@@ -3365,6 +3563,8 @@ struct dp_mld_link_peers {
 struct dp_peer {
 	/* VDEV to which this peer is associated */
 	struct dp_vdev *vdev;
+	/* id of @vdev, for hash lookups which hold no peer reference yet */
+	uint8_t vdev_id;
 
 	struct dp_ast_entry *self_ast_entry;
 
@@ -3379,6 +3579,8 @@ struct dp_peer {
 	TAILQ_ENTRY(dp_peer) peer_list_elem;
 	/* node in the hash table bin's list of peers */
 	TAILQ_ENTRY(dp_peer) hash_list_elem;
+	/* frees the peer once lock-free hash readers are done with it */
+	qdf_rcu_head_t rcu;
 
 	/* TID structures pointer */
 	struct dp_rx_tid *rx_tid;
@@ -3654,6 +3856,11 @@ struct dp_fisa_rx_sw_ft {
 	uint32_t cur_aggr_gso_size;
 	struct udphdr *head_skb_udp_hdr;
 	uint16_t frags_cumulative_len;
+	/* TCP header of the head skb and of the last skb aggregated */
+	struct tcphdr *head_skb_tcp_hdr;
+	struct tcphdr *last_skb_tcp_hdr;
+	/* TCP sequence number expected for the next in-order segment */
+	uint32_t tcp_next_seq;
 	/* CMEM parameters */
 	uint32_t cmem_offset;
 	uint32_t metadata;
@@ -204,10 +204,9 @@ uint32_t dp_rx_process_li(struct dp_intr *int_ctx,
 			  uint32_t quota)
 {
 	hal_ring_desc_t ring_desc;
-	hal_ring_desc_t last_prefetched_hw_desc;
+	struct dp_rx_prefetch_pipe pf_pipe;
 	hal_soc_handle_t hal_soc;
 	struct dp_rx_desc *rx_desc = NULL;
-	struct dp_rx_desc *last_prefetched_sw_desc = NULL;
 	qdf_nbuf_t nbuf, next;
 	bool near_full;
 	union dp_rx_desc_list_elem_t *head[MAX_PDEV_CNT];
@@ -250,6 +249,7 @@ uint32_t dp_rx_process_li(struct dp_intr *int_ctx,
 	uint8_t pkt_capture_offload = 0;
 	int max_reap_limit;
 	uint64_t current_time = 0;
+	uint64_t start_time = qdf_sched_clock();
 
 	DP_HIST_INIT();
 
@@ -302,8 +302,8 @@ more_data:
 	if (num_pending > quota)
 		num_pending = quota;
 
-	last_prefetched_hw_desc = dp_srng_dst_prefetch(hal_soc, hal_ring_hdl,
-						       num_pending);
+	dp_rx_prefetch_pipe_init(soc, &pf_pipe, hal_soc, hal_ring_hdl,
+				 num_pending);
 
 	/*
 	 * start reaping the buffers from reo ring and queue
@@ -514,6 +514,7 @@ more_data:
 					     rx_desc_pool->buf_size);
 		rx_desc->unmapped = 1;
 		dp_ipa_reo_ctx_buf_mapping_unlock(soc, reo_ring_num);
+		dp_rx_prefetch_pkt_tlvs(rx_desc->nbuf);
 		DP_RX_PROCESS_NBUF(soc, nbuf_head, nbuf_tail, ebuf_head,
 				   ebuf_tail, rx_desc);
 		/*
@@ -530,10 +531,7 @@ more_data:
 					    &tail[rx_desc->pool_id], rx_desc);
 		num_rx_bufs_reaped++;
 
-		dp_rx_prefetch_hw_sw_nbuf_desc(soc, hal_soc, num_pending,
-					       hal_ring_hdl,
-					       &last_prefetched_hw_desc,
-					       &last_prefetched_sw_desc);
+		dp_rx_prefetch_pipe_step(soc, &pf_pipe, hal_ring_hdl);
 
 		/*
 		 * only if complete msdu is received for scatter case,
@@ -545,7 +543,10 @@ more_data:
 			break;
 	}
 done:
-	dp_rx_srng_access_end(int_ctx, soc, hal_ring_hdl);
+	if (dp_rx_attempt_coalescing(soc, reo_ring_num, num_rx_bufs_reaped))
+		dp_rx_srng_access_end_reap(int_ctx, soc, hal_ring_hdl);
+	else
+		dp_rx_srng_access_end(int_ctx, soc, hal_ring_hdl);
 
 	DP_STATS_INCC(soc,
 		      rx.ring_packets[qdf_get_smp_processor_id()][reo_ring_num],
@@ -979,6 +980,12 @@ done:
 	/* Update histogram statistics by looping through pdev's */
 	DP_RX_HIST_STATS_PER_PDEV();
 
+	if (qdf_likely(rx_bufs_used)) {
+		DP_STATS_INC(soc, rx.reap_time_ns[reo_ring_num],
+			     qdf_sched_clock() - start_time);
+		DP_STATS_INC(soc, rx.reap_msdus[reo_ring_num], rx_bufs_used);
+	}
+
 	return rx_bufs_used; /* Assume no scale factor for now */
 }
 
@@ -131,7 +131,38 @@ void dp_rx_prefetch_nbuf_data(qdf_nbuf_t nbuf, qdf_nbuf_t next)
 }
 #endif
 
+/**
+ * struct dp_rx_prefetch_pipe - REO destination ring reap prefetch pipeline
+ * @hw_desc: ring entry prefetched in the previous step
+ * @next_hw_desc: next ring entry to prefetch
+ * @hw_left: valid ring entries not prefetched yet
+ * @rx_desc: SW desc prefetched in the previous step
+ *
+ * While the reap loop processes ring entry N, entry N + k is prefetched
+ * from the ring, the SW desc of entry N + k - 1 and the nbuf of entry
+ * N + k - 2. Each stage only dereferences what the previous stage
+ * prefetched one step earlier, so none of the loads in the pipeline or in
+ * the reap loop waits on memory.
+ *
+ * The packet TLVs are not part of the pipeline: on targets without
+ * coherent DMA the unmap of the buffer invalidates its lines, which would
+ * drop anything prefetched before it. They are prefetched by
+ * dp_rx_prefetch_pkt_tlvs() once the buffer is unmapped.
+ */
+struct dp_rx_prefetch_pipe {
+	uint8_t *hw_desc;
+	uint8_t *next_hw_desc;
+	uint32_t hw_left;
+	struct dp_rx_desc *rx_desc;
+};
+
 #ifdef QCA_DP_RX_HW_SW_NBUF_DESC_PREFETCH
+/* Prefetch distance of the reap pipeline, in ring entries */
+#define DP_RX_PREFETCH_DEPTH_MIN 4
+#define DP_RX_PREFETCH_DEPTH_MAX 8
+/* log2 of the pending entries per entry of prefetch distance */
+#define DP_RX_PREFETCH_DEPTH_SHIFT 3
+
 /**
  * dp_rx_cookie_2_va_rxdma_buf_prefetch() - function to prefetch the SW desc
  * @soc: Handle to DP Soc structure
@@ -161,43 +192,119 @@ void *dp_rx_cookie_2_va_rxdma_buf_prefetch(struct dp_soc *soc, uint32_t cookie)
 }
 
 /**
- * dp_rx_prefetch_hw_sw_nbuf_desc() - function to prefetch HW and SW desc
- * @soc: Handle to HAL Soc structure
- * @num_entries: valid number of HW descriptors
- * @hal_ring_hdl: Destination ring pointer
- * @last_prefetched_hw_desc: pointer to the last prefetched HW descriptor
- * @last_prefetched_sw_desc: input & output param of last prefetch SW desc
+ * dp_rx_prefetch_pipe_step() - advance the reap prefetch pipeline by one
+ * @soc: Handle to DP Soc structure
+ * @pipe: prefetch pipeline
+ * @hal_ring_hdl: REO destination ring
  *
  * Return: None
  */
 static inline
-void dp_rx_prefetch_hw_sw_nbuf_desc(struct dp_soc *soc,
-				    hal_soc_handle_t hal_soc,
-				    uint32_t num_entries,
-				    hal_ring_handle_t hal_ring_hdl,
-				    hal_ring_desc_t *last_prefetched_hw_desc,
-				    struct dp_rx_desc **last_prefetched_sw_desc)
+void dp_rx_prefetch_pipe_step(struct dp_soc *soc,
+			      struct dp_rx_prefetch_pipe *pipe,
+			      hal_ring_handle_t hal_ring_hdl)
 {
-	if (*last_prefetched_sw_desc) {
-		qdf_prefetch((uint8_t *)(*last_prefetched_sw_desc)->nbuf);
-		qdf_prefetch((uint8_t *)(*last_prefetched_sw_desc)->nbuf + 64);
+	struct dp_rx_desc *rx_desc;
+
+	/* nbuf of the SW desc prefetched in the previous step */
+	rx_desc = pipe->rx_desc;
+	if (rx_desc && rx_desc->nbuf) {
+		qdf_prefetch((uint8_t *)rx_desc->nbuf);
+		qdf_prefetch((uint8_t *)rx_desc->nbuf + 64);
 	}
 
-	if (num_entries) {
-		*last_prefetched_sw_desc = dp_rx_cookie_2_va_rxdma_buf_prefetch(soc, HAL_RX_REO_BUF_COOKIE_GET(*last_prefetched_hw_desc));
-		*last_prefetched_hw_desc = hal_srng_dst_prefetch_next_cached_desc(hal_soc,
-										  hal_ring_hdl,
-										  (uint8_t *)*last_prefetched_hw_desc);
+	/* SW desc of the ring entry prefetched in the previous step */
+	if (pipe->hw_desc)
+		pipe->rx_desc = dp_rx_cookie_2_va_rxdma_buf_prefetch(
+				soc, HAL_RX_REO_BUF_COOKIE_GET(pipe->hw_desc));
+	else
+		pipe->rx_desc = NULL;
+
+	if (!pipe->hw_left) {
+		pipe->hw_desc = NULL;
+		return;
 	}
+
+	pipe->hw_desc = pipe->next_hw_desc;
+	qdf_prefetch(pipe->hw_desc);
+	pipe->next_hw_desc = hal_srng_dst_desc_next(hal_ring_hdl,
+						    pipe->hw_desc);
+	pipe->hw_left--;
+}
+
+/**
+ * dp_rx_prefetch_pipe_init() - fill the reap prefetch pipeline
+ * @soc: Handle to DP Soc structure
+ * @pipe: prefetch pipeline
+ * @hal_soc: HAL soc handle
+ * @hal_ring_hdl: REO destination ring, access already started
+ * @num_pending: pending ring entries to be reaped
+ *
+ * The prefetch distance grows with the ring occupancy: with few pending
+ * entries a deep pipeline only pulls in lines the loop never reaches,
+ * while a backed up ring gives the loads more time to complete.
+ *
+ * Return: None
+ */
+static inline
+void dp_rx_prefetch_pipe_init(struct dp_soc *soc,
+			      struct dp_rx_prefetch_pipe *pipe,
+			      hal_soc_handle_t hal_soc,
+			      hal_ring_handle_t hal_ring_hdl,
+			      uint32_t num_pending)
+{
+	uint32_t depth = num_pending >> DP_RX_PREFETCH_DEPTH_SHIFT;
+
+	if (depth < DP_RX_PREFETCH_DEPTH_MIN)
+		depth = DP_RX_PREFETCH_DEPTH_MIN;
+	else if (depth > DP_RX_PREFETCH_DEPTH_MAX)
+		depth = DP_RX_PREFETCH_DEPTH_MAX;
+
+	qdf_mem_zero(pipe, sizeof(*pipe));
+	pipe->next_hw_desc = hal_srng_dst_peek(hal_soc, hal_ring_hdl);
+	if (pipe->next_hw_desc)
+		pipe->hw_left = hal_srng_dst_num_valid(hal_soc,
+						       hal_ring_hdl, 0);
+
+	while (depth--)
+		dp_rx_prefetch_pipe_step(soc, pipe, hal_ring_hdl);
+}
+
+/**
+ * dp_rx_prefetch_pkt_tlvs() - prefetch the rx TLVs of a reaped buffer
+ * @nbuf: buffer already unmapped from the device
+ *
+ * The TLVs are first read by the delivery loop, after the whole reap
+ * round, so the prefetch has the rest of the round to complete.
+ *
+ * Return: None
+ */
+static inline void dp_rx_prefetch_pkt_tlvs(qdf_nbuf_t nbuf)
+{
+	struct rx_pkt_tlvs *pkt_tlvs;
+
+	pkt_tlvs = (struct rx_pkt_tlvs *)qdf_nbuf_data(nbuf);
+	qdf_prefetch(pkt_tlvs);
+	qdf_prefetch(&pkt_tlvs->attn_tlv);
 }
 #else
 static inline
-void dp_rx_prefetch_hw_sw_nbuf_desc(struct dp_soc *soc,
-				    hal_soc_handle_t hal_soc,
-				    uint32_t quota,
-				    hal_ring_handle_t hal_ring_hdl,
-				    hal_ring_desc_t *last_prefetched_hw_desc,
-				    struct dp_rx_desc **last_prefetched_sw_desc)
+void dp_rx_prefetch_pipe_step(struct dp_soc *soc,
+			      struct dp_rx_prefetch_pipe *pipe,
+			      hal_ring_handle_t hal_ring_hdl)
+{
+}
+
+static inline
+void dp_rx_prefetch_pipe_init(struct dp_soc *soc,
+			      struct dp_rx_prefetch_pipe *pipe,
+			      hal_soc_handle_t hal_soc,
+			      hal_ring_handle_t hal_ring_hdl,
+			      uint32_t num_pending)
+{
+}
+
+static inline void dp_rx_prefetch_pkt_tlvs(qdf_nbuf_t nbuf)
 {
 }
 #endif
@@ -3022,6 +3022,25 @@ void *hal_srng_dst_prefetch(hal_soc_handle_t hal_soc_hdl,
 	return (void *)desc;
 }
 
+/**
+ * hal_srng_dst_desc_next() - destination ring entry following a given one
+ * @hal_ring_hdl: Destination ring pointer
+ * @desc: ring entry
+ *
+ * Return: next ring entry, wrapping around at the end of the ring
+ */
+static inline
+void *hal_srng_dst_desc_next(hal_ring_handle_t hal_ring_hdl, void *desc)
+{
+	struct hal_srng *srng = (struct hal_srng *)hal_ring_hdl;
+	uint32_t *next = (uint32_t *)desc + srng->entry_size;
+
+	if (next == srng->ring_vaddr_end)
+		next = srng->ring_base_vaddr;
+
+	return next;
+}
+
 /**
  * hal_srng_dst_prefetch_next_cached_desc() - function to prefetch next desc
  * @hal_soc_hdl: HAL SOC handle
@@ -1175,6 +1175,10 @@ struct hal_soc {
 #endif
 	/* flag to indicate cmn dmac rings in berryllium */
 	bool dmac_cmn_src_rxbuf_ring;
+#ifdef HAL_SRNG_SIM
+	/* software model standing in for the HW side of the SRNGs */
+	struct hal_srng_sim *srng_sim;
+#endif
 };
 
 #if defined(FEATURE_HAL_DELAYED_REG_WRITE)
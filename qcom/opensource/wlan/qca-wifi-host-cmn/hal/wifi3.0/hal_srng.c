@@ -23,6 +23,7 @@
 #include "target_type.h"
 #include "qdf_module.h"
 #include "wcss_version.h"
+#include "hal_srng_sim.h"
 #include <qdf_tracepoint.h>
 
 struct tcl_data_cmd gtcl_data_symbol __attribute__((used));
@@ -1114,6 +1115,11 @@ void *hal_attach(struct hif_opaque_softc *hif_handle, qdf_device_t qdf_dev)
 		goto fail3;
 	}
 
+	if (QDF_IS_STATUS_ERROR(hal_srng_sim_attach(hal))) {
+		hal_err("unable to attach SRNG simulator");
+		goto fail4;
+	}
+
 	hal_target_based_configure(hal);
 
 	hal_reg_write_fail_history_init(hal);
@@ -1124,6 +1130,8 @@ void *hal_attach(struct hif_opaque_softc *hif_handle, qdf_device_t qdf_dev)
 	hal_delayed_reg_write_init(hal);
 
 	return (void *)hal;
+fail4:
+	qdf_mem_free(hal->ops);
 fail3:
 	qdf_mem_free_consistent(qdf_dev, qdf_dev->dev,
 				sizeof(*hal->shadow_wrptr_mem_vaddr) *
@@ -1178,6 +1186,7 @@ extern void hal_detach(void *hal_soc)
 	struct hal_soc *hal = (struct hal_soc *)hal_soc;
 
 	hal_delayed_reg_write_deinit(hal);
+	hal_srng_sim_detach(hal);
 	qdf_mem_free(hal->ops);
 
 	qdf_mem_free_consistent(hal->qdf_dev, hal->qdf_dev->dev,
@@ -1596,6 +1605,13 @@ void *hal_srng_setup(void *hal_soc, int ring_type, int ring_num,
 				&(hal->shadow_wrptr_mem_vaddr[ring_id -
 					HAL_SRNG_LMAC1_ID_START]);
 			srng->flags |= HAL_SRNG_LMAC_RING;
+		} else if (hal_srng_sim_enabled()) {
+			/* Simulated ring, head pointer lives in host memory
+			 * and is updated the same way as for LMAC rings
+			 */
+			srng->u.src_ring.hp_addr =
+				hal_srng_sim_ptr_init(hal, srng);
+			srng->flags |= HAL_SRNG_LMAC_RING;
 		} else if (ignore_shadow || (srng->u.src_ring.hp_addr == 0)) {
 			srng->u.src_ring.hp_addr =
 				hal_get_window_address(hal,
@@ -1634,6 +1650,10 @@ void *hal_srng_setup(void *hal_soc, int ring_type, int ring_num,
 				&(hal->shadow_wrptr_mem_vaddr[ring_id -
 				HAL_SRNG_LMAC1_ID_START]);
 			srng->flags |= HAL_SRNG_LMAC_RING;
+		} else if (hal_srng_sim_enabled()) {
+			srng->u.dst_ring.tp_addr =
+				hal_srng_sim_ptr_init(hal, srng);
+			srng->flags |= HAL_SRNG_LMAC_RING;
 		} else if (ignore_shadow || srng->u.dst_ring.tp_addr == 0) {
 			srng->u.dst_ring.tp_addr =
 				hal_get_window_address(hal,
@@ -1652,7 +1672,7 @@ void *hal_srng_setup(void *hal_soc, int ring_type, int ring_num,
 		}
 	}
 
-	if (!(ring_config->lmac_ring)) {
+	if (!(ring_config->lmac_ring) && !hal_srng_sim_enabled()) {
 		hal_srng_hw_init(hal, srng);
 
 		if (ring_type == CE_DST) {
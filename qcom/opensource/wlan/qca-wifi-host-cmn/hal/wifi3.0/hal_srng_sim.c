@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "hal_api.h"
+#include "hal_srng_sim.h"
+#include "qdf_module.h"
+#include "qdf_threads.h"
+
+/**
+ * struct hal_srng_sim_ring - simulator state of one ring
+ * @ops: hardware model, NULL if the ring is not modelled
+ * @ctx: context of @ops
+ * @budget: max entries moved per pass
+ * @stats: counters
+ */
+struct hal_srng_sim_ring {
+	const struct hal_srng_sim_ops *ops;
+	void *ctx;
+	uint32_t budget;
+	struct hal_srng_sim_ring_stats stats;
+};
+
+/**
+ * struct hal_srng_sim - SRNG simulator of a HAL soc
+ * @sw_ptr: host memory standing in for the HP/TP registers SW writes
+ * @ring: per ring model, indexed by ring id
+ * @thread: simulator thread, NULL when stopped
+ */
+struct hal_srng_sim {
+	uint32_t sw_ptr[HAL_SRNG_ID_MAX];
+	struct hal_srng_sim_ring ring[HAL_SRNG_ID_MAX];
+	qdf_thread_t *thread;
+};
+
+QDF_STATUS hal_srng_sim_attach(struct hal_soc *hal)
+{
+	hal->srng_sim = qdf_mem_malloc(sizeof(*hal->srng_sim));
+	if (!hal->srng_sim)
+		return QDF_STATUS_E_NOMEM;
+
+	hal_info("SRNG simulator attached");
+
+	return QDF_STATUS_SUCCESS;
+}
+
+void hal_srng_sim_detach(struct hal_soc *hal)
+{
+	if (!hal->srng_sim)
+		return;
+
+	hal_srng_sim_stop(hal_soc_to_hal_soc_handle(hal));
+	qdf_mem_free(hal->srng_sim);
+	hal->srng_sim = NULL;
+}
+
+uint32_t *hal_srng_sim_ptr_init(struct hal_soc *hal, struct hal_srng *srng)
+{
+	hal->srng_sim->sw_ptr[srng->ring_id] = 0;
+	hal->shadow_rdptr_mem_vaddr[srng->ring_id] = 0;
+
+	return &hal->srng_sim->sw_ptr[srng->ring_id];
+}
+
+/**
+ * hal_srng_sim_produce() - emulate the HW block filling a destination ring
+ * @srng: destination ring
+ * @sim_ring: model of the ring
+ *
+ * Entries are written at the HW head pointer for as long as the ring is
+ * not full, and then published at once by moving the head pointer SW
+ * reads in hal_srng_access_start().
+ *
+ * Return: number of entries produced
+ */
+static uint32_t hal_srng_sim_produce(struct hal_srng *srng,
+				     struct hal_srng_sim_ring *sim_ring)
+{
+	hal_ring_handle_t hal_ring_hdl = (hal_ring_handle_t)srng;
+	uint32_t hp = *(volatile uint32_t *)srng->u.dst_ring.hp_addr;
+	uint32_t tp = qdf_le32_to_cpu(*(volatile uint32_t *)
+				      srng->u.dst_ring.tp_addr);
+	uint32_t next_hp;
+	uint32_t num = 0;
+
+	while (num < sim_ring->budget) {
+		next_hp = hp + srng->entry_size;
+		if (next_hp == srng->ring_size)
+			next_hp = 0;
+
+		if (next_hp == tp) {
+			sim_ring->stats.full++;
+			break;
+		}
+
+		if (!sim_ring->ops->produce(sim_ring->ctx, hal_ring_hdl,
+					    &srng->ring_base_vaddr[hp])) {
+			sim_ring->stats.stalls++;
+			break;
+		}
+
+		hp = next_hp;
+		num++;
+	}
+
+	if (!num)
+		return 0;
+
+	/* descriptors must be visible before the head pointer moves */
+	qdf_wmb();
+	*(volatile uint32_t *)srng->u.dst_ring.hp_addr = hp;
+
+	return num;
+}
+
+/**
+ * hal_srng_sim_consume() - emulate the HW block draining a source ring
+ * @srng: source ring
+ * @sim_ring: model of the ring
+ *
+ * Entries posted by SW up to the head pointer it last wrote in
+ * hal_srng_access_end() are handed to the model, and the tail pointer SW
+ * reads back is moved past the ones it accepted.
+ *
+ * Return: number of entries consumed
+ */
+static uint32_t hal_srng_sim_consume(struct hal_srng *srng,
+				     struct hal_srng_sim_ring *sim_ring)
+{
+	hal_ring_handle_t hal_ring_hdl = (hal_ring_handle_t)srng;
+	uint32_t tp = *(volatile uint32_t *)srng->u.src_ring.tp_addr;
+	uint32_t hp = qdf_le32_to_cpu(*(volatile uint32_t *)
+				      srng->u.src_ring.hp_addr);
+	uint32_t num = 0;
+
+	/* pairs with the barrier before the SW head pointer update */
+	qdf_rmb();
+
+	while (tp != hp && num < sim_ring->budget) {
+		if (!sim_ring->ops->consume(sim_ring->ctx, hal_ring_hdl,
+					    &srng->ring_base_vaddr[tp])) {
+			sim_ring->stats.stalls++;
+			break;
+		}
+
+		tp += srng->entry_size;
+		if (tp == srng->ring_size)
+			tp = 0;
+		num++;
+	}
+
+	if (!num)
+		return 0;
+
+	qdf_mb();
+	*(volatile uint32_t *)srng->u.src_ring.tp_addr = tp;
+
+	return num;
+}
+
+uint32_t hal_srng_sim_run_once(hal_soc_handle_t hal_soc_hdl)
+{
+	struct hal_soc *hal = (struct hal_soc *)hal_soc_hdl;
+	struct hal_srng_sim_ring *sim_ring;
+	struct hal_srng *srng;
+	uint32_t total = 0;
+	uint32_t num;
+	int i;
+
+	for (i = 0; i < HAL_SRNG_ID_MAX; i++) {
+		sim_ring = &hal->srng_sim->ring[i];
+		srng = &hal->srng_list[i];
+
+		if (!sim_ring->ops || !srng->initialized)
+			continue;
+
+		if (srng->ring_dir == HAL_SRNG_SRC_RING)
+			num = hal_srng_sim_consume(srng, sim_ring);
+		else
+			num = hal_srng_sim_produce(srng, sim_ring);
+
+		if (!num)
+			continue;
+
+		sim_ring->stats.entries += num;
+		sim_ring->stats.passes++;
+		total += num;
+
+		if (sim_ring->ops->notify)
+			sim_ring->ops->notify(sim_ring->ctx,
+					      (hal_ring_handle_t)srng);
+	}
+
+	return total;
+}
+
+qdf_export_symbol(hal_srng_sim_run_once);
+
+/**
+ * hal_srng_sim_thread() - simulator thread
+ * @context: HAL soc
+ *
+ * Return: QDF_STATUS_SUCCESS
+ */
+static QDF_STATUS hal_srng_sim_thread(void *context)
+{
+	hal_soc_handle_t hal_soc_hdl = context;
+
+	while (!qdf_thread_should_stop()) {
+		hal_srng_sim_run_once(hal_soc_hdl);
+		qdf_sleep_us(HAL_SRNG_SIM_INTERVAL_US);
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
+QDF_STATUS hal_srng_sim_register(hal_soc_handle_t hal_soc_hdl,
+				 hal_ring_handle_t hal_ring_hdl,
+				 const struct hal_srng_sim_ops *ops,
+				 void *ctx, uint32_t budget)
+{
+	struct hal_soc *hal = (struct hal_soc *)hal_soc_hdl;
+	struct hal_srng *srng = (struct hal_srng *)hal_ring_hdl;
+	struct hal_srng_sim_ring *sim_ring;
+
+	if (hal->srng_sim->thread)
+		return QDF_STATUS_E_BUSY;
+
+	if (srng->ring_dir == HAL_SRNG_SRC_RING ? !ops->consume :
+						  !ops->produce)
+		return QDF_STATUS_E_INVAL;
+
+	sim_ring = &hal->srng_sim->ring[srng->ring_id];
+	qdf_mem_zero(sim_ring, sizeof(*sim_ring));
+	sim_ring->ops = ops;
+	sim_ring->ctx = ctx;
+	sim_ring->budget = budget ? budget : HAL_SRNG_SIM_DEFAULT_BUDGET;
+
+	return QDF_STATUS_SUCCESS;
+}
+
+qdf_export_symbol(hal_srng_sim_register);
+
+void hal_srng_sim_unregister(hal_soc_handle_t hal_soc_hdl,
+			     hal_ring_handle_t hal_ring_hdl)
+{
+	struct hal_soc *hal = (struct hal_soc *)hal_soc_hdl;
+	struct hal_srng *srng = (struct hal_srng *)hal_ring_hdl;
+
+	qdf_assert_always(!hal->srng_sim->thread);
+	hal->srng_sim->ring[srng->ring_id].ops = NULL;
+}
+
+qdf_export_symbol(hal_srng_sim_unregister);
+
+QDF_STATUS hal_srng_sim_start(hal_soc_handle_t hal_soc_hdl)
+{
+	struct hal_soc *hal = (struct hal_soc *)hal_soc_hdl;
+
+	if (hal->srng_sim->thread)
+		return QDF_STATUS_E_ALREADY;
+
+	hal->srng_sim->thread = qdf_thread_run(hal_srng_sim_thread, hal);
+	if (!hal->srng_sim->thread)
+		return QDF_STATUS_E_FAILURE;
+
+	return QDF_STATUS_SUCCESS;
+}
+
+qdf_export_symbol(hal_srng_sim_start);
+
+void hal_srng_sim_stop(hal_soc_handle_t hal_soc_hdl)
+{
+	struct hal_soc *hal = (struct hal_soc *)hal_soc_hdl;
+
+	if (!hal->srng_sim->thread)
+		return;
+
+	qdf_thread_join(hal->srng_sim->thread);
+	hal->srng_sim->thread = NULL;
+}
+
+qdf_export_symbol(hal_srng_sim_stop);
+
+void hal_srng_sim_get_stats(hal_soc_handle_t hal_soc_hdl,
+			    hal_ring_handle_t hal_ring_hdl,
+			    struct hal_srng_sim_ring_stats *stats)
+{
+	struct hal_soc *hal = (struct hal_soc *)hal_soc_hdl;
+	struct hal_srng *srng = (struct hal_srng *)hal_ring_hdl;
+
+	*stats = hal->srng_sim->ring[srng->ring_id].stats;
+}
+
+qdf_export_symbol(hal_srng_sim_get_stats);
+
+void hal_srng_sim_dump_stats(hal_soc_handle_t hal_soc_hdl)
+{
+	struct hal_soc *hal = (struct hal_soc *)hal_soc_hdl;
+	struct hal_srng_sim_ring *sim_ring;
+	int i;
+
+	for (i = 0; i < HAL_SRNG_ID_MAX; i++) {
+		sim_ring = &hal->srng_sim->ring[i];
+		if (!sim_ring->ops)
+			continue;
+
+		hal_info("ring_id %d type %d entries %llu passes %llu full %llu stalls %llu",
+			 i, hal->srng_list[i].ring_type,
+			 (unsigned long long)sim_ring->stats.entries,
+			 (unsigned long long)sim_ring->stats.passes,
+			 (unsigned long long)sim_ring->stats.full,
+			 (unsigned long long)sim_ring->stats.stalls);
+	}
+}
+
+qdf_export_symbol(hal_srng_sim_dump_stats);
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2022 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: hal_srng_sim.h
+ * Software model of the SRNG hardware rings.
+ *
+ * With HAL_SRNG_SIM every SRNG keeps both of its ring pointers in host
+ * memory and no ring register is ever written. A simulator thread plays
+ * the role of the hardware blocks on the other side of the rings: it fills
+ * destination rings (REO2SW, WBM2SW, ...) and drains source rings (SW2TCL,
+ * SW2RXDMA, ...) through callbacks registered per ring, so that the
+ * unmodified hal_srng_access_start/end and hal_srng_*_get_next inline API
+ * and the datapath above it can be exercised without a target.
+ */
+
+#ifndef _HAL_SRNG_SIM_H_
+#define _HAL_SRNG_SIM_H_
+
+#include "hal_internal.h"
+
+/* Max entries the simulator moves on one ring per pass */
+#define HAL_SRNG_SIM_DEFAULT_BUDGET 64
+/* Pause between two simulator passes */
+#define HAL_SRNG_SIM_INTERVAL_US 10
+
+/**
+ * struct hal_srng_sim_ops - hardware model of one ring
+ * @produce: destination rings only; fill @desc as the producing HW block
+ *	would and return true, or return false if there is nothing to produce
+ * @consume: source rings only; process the entry posted by SW at @desc and
+ *	return true, or return false to leave it on the ring (backpressure)
+ * @notify: optional; called after new entries are published on a
+ *	destination ring or consumed from a source ring, typically to run
+ *	the interrupt handler a real target would have raised
+ *
+ * All callbacks run in the simulator thread and @desc points at
+ * hal_srng_get_entrysize() bytes of ring memory.
+ */
+struct hal_srng_sim_ops {
+	bool (*produce)(void *ctx, hal_ring_handle_t hal_ring_hdl,
+			uint32_t *desc);
+	bool (*consume)(void *ctx, hal_ring_handle_t hal_ring_hdl,
+			uint32_t *desc);
+	void (*notify)(void *ctx, hal_ring_handle_t hal_ring_hdl);
+};
+
+/**
+ * struct hal_srng_sim_ring_stats - per ring simulator counters
+ * @entries: entries produced (dst ring) or consumed (src ring)
+ * @passes: simulator passes which moved at least one entry
+ * @full: passes that stopped because the destination ring was full
+ * @stalls: passes that stopped because a callback refused an entry
+ */
+struct hal_srng_sim_ring_stats {
+	uint64_t entries;
+	uint64_t passes;
+	uint64_t full;
+	uint64_t stalls;
+};
+
+#ifdef HAL_SRNG_SIM
+/**
+ * hal_srng_sim_enabled() - check if SRNGs are backed by the simulator
+ *
+ * Return: true
+ */
+static inline bool hal_srng_sim_enabled(void)
+{
+	return true;
+}
+
+/**
+ * hal_srng_sim_attach() - allocate the simulator state of a HAL soc
+ * @hal: HAL soc
+ *
+ * Return: QDF_STATUS_SUCCESS or QDF_STATUS_E_NOMEM
+ */
+QDF_STATUS hal_srng_sim_attach(struct hal_soc *hal);
+
+/**
+ * hal_srng_sim_detach() - stop the simulator and free its state
+ * @hal: HAL soc
+ *
+ * Return: none
+ */
+void hal_srng_sim_detach(struct hal_soc *hal);
+
+/**
+ * hal_srng_sim_ptr_init() - reset the host memory pointers of a ring
+ * @hal: HAL soc
+ * @srng: ring being set up
+ *
+ * Return: location SW writes its ring pointer (src HP / dst TP) to
+ */
+uint32_t *hal_srng_sim_ptr_init(struct hal_soc *hal, struct hal_srng *srng);
+
+/**
+ * hal_srng_sim_register() - attach a hardware model to a ring
+ * @hal_soc_hdl: HAL soc handle
+ * @hal_ring_hdl: ring set up by hal_srng_setup()
+ * @ops: model callbacks, must stay valid until unregistered
+ * @ctx: context passed to @ops
+ * @budget: max entries moved per pass, 0 for the default
+ *
+ * Models can only be changed while the simulator is stopped.
+ *
+ * Return: QDF_STATUS
+ */
+QDF_STATUS hal_srng_sim_register(hal_soc_handle_t hal_soc_hdl,
+				 hal_ring_handle_t hal_ring_hdl,
+				 const struct hal_srng_sim_ops *ops,
+				 void *ctx, uint32_t budget);
+
+/**
+ * hal_srng_sim_unregister() - detach the hardware model of a ring
+ * @hal_soc_hdl: HAL soc handle
+ * @hal_ring_hdl: ring handle
+ *
+ * Return: none
+ */
+void hal_srng_sim_unregister(hal_soc_handle_t hal_soc_hdl,
+			     hal_ring_handle_t hal_ring_hdl);
+
+/**
+ * hal_srng_sim_start() - start the simulator thread
+ * @hal_soc_hdl: HAL soc handle
+ *
+ * Return: QDF_STATUS
+ */
+QDF_STATUS hal_srng_sim_start(hal_soc_handle_t hal_soc_hdl);
+
+/**
+ * hal_srng_sim_stop() - stop the simulator thread and wait for it
+ * @hal_soc_hdl: HAL soc handle
+ *
+ * Return: none
+ */
+void hal_srng_sim_stop(hal_soc_handle_t hal_soc_hdl);
+
+/**
+ * hal_srng_sim_run_once() - run one simulator pass in the caller context
+ * @hal_soc_hdl: HAL soc handle
+ *
+ * For single threaded, deterministic runs (e.g. fuzzing) with the
+ * simulator thread stopped.
+ *
+ * Return: number of entries moved
+ */
+uint32_t hal_srng_sim_run_once(hal_soc_handle_t hal_soc_hdl);
+
+/**
+ * hal_srng_sim_get_stats() - get the simulator counters of a ring
+ * @hal_soc_hdl: HAL soc handle
+ * @hal_ring_hdl: ring handle
+ * @stats: filled with the counters
+ *
+ * Return: none
+ */
+void hal_srng_sim_get_stats(hal_soc_handle_t hal_soc_hdl,
+			    hal_ring_handle_t hal_ring_hdl,
+			    struct hal_srng_sim_ring_stats *stats);
+
+/**
+ * hal_srng_sim_dump_stats() - print the counters of all modelled rings
+ * @hal_soc_hdl: HAL soc handle
+ *
+ * Return: none
+ */
+void hal_srng_sim_dump_stats(hal_soc_handle_t hal_soc_hdl);
+#else
+static inline bool hal_srng_sim_enabled(void)
+{
+	return false;
+}
+
+static inline QDF_STATUS hal_srng_sim_attach(struct hal_soc *hal)
+{
+	return QDF_STATUS_SUCCESS;
+}
+
+static inline void hal_srng_sim_detach(struct hal_soc *hal)
+{
+}
+
+static inline uint32_t *hal_srng_sim_ptr_init(struct hal_soc *hal,
+					      struct hal_srng *srng)
+{
+	return NULL;
+}
+#endif /* HAL_SRNG_SIM */
+#endif /* _HAL_SRNG_SIM_H_ */
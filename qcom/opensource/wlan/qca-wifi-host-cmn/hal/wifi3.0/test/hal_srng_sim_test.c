@@ -0,0 +1,467 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "hal_api.h"
+#include "hal_srng_sim.h"
+#include "hal_srng_sim_test.h"
+#include "qdf_mem.h"
+#include "qdf_threads.h"
+#include "qdf_trace.h"
+
+#define hal_srng_sim_test_entry_size 2
+#define hal_srng_sim_test_num_entries 8
+/* one slot always stays empty to tell a full ring from an empty one */
+#define hal_srng_sim_test_capacity (hal_srng_sim_test_num_entries - 1)
+#define hal_srng_sim_test_mt_count 20000
+#define hal_srng_sim_test_max_waits 100000
+
+/**
+ * struct hal_srng_sim_test_model - hardware model of a test ring
+ * @seq: sequence number of the next entry to produce or expect
+ * @limit: produce entries up to this sequence number only
+ * @credits: entries the model accepts before it applies backpressure
+ * @errors: entries consumed out of order
+ * @notified: number of notify() calls
+ */
+struct hal_srng_sim_test_model {
+	uint32_t seq;
+	uint32_t limit;
+	uint32_t credits;
+	uint32_t errors;
+	uint32_t notified;
+};
+
+/**
+ * struct hal_srng_sim_test_soc - a HAL soc with two simulated rings
+ * @hal: HAL soc, zeroed but for what the SRNG API touches
+ * @dst_mem: REO2SW1 ring memory
+ * @src_mem: SW2TCL1 ring memory
+ * @dst: REO2SW1 ring
+ * @src: SW2TCL1 ring
+ */
+struct hal_srng_sim_test_soc {
+	struct hal_soc *hal;
+	uint32_t dst_mem[hal_srng_sim_test_entry_size *
+			 hal_srng_sim_test_num_entries];
+	uint32_t src_mem[hal_srng_sim_test_entry_size *
+			 hal_srng_sim_test_num_entries];
+	hal_ring_handle_t dst;
+	hal_ring_handle_t src;
+};
+
+static bool hal_srng_sim_test_produce(void *ctx,
+				      hal_ring_handle_t hal_ring_hdl,
+				      uint32_t *desc)
+{
+	struct hal_srng_sim_test_model *model = ctx;
+
+	if (model->seq == model->limit)
+		return false;
+
+	desc[0] = model->seq;
+	desc[1] = ~model->seq;
+	model->seq++;
+
+	return true;
+}
+
+static bool hal_srng_sim_test_consume(void *ctx,
+				      hal_ring_handle_t hal_ring_hdl,
+				      uint32_t *desc)
+{
+	struct hal_srng_sim_test_model *model = ctx;
+
+	if (!model->credits)
+		return false;
+
+	if (desc[0] != model->seq || desc[1] != ~model->seq)
+		model->errors++;
+
+	model->seq++;
+	model->credits--;
+
+	return true;
+}
+
+static void hal_srng_sim_test_notify(void *ctx,
+				     hal_ring_handle_t hal_ring_hdl)
+{
+	struct hal_srng_sim_test_model *model = ctx;
+
+	model->notified++;
+}
+
+static const struct hal_srng_sim_ops hal_srng_sim_test_ops = {
+	.produce = hal_srng_sim_test_produce,
+	.consume = hal_srng_sim_test_consume,
+	.notify = hal_srng_sim_test_notify,
+};
+
+/**
+ * hal_srng_sim_test_ring_setup() - set a ring up as hal_srng_setup() does
+ * @hal: HAL soc
+ * @ring_id: ring id
+ * @ring_dir: HAL_SRNG_SRC_RING or HAL_SRNG_DST_RING
+ * @ring_mem: ring memory
+ *
+ * hal_srng_setup() needs the target ring config of a HAL attached through
+ * HIF. Only the software ring state it sets up for a simulated ring is
+ * repeated here.
+ *
+ * Return: ring handle
+ */
+static hal_ring_handle_t
+hal_srng_sim_test_ring_setup(struct hal_soc *hal, int ring_id,
+			     enum hal_srng_dir ring_dir, uint32_t *ring_mem)
+{
+	struct hal_srng *srng = &hal->srng_list[ring_id];
+
+	srng->ring_id = ring_id;
+	srng->ring_dir = ring_dir;
+	srng->ring_base_vaddr = ring_mem;
+	srng->entry_size = hal_srng_sim_test_entry_size;
+	srng->num_entries = hal_srng_sim_test_num_entries;
+	srng->ring_size = srng->num_entries * srng->entry_size;
+	srng->ring_size_mask = srng->ring_size - 1;
+	srng->ring_vaddr_end = srng->ring_base_vaddr + srng->ring_size;
+	srng->hal_soc = hal;
+	qdf_mem_zero(ring_mem, srng->ring_size * sizeof(*ring_mem));
+
+	if (ring_dir == HAL_SRNG_SRC_RING) {
+		srng->u.src_ring.hp = 0;
+		srng->u.src_ring.reap_hp = srng->ring_size - srng->entry_size;
+		srng->u.src_ring.tp_addr =
+			&hal->shadow_rdptr_mem_vaddr[ring_id];
+		srng->u.src_ring.hp_addr = hal_srng_sim_ptr_init(hal, srng);
+	} else {
+		srng->u.dst_ring.loop_cnt = 1;
+		srng->u.dst_ring.tp = 0;
+		srng->u.dst_ring.hp_addr =
+			&hal->shadow_rdptr_mem_vaddr[ring_id];
+		srng->u.dst_ring.tp_addr = hal_srng_sim_ptr_init(hal, srng);
+	}
+	srng->flags |= HAL_SRNG_LMAC_RING;
+
+	SRNG_LOCK_INIT(&srng->lock);
+	srng->initialized = 1;
+
+	return (hal_ring_handle_t)srng;
+}
+
+static QDF_STATUS hal_srng_sim_test_attach(struct hal_srng_sim_test_soc *soc)
+{
+	struct hal_soc *hal;
+
+	hal = qdf_mem_malloc(sizeof(*hal));
+	if (!hal)
+		return QDF_STATUS_E_NOMEM;
+
+	hal->shadow_rdptr_mem_vaddr =
+		qdf_mem_malloc(sizeof(*hal->shadow_rdptr_mem_vaddr) *
+			       HAL_SRNG_ID_MAX);
+	if (!hal->shadow_rdptr_mem_vaddr)
+		goto free_hal;
+
+	if (QDF_IS_STATUS_ERROR(hal_srng_sim_attach(hal)))
+		goto free_rdptr;
+
+	soc->hal = hal;
+	soc->dst = hal_srng_sim_test_ring_setup(hal, HAL_SRNG_REO2SW1,
+						HAL_SRNG_DST_RING,
+						soc->dst_mem);
+	soc->src = hal_srng_sim_test_ring_setup(hal, HAL_SRNG_SW2TCL1,
+						HAL_SRNG_SRC_RING,
+						soc->src_mem);
+
+	return QDF_STATUS_SUCCESS;
+
+free_rdptr:
+	qdf_mem_free(hal->shadow_rdptr_mem_vaddr);
+free_hal:
+	qdf_mem_free(hal);
+
+	return QDF_STATUS_E_NOMEM;
+}
+
+static void hal_srng_sim_test_detach(struct hal_srng_sim_test_soc *soc)
+{
+	struct hal_soc *hal = soc->hal;
+
+	SRNG_LOCK_DESTROY(&((struct hal_srng *)soc->dst)->lock);
+	SRNG_LOCK_DESTROY(&((struct hal_srng *)soc->src)->lock);
+	hal_srng_sim_detach(hal);
+	qdf_mem_free(hal->shadow_rdptr_mem_vaddr);
+	qdf_mem_free(hal);
+}
+
+/**
+ * hal_srng_sim_test_reap() - consume a destination ring as the datapath does
+ * @soc: test soc
+ * @seq: sequence number of the next expected entry, moved past the reaped
+ *	entries
+ *
+ * Return: number of entries reaped, or -1 if one was out of order
+ */
+static int hal_srng_sim_test_reap(struct hal_srng_sim_test_soc *soc,
+				  uint32_t *seq)
+{
+	hal_soc_handle_t hal_soc_hdl = hal_soc_to_hal_soc_handle(soc->hal);
+	uint32_t *desc;
+	int num = 0;
+
+	if (hal_srng_access_start(hal_soc_hdl, soc->dst))
+		return -1;
+
+	while ((desc = hal_srng_dst_get_next(soc->hal, soc->dst))) {
+		if (desc[0] != *seq || desc[1] != ~*seq) {
+			num = -1;
+			break;
+		}
+		(*seq)++;
+		num++;
+	}
+
+	hal_srng_access_end(soc->hal, soc->dst);
+
+	return num;
+}
+
+/**
+ * hal_srng_sim_test_post() - fill a source ring as the datapath does
+ * @soc: test soc
+ * @seq: sequence number of the next entry, moved past the posted entries
+ * @limit: post entries up to this sequence number only
+ *
+ * Return: number of entries posted
+ */
+static int hal_srng_sim_test_post(struct hal_srng_sim_test_soc *soc,
+				  uint32_t *seq, uint32_t limit)
+{
+	hal_soc_handle_t hal_soc_hdl = hal_soc_to_hal_soc_handle(soc->hal);
+	uint32_t *desc;
+	int num = 0;
+
+	if (hal_srng_access_start(hal_soc_hdl, soc->src))
+		return 0;
+
+	while (*seq != limit &&
+	       (desc = hal_srng_src_get_next(soc->hal, soc->src))) {
+		desc[0] = *seq;
+		desc[1] = ~*seq;
+		(*seq)++;
+		num++;
+	}
+
+	hal_srng_access_end(soc->hal, soc->src);
+
+	return num;
+}
+
+static uint32_t hal_srng_sim_test_produce_reap(void)
+{
+	struct hal_srng_sim_test_soc soc;
+	struct hal_srng_sim_test_model model = {
+		.limit = 2 * hal_srng_sim_test_capacity + 3,
+	};
+	struct hal_srng_sim_ring_stats stats;
+	hal_soc_handle_t hal_soc_hdl;
+	uint32_t seq = 0;
+
+	if (QDF_IS_STATUS_ERROR(hal_srng_sim_test_attach(&soc)))
+		return 1;
+
+	hal_soc_hdl = hal_soc_to_hal_soc_handle(soc.hal);
+	QDF_BUG(QDF_IS_STATUS_SUCCESS(
+		hal_srng_sim_register(hal_soc_hdl, soc.dst,
+				      &hal_srng_sim_test_ops, &model, 0)));
+
+	/* a destination ring should ... */
+	QDF_BUG(hal_srng_sim_test_reap(&soc, &seq) == 0);
+
+	/* ... be filled by the model up to its capacity */
+	QDF_BUG(hal_srng_sim_run_once(hal_soc_hdl) ==
+		hal_srng_sim_test_capacity);
+	QDF_BUG(hal_srng_sim_run_once(hal_soc_hdl) == 0);
+	QDF_BUG(model.notified == 1);
+
+	/* ... hand the entries to SW in order */
+	QDF_BUG(hal_srng_sim_test_reap(&soc, &seq) ==
+		hal_srng_sim_test_capacity);
+	QDF_BUG(hal_srng_sim_test_reap(&soc, &seq) == 0);
+
+	/* ... be refilled once SW moved the tail pointer, across the wrap */
+	QDF_BUG(hal_srng_sim_run_once(hal_soc_hdl) ==
+		hal_srng_sim_test_capacity);
+	QDF_BUG(hal_srng_sim_test_reap(&soc, &seq) ==
+		hal_srng_sim_test_capacity);
+
+	/* ... stop when the model has nothing more to produce */
+	QDF_BUG(hal_srng_sim_run_once(hal_soc_hdl) == 3);
+	QDF_BUG(hal_srng_sim_test_reap(&soc, &seq) == 3);
+	QDF_BUG(seq == model.limit);
+
+	hal_srng_sim_get_stats(hal_soc_hdl, soc.dst, &stats);
+	QDF_BUG(stats.entries == model.limit);
+	QDF_BUG(stats.passes == 3);
+	QDF_BUG(stats.full == 3);
+	QDF_BUG(stats.stalls == 1);
+
+	hal_srng_sim_unregister(hal_soc_hdl, soc.dst);
+	hal_srng_sim_test_detach(&soc);
+
+	return 0;
+}
+
+static uint32_t hal_srng_sim_test_post_consume(void)
+{
+	struct hal_srng_sim_test_soc soc;
+	struct hal_srng_sim_test_model model = { 0 };
+	struct hal_srng_sim_ring_stats stats;
+	hal_soc_handle_t hal_soc_hdl;
+	uint32_t seq = 0;
+
+	if (QDF_IS_STATUS_ERROR(hal_srng_sim_test_attach(&soc)))
+		return 1;
+
+	hal_soc_hdl = hal_soc_to_hal_soc_handle(soc.hal);
+	QDF_BUG(QDF_IS_STATUS_SUCCESS(
+		hal_srng_sim_register(hal_soc_hdl, soc.src,
+				      &hal_srng_sim_test_ops, &model, 0)));
+
+	/* a source ring should ... */
+	QDF_BUG(hal_srng_sim_run_once(hal_soc_hdl) == 0);
+
+	/* ... take entries from SW up to its capacity */
+	QDF_BUG(hal_srng_sim_test_post(&soc, &seq, -1) ==
+		hal_srng_sim_test_capacity);
+	QDF_BUG(hal_srng_sim_test_post(&soc, &seq, -1) == 0);
+
+	/* ... keep the entries the model refuses */
+	model.credits = 3;
+	QDF_BUG(hal_srng_sim_run_once(hal_soc_hdl) == 3);
+	QDF_BUG(hal_srng_sim_run_once(hal_soc_hdl) == 0);
+	QDF_BUG(model.notified == 1);
+
+	/* ... have room for as many entries as the model consumed */
+	QDF_BUG(hal_srng_sim_test_post(&soc, &seq, -1) == 3);
+
+	/* ... hand all entries to the model in order, across the wrap */
+	model.credits = -1;
+	QDF_BUG(hal_srng_sim_run_once(hal_soc_hdl) ==
+		hal_srng_sim_test_capacity);
+	QDF_BUG(model.seq == seq);
+	QDF_BUG(!model.errors);
+
+	hal_srng_sim_get_stats(hal_soc_hdl, soc.src, &stats);
+	QDF_BUG(stats.entries == seq);
+	QDF_BUG(stats.passes == 2);
+	QDF_BUG(stats.stalls == 2);
+
+	hal_srng_sim_unregister(hal_soc_hdl, soc.src);
+	hal_srng_sim_test_detach(&soc);
+
+	return 0;
+}
+
+static uint32_t hal_srng_sim_test_thread(void)
+{
+	struct hal_srng_sim_test_soc soc;
+	struct hal_srng_sim_test_model dst_model = {
+		.limit = hal_srng_sim_test_mt_count,
+	};
+	struct hal_srng_sim_test_model src_model = { .credits = -1 };
+	hal_soc_handle_t hal_soc_hdl;
+	uint32_t reaped = 0;
+	uint32_t posted = 0;
+	uint32_t waits = 0;
+	int num;
+
+	if (QDF_IS_STATUS_ERROR(hal_srng_sim_test_attach(&soc)))
+		return 1;
+
+	hal_soc_hdl = hal_soc_to_hal_soc_handle(soc.hal);
+	QDF_BUG(QDF_IS_STATUS_SUCCESS(
+		hal_srng_sim_register(hal_soc_hdl, soc.dst,
+				      &hal_srng_sim_test_ops, &dst_model,
+				      0)));
+	QDF_BUG(QDF_IS_STATUS_SUCCESS(
+		hal_srng_sim_register(hal_soc_hdl, soc.src,
+				      &hal_srng_sim_test_ops, &src_model,
+				      0)));
+
+	/* with the simulator thread running, both rings should ... */
+	if (QDF_IS_STATUS_ERROR(hal_srng_sim_start(hal_soc_hdl))) {
+		hal_srng_sim_test_detach(&soc);
+		return 1;
+	}
+
+	/* ... not take a model change */
+	QDF_BUG(hal_srng_sim_register(hal_soc_hdl, soc.src,
+				      &hal_srng_sim_test_ops, &src_model,
+				      0) == QDF_STATUS_E_BUSY);
+
+	/* ... move every entry, in order, however the two sides interleave */
+	while (reaped < hal_srng_sim_test_mt_count ||
+	       posted < hal_srng_sim_test_mt_count) {
+		num = hal_srng_sim_test_reap(&soc, &reaped);
+		if (num < 0)
+			break;
+
+		num += hal_srng_sim_test_post(&soc, &posted,
+					      hal_srng_sim_test_mt_count);
+		if (num) {
+			waits = 0;
+			continue;
+		}
+
+		if (++waits == hal_srng_sim_test_max_waits)
+			break;
+		qdf_sleep_us(1);
+	}
+
+	/* wait for the model to drain what was posted last */
+	waits = 0;
+	while (*((struct hal_srng *)soc.src)->u.src_ring.tp_addr !=
+	       *((struct hal_srng *)soc.src)->u.src_ring.hp_addr &&
+	       ++waits < hal_srng_sim_test_max_waits)
+		qdf_sleep_us(1);
+
+	hal_srng_sim_stop(hal_soc_hdl);
+
+	QDF_BUG(reaped == hal_srng_sim_test_mt_count);
+	QDF_BUG(posted == hal_srng_sim_test_mt_count);
+	QDF_BUG(src_model.seq == hal_srng_sim_test_mt_count);
+	QDF_BUG(!src_model.errors);
+
+	hal_srng_sim_unregister(hal_soc_hdl, soc.dst);
+	hal_srng_sim_unregister(hal_soc_hdl, soc.src);
+	hal_srng_sim_test_detach(&soc);
+
+	return 0;
+}
+
+uint32_t hal_srng_sim_unit_test(void)
+{
+	uint32_t errors = 0;
+
+	errors += hal_srng_sim_test_produce_reap();
+	errors += hal_srng_sim_test_post_consume();
+	errors += hal_srng_sim_test_thread();
+
+	return errors;
+}
@@ -165,6 +165,23 @@ static inline int32_t qdf_atomic_inc_not_zero(qdf_atomic_t *v)
 	return __qdf_atomic_inc_not_zero(v);
 }
 
+/**
+ * qdf_atomic_cmpxchg() - compare and exchange the value of an atomic variable
+ * @v: A pointer to an opaque atomic variable
+ * @old: value the variable is expected to hold
+ * @new: value to store if the variable holds @old
+ *
+ * The exchange happened if the returned value equals @old. Implies a full
+ * memory barrier on success.
+ *
+ * Return: The value of the variable before the operation
+ */
+static inline int32_t qdf_atomic_cmpxchg(qdf_atomic_t *v, int32_t old,
+					 int32_t new)
+{
+	return __qdf_atomic_cmpxchg(v, old, new);
+}
+
 /**
  * qdf_atomic_set_bit - Atomically set a bit in memory
  * @nr: bit to set
@@ -29,6 +29,7 @@
 #include "i_qdf_dev.h"
 
 #define qdf_cpumask_pr_args(maskp) __qdf_cpumask_pr_args(maskp)
+#define QDF_CPU_CAPACITY_SCALE __QDF_CPU_CAPACITY_SCALE
 #define qdf_for_each_possible_cpu(cpu) __qdf_for_each_possible_cpu(cpu)
 #define qdf_for_each_online_cpu(cpu) __qdf_for_each_online_cpu(cpu)
 #define qdf_for_each_cpu(cpu, maskp) __qdf_for_each_cpu(cpu, maskp)
@@ -157,6 +158,11 @@ static inline int qdf_topology_physical_package_id(unsigned int cpu)
 	return __qdf_topology_physical_package_id(cpu);
 }
 
+static inline unsigned long qdf_topology_cpu_capacity(unsigned int cpu)
+{
+	return __qdf_topology_cpu_capacity(cpu);
+}
+
 static inline int qdf_cpumask_subset(qdf_cpu_mask *srcp1,
 				     const qdf_cpu_mask *srcp2)
 {
@@ -44,6 +44,8 @@
 
 typedef __qdf_list_node_t qdf_list_node_t;
 typedef __qdf_list_t qdf_list_t;
+typedef __qdf_llist_head_t qdf_llist_head_t;
+typedef __qdf_llist_node_t qdf_llist_node_t;
 
 /* Function declarations */
 
@@ -215,4 +217,93 @@ QDF_STATUS qdf_list_join(qdf_list_t *list1, qdf_list_t *list2);
  */
 QDF_STATUS qdf_list_split(qdf_list_t *new, qdf_list_t *list,
 			  qdf_list_node_t *node);
+
+/*
+ * Lock-less lists: singly linked lists any number of producers can add to
+ * without a lock. Entries are removed either all at once, by any context,
+ * or one at a time from the head by a single consumer, as long as that is
+ * not mixed with other removals running concurrently.
+ */
+
+/**
+ * qdf_init_llist_head() - initialize a lock-less list
+ * @head: the list head
+ *
+ * Return: none
+ */
+static inline void qdf_init_llist_head(qdf_llist_head_t *head)
+{
+	__qdf_init_llist_head(head);
+}
+
+/**
+ * qdf_llist_add() - add an entry at the head of a lock-less list
+ * @node: the entry to add
+ * @head: the list head
+ *
+ * Return: true if the list was empty
+ */
+static inline bool qdf_llist_add(qdf_llist_node_t *node,
+				 qdf_llist_head_t *head)
+{
+	return __qdf_llist_add(node, head);
+}
+
+/**
+ * qdf_llist_del_first() - remove the entry at the head of a lock-less list
+ * @head: the list head
+ *
+ * Only one context may remove entries this way at a time.
+ *
+ * Return: the removed entry, NULL if the list was empty
+ */
+static inline qdf_llist_node_t *qdf_llist_del_first(qdf_llist_head_t *head)
+{
+	return __qdf_llist_del_first(head);
+}
+
+/**
+ * qdf_llist_del_all() - remove all entries of a lock-less list
+ * @head: the list head
+ *
+ * Return: the removed entries, newest first
+ */
+static inline qdf_llist_node_t *qdf_llist_del_all(qdf_llist_head_t *head)
+{
+	return __qdf_llist_del_all(head);
+}
+
+/**
+ * qdf_llist_reverse_order() - reverse a chain of removed entries
+ * @node: first entry of the chain
+ *
+ * Return: the new first entry
+ */
+static inline qdf_llist_node_t *
+qdf_llist_reverse_order(qdf_llist_node_t *node)
+{
+	return __qdf_llist_reverse_order(node);
+}
+
+/**
+ * qdf_llist_empty() - check if a lock-less list is empty
+ * @head: the list head
+ *
+ * Return: true if the list is empty
+ */
+static inline bool qdf_llist_empty(const qdf_llist_head_t *head)
+{
+	return __qdf_llist_empty(head);
+}
+
+/**
+ * qdf_llist_next() - get the next entry of a chain of removed entries
+ * @node: current entry
+ *
+ * Return: the next entry, NULL at the end of the chain
+ */
+static inline qdf_llist_node_t *qdf_llist_next(qdf_llist_node_t *node)
+{
+	return __qdf_llist_next(node);
+}
 #endif /* __QDF_LIST_H */
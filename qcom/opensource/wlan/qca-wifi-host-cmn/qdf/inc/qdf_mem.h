@@ -616,6 +616,42 @@ static inline void qdf_mempool_free(qdf_device_t osdev, qdf_mempool_t pool,
 	__qdf_mempool_free(osdev, pool, buf);
 }
 
+/**
+ * qdf_mempool_alloc_bulk() - Allocate several elements of a memory pool
+ * @osdev: platform device object
+ * @pool: Handle to memory pool
+ * @elems: filled with the allocated elements
+ * @count: number of elements to allocate
+ *
+ * Cheaper than @count calls to qdf_mempool_alloc(), the per-CPU cache of
+ * the pool is only locked once.
+ *
+ * Return: number of elements allocated, less than @count if the pool is
+ * exhausted
+ */
+static inline int qdf_mempool_alloc_bulk(qdf_device_t osdev,
+					 qdf_mempool_t pool,
+					 void **elems, int count)
+{
+	return __qdf_mempool_alloc_bulk(osdev, pool, elems, count);
+}
+
+/**
+ * qdf_mempool_free_bulk() - Free several memory pool elements
+ * @osdev: platform device object
+ * @pool: Handle to memory pool
+ * @elems: elements to be freed
+ * @count: number of elements
+ *
+ * Return: none
+ */
+static inline void qdf_mempool_free_bulk(qdf_device_t osdev,
+					 qdf_mempool_t pool,
+					 void **elems, int count)
+{
+	__qdf_mempool_free_bulk(osdev, pool, elems, count);
+}
+
 void qdf_mem_dma_sync_single_for_device(qdf_device_t osdev,
 					qdf_dma_addr_t bus_addr,
 					qdf_size_t size,
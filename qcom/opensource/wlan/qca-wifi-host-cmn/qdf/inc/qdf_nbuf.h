@@ -2092,6 +2092,28 @@ static inline void qdf_nbuf_list_free(qdf_nbuf_t buf_list)
 	}
 }
 
+/**
+ * qdf_nbuf_list_consume() - free a list of nbufs that were consumed
+ * @buf_list: A list of nbufs linked through qdf_nbuf_set_next()
+ *
+ * Bulk variant of qdf_nbuf_free() for buffers whose transmission
+ * completed, e.g. a batch of tx completions. With NBUF_MEMORY_DEBUG the
+ * buffers go through the tracked qdf_nbuf_free() path.
+ *
+ * Return: none
+ */
+#ifdef NBUF_MEMORY_DEBUG
+static inline void qdf_nbuf_list_consume(qdf_nbuf_t buf_list)
+{
+	qdf_nbuf_list_free(buf_list);
+}
+#else
+static inline void qdf_nbuf_list_consume(qdf_nbuf_t buf_list)
+{
+	__qdf_nbuf_list_consume(buf_list);
+}
+#endif
+
 static inline void qdf_nbuf_tx_free(qdf_nbuf_t buf_list, int tx_err)
 {
 	qdf_nbuf_list_free(buf_list);
@@ -3880,6 +3902,17 @@ static inline void qdf_nbuf_set_priority(qdf_nbuf_t buf, uint32_t p)
 	__qdf_nbuf_set_priority(buf, p);
 }
 
+/**
+ * qdf_nbuf_get_hash() - get the flow hash of the network buffer
+ * @buf: Network buffer
+ *
+ * Return: flow hash, 0 if the flow could not be dissected
+ */
+static inline uint32_t qdf_nbuf_get_hash(qdf_nbuf_t buf)
+{
+	return __qdf_nbuf_get_hash(buf);
+}
+
 static inline void qdf_nbuf_record_rx_queue(qdf_nbuf_t buf, uint32_t queue_id)
 {
 	__qdf_nbuf_record_rx_queue(buf, queue_id);
@@ -338,5 +338,89 @@ __qdf_ptr_hash_remove(struct qdf_ptr_hash *ht, uintptr_t key)
 		break; \
 	cursor; })
 
+#define QDF_PTR_HASH_CHAIN_HIST_SIZE 5
+
+/**
+ * struct qdf_ptr_hash_stats - chain length statistics of a hash table
+ * @entries: number of entries
+ * @buckets: number of buckets
+ * @max_chain: length of the longest chain
+ * @chain_hist: number of buckets per chain length; the last slot counts all
+ *	chains of QDF_PTR_HASH_CHAIN_HIST_SIZE - 1 entries or more
+ * @resizes: number of completed resizes (qdf_ptr_rhash only)
+ */
+struct qdf_ptr_hash_stats {
+	uint32_t entries;
+	uint32_t buckets;
+	uint32_t max_chain;
+	uint32_t chain_hist[QDF_PTR_HASH_CHAIN_HIST_SIZE];
+	uint32_t resizes;
+};
+
+/**
+ * qdf_ptr_hash_stats_add_chain() - account for one bucket in @stats
+ * @stats: the statistics to update
+ * @len: number of entries chained in the bucket
+ *
+ * Return: None
+ */
+static inline void qdf_ptr_hash_stats_add_chain(struct qdf_ptr_hash_stats *stats,
+						uint32_t len)
+{
+	stats->entries += len;
+	stats->buckets++;
+	if (len > stats->max_chain)
+		stats->max_chain = len;
+	if (len > QDF_PTR_HASH_CHAIN_HIST_SIZE - 1)
+		len = QDF_PTR_HASH_CHAIN_HIST_SIZE - 1;
+	stats->chain_hist[len]++;
+}
+
+/**
+ * qdf_ptr_hash_get_stats() - get the chain length statistics of a qdf_ptr_hash
+ * @ht: the qdf_ptr_hash to inspect
+ * @stats: filled with the statistics of @ht
+ *
+ * Return: None
+ */
+static inline void qdf_ptr_hash_get_stats(struct qdf_ptr_hash *ht,
+					  struct qdf_ptr_hash_stats *stats)
+{
+	struct qdf_ptr_hash_bucket *bucket;
+	struct qdf_ptr_hash_entry *entry;
+	uint32_t len;
+
+	qdf_mem_zero(stats, sizeof(*stats));
+	__qdf_ptr_hash_for_each_bucket(ht, bucket) {
+		len = 0;
+		qdf_slist_for_each(&bucket->list, entry, node)
+			len++;
+		qdf_ptr_hash_stats_add_chain(stats, len);
+	}
+}
+
+/**
+ * qdf_ptr_hash_print_stats() - log hash table statistics
+ * @name: name of the hash table, for the log
+ * @stats: statistics from qdf_ptr_hash_get_stats()/qdf_ptr_rhash_get_stats()
+ *
+ * Return: None
+ */
+static inline void qdf_ptr_hash_print_stats(const char *name,
+					    struct qdf_ptr_hash_stats *stats)
+{
+	uint32_t used = stats->buckets - stats->chain_hist[0];
+	uint32_t avg_x100 = used ? stats->entries * 100 / used : 0;
+
+	qdf_nofl_info("%s: %u entries, %u buckets (%u used), avg chain %u.%02u, max chain %u, %u resizes",
+		      name, stats->entries, stats->buckets, used,
+		      avg_x100 / 100, avg_x100 % 100, stats->max_chain,
+		      stats->resizes);
+	qdf_nofl_info("%s: chains of 0/1/2/3/4+ entries: %u/%u/%u/%u/%u",
+		      name, stats->chain_hist[0], stats->chain_hist[1],
+		      stats->chain_hist[2], stats->chain_hist[3],
+		      stats->chain_hist[4]);
+}
+
 #endif /* __QDF_PTR_HASH_H */
 
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: qdf_ptr_rhash.h
+ *
+ * A resizable variant of qdf_ptr_hash with lock-free, RCU-safe lookups.
+ *
+ * A qdf_ptr_hash has a fixed number of buckets, so a table which ends up
+ * holding many more entries than estimated at declaration time degrades
+ * into long chains. A qdf_ptr_rhash instead keeps its load factor (entries
+ * per bucket) between QDF_PTR_RHASH_MIN_LOAD and QDF_PTR_RHASH_MAX_LOAD
+ * percent by resizing its bucket array, within the bounds given to
+ * qdf_ptr_rhash_create(). Add, remove and get take the same arguments as
+ * their qdf_ptr_hash counterparts.
+ *
+ * Rehashing is incremental: once the load factor crosses a threshold, a
+ * table of the new size is allocated and each following add or remove
+ * moves QDF_PTR_RHASH_REHASH_STEP buckets of the old table into it, so no
+ * single operation pays for the whole rehash. Entries have one link per
+ * table, so they are chained into the new table while lookups keep walking
+ * the old one, which stays complete until the new table replaces it.
+ *
+ * Add and remove serialize on a spinlock internal to the table.
+ * qdf_ptr_rhash_get() takes no lock: call it inside qdf_rcu_read_lock() and
+ * qdf_rcu_read_unlock(), and only free (or add again) a removed item after
+ * a grace period, e.g. from a qdf_call_rcu() callback.
+ */
+
+#ifndef __QDF_PTR_RHASH_H
+#define __QDF_PTR_RHASH_H
+
+#include "i_qdf_ptr_hash.h"
+#include "qdf_atomic.h"
+#include "qdf_lock.h"
+#include "qdf_ptr_hash.h"
+#include "qdf_rcu.h"
+#include "qdf_types.h"
+#include "qdf_util.h"
+
+/* grow once there are more entries than buckets */
+#define QDF_PTR_RHASH_MAX_LOAD 100
+/* shrink once less than a quarter of the buckets would be used */
+#define QDF_PTR_RHASH_MIN_LOAD 25
+/* old table buckets moved to the new table per add/remove */
+#define QDF_PTR_RHASH_REHASH_STEP 4
+
+/**
+ * struct qdf_ptr_rhash_entry - entry type of membership in a qdf_ptr_rhash
+ * @key: the value used as the key for insertion/lookup
+ * @next: next entry in the chain, one link per table generation
+ */
+struct qdf_ptr_rhash_entry {
+	uintptr_t key;
+	struct qdf_ptr_rhash_entry *next[2];
+};
+
+/**
+ * struct qdf_ptr_rhash_table - one bucket array of a qdf_ptr_rhash
+ * @ht: the hash table this bucket array belongs to
+ * @rcu: used to free the table once it has been replaced
+ * @bits: the number of bits to use when hashing keys
+ * @link: index of the qdf_ptr_rhash_entry next link chaining this table
+ * @buckets: 2^@bits chain heads
+ */
+struct qdf_ptr_rhash_table {
+	struct qdf_ptr_rhash *ht;
+	qdf_rcu_head_t rcu;
+	uint8_t bits;
+	uint8_t link;
+	struct qdf_ptr_rhash_entry *buckets[];
+};
+
+/**
+ * struct qdf_ptr_rhash - a resizable hash table for fast lookups via pointer
+ * @tbl: the table lookups use, holds every entry
+ * @new_tbl: the table being filled by an ongoing rehash, if any
+ * @rehash_pos: buckets of @tbl already moved to @new_tbl
+ * @count: number of entries
+ * @min_bits: @tbl never shrinks below 2^@min_bits buckets
+ * @max_bits: @tbl never grows beyond 2^@max_bits buckets
+ * @retiring: a replaced table may still be in use by lookups, no new rehash
+ *	can start before it is freed
+ * @resizes: number of completed resizes
+ * @lock: serializes add, remove and rehash
+ */
+struct qdf_ptr_rhash {
+	struct qdf_ptr_rhash_table *tbl;
+	struct qdf_ptr_rhash_table *new_tbl;
+	uint32_t rehash_pos;
+	uint32_t count;
+	uint8_t min_bits;
+	uint8_t max_bits;
+	qdf_atomic_t retiring;
+	uint32_t resizes;
+	qdf_spinlock_t lock;
+};
+
+/**
+ * qdf_ptr_rhash_create() - allocate and initialize a qdf_ptr_rhash
+ * @min_bits: the initial, and smallest, number of bits to use for hashing
+ * @max_bits: the largest number of bits to use for hashing
+ *
+ * Return: qdf_ptr_rhash pointer on success, NULL on allocation failure
+ */
+struct qdf_ptr_rhash *qdf_ptr_rhash_create(uint8_t min_bits, uint8_t max_bits);
+
+/**
+ * qdf_ptr_rhash_destroy() - de-initialize and de-allocate a qdf_ptr_rhash
+ * @ht: the qdf_ptr_rhash to destroy, it must be empty
+ *
+ * May sleep, waiting for a replaced bucket array to be freed.
+ *
+ * Return: None
+ */
+void qdf_ptr_rhash_destroy(struct qdf_ptr_rhash *ht);
+
+/**
+ * qdf_ptr_rhash_empty() - check if a qdf_ptr_rhash has any entries
+ * @ht: the qdf_ptr_rhash to check
+ *
+ * Return: true if @ht contains no entries
+ */
+static inline bool qdf_ptr_rhash_empty(struct qdf_ptr_rhash *ht)
+{
+	return !ht->count;
+}
+
+/**
+ * qdf_ptr_rhash_add() - insert an entry into a qdf_ptr_rhash
+ * @ht: the qdf_ptr_rhash to insert into
+ * @key: the pointer to use as an insertion/lookup key
+ * @item: a pointer to a type that contains a qdf_ptr_rhash_entry
+ * @entry_field: C identifier for the qdf_ptr_rhash_entry field in @item
+ *
+ * Return: None
+ */
+#define qdf_ptr_rhash_add(ht, key, item, entry_field) \
+	__qdf_ptr_rhash_add(ht, (uintptr_t)key, &(item)->entry_field)
+
+void __qdf_ptr_rhash_add(struct qdf_ptr_rhash *ht, uintptr_t key,
+			 struct qdf_ptr_rhash_entry *entry);
+
+/**
+ * qdf_ptr_rhash_remove() - remove an entry from a qdf_ptr_rhash
+ * @ht: the qdf_ptr_rhash to remove from
+ * @key: the pointer to use as a lookup key
+ * @cursor: a pointer to a type that contains a qdf_ptr_rhash_entry
+ * @entry_field: C identifier for the qdf_ptr_rhash_entry field in @cursor
+ *
+ * Return: removed item of type @cursor on success, NULL otherwise
+ */
+#define qdf_ptr_rhash_remove(ht, key, cursor, entry_field) ({ \
+	struct qdf_ptr_rhash_entry *_e = \
+		__qdf_ptr_rhash_remove(ht, (uintptr_t)key); \
+	cursor = _e ? qdf_container_of(_e, typeof(*(cursor)), \
+				       entry_field) : NULL; \
+	cursor; })
+
+struct qdf_ptr_rhash_entry *
+__qdf_ptr_rhash_remove(struct qdf_ptr_rhash *ht, uintptr_t key);
+
+static inline struct qdf_ptr_rhash_entry *
+__qdf_ptr_rhash_get(struct qdf_ptr_rhash *ht, uintptr_t key)
+{
+	struct qdf_ptr_rhash_table *tbl = qdf_rcu_read_ptr(ht->tbl);
+	struct qdf_ptr_rhash_entry *entry;
+
+	entry = qdf_rcu_read_ptr(tbl->buckets[__qdf_ptr_hash_key(key,
+								 tbl->bits)]);
+	for (; entry; entry = qdf_rcu_read_ptr(entry->next[tbl->link])) {
+		if (entry->key == key)
+			return entry;
+	}
+
+	return NULL;
+}
+
+/**
+ * qdf_ptr_rhash_get() - get the first item whose key matches @key
+ * @ht: the qdf_ptr_rhash to look in
+ * @key: the pointer to use as a lookup key
+ * @cursor: a pointer to a type that contains a qdf_ptr_rhash_entry
+ * @entry_field: C identifier for the qdf_ptr_rhash_entry field in @cursor
+ *
+ * Must be called inside an RCU read-side critical section, or with add and
+ * remove excluded by the caller.
+ *
+ * Return: first item matching @key of type @cursor on success, NULL otherwise
+ */
+#define qdf_ptr_rhash_get(ht, key, cursor, entry_field) ({ \
+	struct qdf_ptr_rhash_entry *_e = \
+		__qdf_ptr_rhash_get(ht, (uintptr_t)key); \
+	cursor = _e ? qdf_container_of(_e, typeof(*(cursor)), \
+				       entry_field) : NULL; \
+	cursor; })
+
+/**
+ * qdf_ptr_rhash_get_stats() - get the chain length statistics of @ht
+ * @ht: the qdf_ptr_rhash to inspect
+ * @stats: filled with the statistics of the table lookups currently use
+ *
+ * Return: None
+ */
+void qdf_ptr_rhash_get_stats(struct qdf_ptr_rhash *ht,
+			     struct qdf_ptr_hash_stats *stats);
+
+#endif /* __QDF_PTR_RHASH_H */
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: qdf_rcu.h
+ *
+ * Read-copy-update primitives for lock-free readers of shared lists.
+ *
+ * Readers walk a list inside qdf_rcu_read_lock()/qdf_rcu_read_unlock()
+ * without taking the writer lock. Writers still serialize among
+ * themselves, publish fully initialized elements after
+ * qdf_rcu_publish_barrier(), and defer freeing removed elements with
+ * qdf_call_rcu() until every reader that could still see them is done.
+ */
+
+#ifndef __QDF_RCU_H
+#define __QDF_RCU_H
+
+#include "i_qdf_rcu.h"
+
+/**
+ * typedef qdf_rcu_head_t - callback head embedded in RCU freed objects
+ */
+typedef __qdf_rcu_head_t qdf_rcu_head_t;
+
+/**
+ * typedef qdf_rcu_callback_t - deferred free callback
+ * @head: the qdf_rcu_head_t embedded in the object being freed
+ */
+typedef void (*qdf_rcu_callback_t)(qdf_rcu_head_t *head);
+
+/**
+ * qdf_rcu_read_lock() - enter an RCU read-side critical section
+ *
+ * Return: None
+ */
+static inline void qdf_rcu_read_lock(void)
+{
+	__qdf_rcu_read_lock();
+}
+
+/**
+ * qdf_rcu_read_unlock() - leave an RCU read-side critical section
+ *
+ * Return: None
+ */
+static inline void qdf_rcu_read_unlock(void)
+{
+	__qdf_rcu_read_unlock();
+}
+
+/**
+ * qdf_call_rcu() - invoke @func on @head once all current readers are done
+ * @head: callback head embedded in the object to be reclaimed
+ * @func: callback, run in softirq context
+ *
+ * Return: None
+ */
+static inline void qdf_call_rcu(qdf_rcu_head_t *head, qdf_rcu_callback_t func)
+{
+	__qdf_call_rcu(head, func);
+}
+
+/**
+ * qdf_synchronize_rcu() - wait for all current readers to finish
+ *
+ * May sleep.
+ *
+ * Return: None
+ */
+static inline void qdf_synchronize_rcu(void)
+{
+	__qdf_synchronize_rcu();
+}
+
+/**
+ * qdf_rcu_barrier() - wait for all pending qdf_call_rcu() callbacks to run
+ *
+ * May sleep. Must be called before freeing anything the callbacks use.
+ *
+ * Return: None
+ */
+static inline void qdf_rcu_barrier(void)
+{
+	__qdf_rcu_barrier();
+}
+
+/**
+ * qdf_rcu_publish_barrier() - order element initialization before publish
+ *
+ * Writers call this after filling in a new element and before linking it
+ * where concurrent readers can find it.
+ *
+ * Return: None
+ */
+static inline void qdf_rcu_publish_barrier(void)
+{
+	__qdf_rcu_publish_barrier();
+}
+
+/**
+ * qdf_rcu_read_ptr() - load a pointer that a writer may update concurrently
+ * @ptr: the pointer to load
+ */
+#define qdf_rcu_read_ptr(ptr) __qdf_rcu_read_ptr(ptr)
+
+/*
+ * TAILQ helpers for lists that are walked under qdf_rcu_read_lock() while
+ * writers hold the list lock. Unlike TAILQ_REMOVE, the RCU remove leaves
+ * the forward link of the removed element intact so that readers
+ * positioned on it can move on; the element itself must only be freed
+ * after a grace period.
+ */
+
+/**
+ * qdf_tailq_insert_tail_rcu() - publish an element at the tail of a TAILQ
+ * @head: the TAILQ head
+ * @elm: fully initialized element to add
+ * @field: name of the TAILQ_ENTRY in @elm
+ */
+#define qdf_tailq_insert_tail_rcu(head, elm, field) \
+	do { \
+		(elm)->field.tqe_next = NULL; \
+		(elm)->field.tqe_prev = (head)->tqh_last; \
+		qdf_rcu_publish_barrier(); \
+		*(head)->tqh_last = (elm); \
+		(head)->tqh_last = &(elm)->field.tqe_next; \
+	} while (0)
+
+/**
+ * qdf_tailq_remove_rcu() - unlink an element from a TAILQ
+ * @head: the TAILQ head
+ * @elm: element to remove
+ * @field: name of the TAILQ_ENTRY in @elm
+ */
+#define qdf_tailq_remove_rcu(head, elm, field) \
+	do { \
+		if ((elm)->field.tqe_next) \
+			(elm)->field.tqe_next->field.tqe_prev = \
+				(elm)->field.tqe_prev; \
+		else \
+			(head)->tqh_last = (elm)->field.tqe_prev; \
+		*(elm)->field.tqe_prev = (elm)->field.tqe_next; \
+	} while (0)
+
+/**
+ * qdf_tailq_foreach_rcu() - walk a TAILQ inside qdf_rcu_read_lock()
+ * @var: loop cursor
+ * @head: the TAILQ head
+ * @field: name of the TAILQ_ENTRY in the elements
+ */
+#define qdf_tailq_foreach_rcu(var, head, field) \
+	for ((var) = qdf_rcu_read_ptr((head)->tqh_first); \
+	     (var); \
+	     (var) = qdf_rcu_read_ptr((var)->field.tqe_next))
+
+#endif /* __QDF_RCU_H */
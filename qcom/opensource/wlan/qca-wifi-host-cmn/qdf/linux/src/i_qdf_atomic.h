@@ -158,6 +158,21 @@ static inline int32_t __qdf_atomic_inc_not_zero(__qdf_atomic_t *v)
 	return atomic_inc_not_zero(v);
 }
 
+/**
+ * __qdf_atomic_cmpxchg() - compare and exchange the value of an atomic
+ * variable
+ * @v: A pointer to an opaque atomic variable
+ * @old: value the variable is expected to hold
+ * @new: value to store if the variable holds @old
+ *
+ * Return: The value of the variable before the operation
+ */
+static inline int32_t __qdf_atomic_cmpxchg(__qdf_atomic_t *v, int32_t old,
+					   int32_t new)
+{
+	return atomic_cmpxchg(v, old, new);
+}
+
 /**
  * __qdf_atomic_set_bit - Atomically set a bit in memory
  * @nr: bit to set
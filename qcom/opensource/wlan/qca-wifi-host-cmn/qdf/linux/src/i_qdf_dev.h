@@ -29,6 +29,7 @@
 #include <qdf_types.h>
 #include "qdf_util.h"
 #include <linux/irq.h>
+#include <linux/sched/topology.h>
 #ifdef CONFIG_SCHED_CORE_CTL
 #include <linux/sched/core_ctl.h>
 #endif
@@ -38,6 +39,7 @@ struct qdf_devm;
 struct qdf_dev;
 
 #define __qdf_cpumask_pr_args(maskp) cpumask_pr_args(maskp)
+#define __QDF_CPU_CAPACITY_SCALE SCHED_CAPACITY_SCALE
 #define __qdf_for_each_possible_cpu(cpu) for_each_possible_cpu(cpu)
 #define __qdf_for_each_online_cpu(cpu) for_each_online_cpu(cpu)
 #define __qdf_for_each_cpu(cpu, maskp) \
@@ -143,6 +145,26 @@ static inline int __qdf_topology_physical_package_id(unsigned int cpu)
 	return topology_physical_package_id(cpu);
 }
 
+/**
+ * __qdf_topology_cpu_capacity() - API to retrieve the compute
+ * capacity of a cpu core
+ * @cpu: cpu core
+ *
+ * Return: capacity of @cpu, __QDF_CPU_CAPACITY_SCALE for the biggest
+ * cores of the system
+ */
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(5, 1, 0))
+static inline unsigned long __qdf_topology_cpu_capacity(unsigned int cpu)
+{
+	return arch_scale_cpu_capacity(cpu);
+}
+#else
+static inline unsigned long __qdf_topology_cpu_capacity(unsigned int cpu)
+{
+	return arch_scale_cpu_capacity(NULL, cpu);
+}
+#endif
+
 /**
  * __qdf_cpumask_subset() - API to check for subset in cpumasks
  * @srcp1: first cpu mask
@@ -25,6 +25,7 @@
 #define __I_QDF_LIST_H
 
 #include <linux/list.h>
+#include <linux/llist.h>
 
 /* Type declarations */
 typedef struct list_head __qdf_list_node_t;
@@ -110,4 +111,45 @@ static inline void __qdf_init_list_head(__qdf_list_node_t *list_head)
 {
 	INIT_LIST_HEAD(list_head);
 }
+
+typedef struct llist_head __qdf_llist_head_t;
+typedef struct llist_node __qdf_llist_node_t;
+
+static inline void __qdf_init_llist_head(__qdf_llist_head_t *head)
+{
+	init_llist_head(head);
+}
+
+static inline bool __qdf_llist_add(__qdf_llist_node_t *node,
+				   __qdf_llist_head_t *head)
+{
+	return llist_add(node, head);
+}
+
+static inline __qdf_llist_node_t *
+__qdf_llist_del_first(__qdf_llist_head_t *head)
+{
+	return llist_del_first(head);
+}
+
+static inline __qdf_llist_node_t *__qdf_llist_del_all(__qdf_llist_head_t *head)
+{
+	return llist_del_all(head);
+}
+
+static inline __qdf_llist_node_t *
+__qdf_llist_reverse_order(__qdf_llist_node_t *node)
+{
+	return llist_reverse_order(node);
+}
+
+static inline bool __qdf_llist_empty(const __qdf_llist_head_t *head)
+{
+	return llist_empty(head);
+}
+
+static inline __qdf_llist_node_t *__qdf_llist_next(__qdf_llist_node_t *node)
+{
+	return llist_next(node);
+}
 #endif
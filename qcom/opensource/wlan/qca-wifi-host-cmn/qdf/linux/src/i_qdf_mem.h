@@ -77,6 +77,24 @@ typedef struct mempool_elem {
 	STAILQ_ENTRY(mempool_elem) mempool_entry;
 } mempool_elem_t;
 
+/* Max free elements a per-CPU magazine holds */
+#define __QDF_MEMPOOL_MAG_SIZE 32
+/* Elements moved at once between a magazine and the pool free list */
+#define __QDF_MEMPOOL_MAG_BATCH 16
+
+/**
+ * struct __qdf_mempool_mag - per-CPU magazine of free pool elements
+ * @lock: lock for the magazine, only contended when elements are stolen
+ *	by another CPU
+ * @count: number of elements in @elem
+ * @elem: free elements, used as a stack
+ */
+struct __qdf_mempool_mag {
+	spinlock_t lock;
+	u_int32_t count;
+	void *elem[__QDF_MEMPOOL_MAG_SIZE];
+};
+
 /**
  * typedef __qdf_mempool_ctxt_t - Memory pool context
  * @pool_id: pool identifier
@@ -84,10 +102,11 @@ typedef struct mempool_elem {
  * @elem_size: size of each pool element in bytes
  * @pool_mem: pool_addr address of the pool created
  * @mem_size: Total size of the pool in bytes
+ * @mag: per-CPU magazines in front of @free_list
  * @free_list: free pool list
  * @lock: spinlock object
  * @max_elem: Maximum number of elements in tha pool
- * @free_cnt: Number of free elements available
+ * @free_cnt: Number of free elements available in @free_list
  */
 typedef struct __qdf_mempool_ctxt {
 	int pool_id;
@@ -95,8 +114,10 @@ typedef struct __qdf_mempool_ctxt {
 	size_t elem_size;
 	void *pool_mem;
 	u_int32_t mem_size;
+	struct __qdf_mempool_mag __percpu *mag;
 
-	STAILQ_HEAD(, mempool_elem) free_list;
+	/* shared by all CPUs, keep it off the read mostly fields above */
+	STAILQ_HEAD(, mempool_elem) free_list ____cacheline_aligned_in_smp;
 	spinlock_t lock;
 	u_int32_t max_elem;
 	u_int32_t free_cnt;
@@ -210,6 +231,10 @@ int __qdf_mempool_init(qdf_device_t osdev, __qdf_mempool_t *pool, int pool_cnt,
 void __qdf_mempool_destroy(qdf_device_t osdev, __qdf_mempool_t pool);
 void *__qdf_mempool_alloc(qdf_device_t osdev, __qdf_mempool_t pool);
 void __qdf_mempool_free(qdf_device_t osdev, __qdf_mempool_t pool, void *buf);
+int __qdf_mempool_alloc_bulk(qdf_device_t osdev, __qdf_mempool_t pool,
+			     void **elems, int count);
+void __qdf_mempool_free_bulk(qdf_device_t osdev, __qdf_mempool_t pool,
+			     void **elems, int count);
 #define QDF_RET_IP ((void *)_RET_IP_)
 
 #define __qdf_mempool_elem_size(_pool) ((_pool)->elem_size)
@@ -830,6 +830,7 @@ __qdf_nbuf_t __qdf_nbuf_alloc_no_recycler(size_t size, int reserve, int align,
 __qdf_nbuf_t __qdf_nbuf_clone(__qdf_nbuf_t nbuf);
 
 void __qdf_nbuf_free(struct sk_buff *skb);
+void __qdf_nbuf_list_consume(struct sk_buff *skb);
 QDF_STATUS __qdf_nbuf_map(__qdf_device_t osdev,
 			struct sk_buff *skb, qdf_dma_dir_t dir);
 void __qdf_nbuf_unmap(__qdf_device_t osdev,
@@ -1343,6 +1344,20 @@ static inline uint32_t __qdf_nbuf_get_priority(struct sk_buff *skb)
 	return skb->priority;
 }
 
+/**
+ * __qdf_nbuf_get_hash() - return the flow hash of the skb
+ * @skb: Pointer to network buffer
+ *
+ * The hash is computed from the packet headers and cached in the skb,
+ * if the stack has not set one already.
+ *
+ * Return: flow hash, 0 if the flow could not be dissected
+ */
+static inline uint32_t __qdf_nbuf_get_hash(struct sk_buff *skb)
+{
+	return skb_get_hash(skb);
+}
+
 /**
  * __qdf_nbuf_set_priority() - sets the priority value of the skb
  * @skb: Pointer to network buffer
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_rcu.h
+ * Linux-specific definitions for QDF read-copy-update APIs
+ */
+
+#ifndef __I_QDF_RCU_H
+#define __I_QDF_RCU_H
+
+#include <linux/rcupdate.h>
+#include <asm/barrier.h>
+
+typedef struct rcu_head __qdf_rcu_head_t;
+
+#define __qdf_rcu_read_lock() rcu_read_lock()
+#define __qdf_rcu_read_unlock() rcu_read_unlock()
+#define __qdf_call_rcu(head, func) call_rcu(head, func)
+#define __qdf_synchronize_rcu() synchronize_rcu()
+#define __qdf_rcu_barrier() rcu_barrier()
+#define __qdf_rcu_publish_barrier() smp_wmb()
+#define __qdf_rcu_read_ptr(ptr) READ_ONCE(ptr)
+
+#endif /* __I_QDF_RCU_H */
@@ -32,6 +32,7 @@
 #include "qdf_str.h"
 #include "qdf_talloc.h"
 #include <linux/debugfs.h>
+#include <linux/percpu.h>
 #include <linux/seq_file.h>
 #include <linux/string.h>
 #include <qdf_list.h>
@@ -1227,6 +1228,7 @@ int __qdf_mempool_init(qdf_device_t osdev, __qdf_mempool_t *pool_addr,
 	u_int32_t align = L1_CACHE_BYTES;
 	unsigned long aligned_pool_mem;
 	int pool_id;
+	int cpu;
 	int i;
 
 	if (prealloc_disabled) {
@@ -1279,11 +1281,24 @@ int __qdf_mempool_init(qdf_device_t osdev, __qdf_mempool_t *pool_addr,
 		return -ENOMEM;
 	}
 
+	new_pool->mag = alloc_percpu(struct __qdf_mempool_mag);
+	if (!new_pool->mag) {
+		kfree(new_pool->pool_mem);
+		kfree(new_pool);
+		osdev->mem_pool[pool_id] = NULL;
+		return -ENOMEM;
+	}
+
+	for_each_possible_cpu(cpu)
+		spin_lock_init(&per_cpu_ptr(new_pool->mag, cpu)->lock);
+
 	spin_lock_init(&new_pool->lock);
 
-	/* Initialize free list */
-	aligned_pool_mem = (unsigned long)(new_pool->pool_mem) +
-			((align) ? (unsigned long)(new_pool->pool_mem)%align:0);
+	/*
+	 * Initialize free list, with elements starting on a cache line so
+	 * that no two elements share one
+	 */
+	aligned_pool_mem = ALIGN((unsigned long)new_pool->pool_mem, align);
 	STAILQ_INIT(&new_pool->free_list);
 
 	for (i = 0; i < elem_cnt; i++)
@@ -1320,12 +1335,100 @@ void __qdf_mempool_destroy(qdf_device_t osdev, __qdf_mempool_t pool)
 	pool_id = pool->pool_id;
 
 	/* TBD: Check if free count matches elem_cnt if debug is enabled */
+	free_percpu(pool->mag);
 	kfree(pool->pool_mem);
 	kfree(pool);
 	osdev->mem_pool[pool_id] = NULL;
 }
 qdf_export_symbol(__qdf_mempool_destroy);
 
+/**
+ * __qdf_mempool_get() - take elements from the pool free list
+ * @pool: memory pool
+ * @elems: filled with the elements
+ * @count: max number of elements to take
+ *
+ * Context: BH disabled
+ * Return: number of elements taken
+ */
+static int __qdf_mempool_get(__qdf_mempool_t pool, void **elems, int count)
+{
+	mempool_elem_t *elem;
+	int num = 0;
+
+	spin_lock(&pool->lock);
+	while (num < count) {
+		elem = STAILQ_FIRST(&pool->free_list);
+		if (!elem)
+			break;
+
+		STAILQ_REMOVE_HEAD(&pool->free_list, mempool_entry);
+		elems[num++] = elem;
+	}
+	pool->free_cnt -= num;
+	spin_unlock(&pool->lock);
+
+	return num;
+}
+
+/**
+ * __qdf_mempool_put() - give elements back to the pool free list
+ * @pool: memory pool
+ * @elems: elements
+ * @count: number of elements
+ *
+ * Context: BH disabled
+ * Return: none
+ */
+static void __qdf_mempool_put(__qdf_mempool_t pool, void **elems, int count)
+{
+	int i;
+
+	spin_lock(&pool->lock);
+	for (i = 0; i < count; i++)
+		STAILQ_INSERT_TAIL(&pool->free_list,
+				   (mempool_elem_t *)elems[i], mempool_entry);
+	pool->free_cnt += count;
+	spin_unlock(&pool->lock);
+}
+
+/**
+ * __qdf_mempool_steal() - take elements from the magazines of other CPUs
+ * @pool: memory pool
+ * @own: magazine of the caller, not locked
+ * @elems: filled with the elements
+ * @count: max number of elements to take
+ *
+ * Used when the pool free list is empty, so that elements cached by other
+ * CPUs are not stranded there.
+ *
+ * Return: number of elements taken
+ */
+static int __qdf_mempool_steal(__qdf_mempool_t pool,
+			       struct __qdf_mempool_mag *own,
+			       void **elems, int count)
+{
+	struct __qdf_mempool_mag *mag;
+	int num = 0;
+	int cpu;
+
+	for_each_possible_cpu(cpu) {
+		mag = per_cpu_ptr(pool->mag, cpu);
+		if (mag == own)
+			continue;
+
+		spin_lock_bh(&mag->lock);
+		while (mag->count && num < count)
+			elems[num++] = mag->elem[--mag->count];
+		spin_unlock_bh(&mag->lock);
+
+		if (num == count)
+			break;
+	}
+
+	return num;
+}
+
 /**
  * __qdf_mempool_alloc() - Allocate an element memory pool
  *
@@ -1344,20 +1447,69 @@ void *__qdf_mempool_alloc(qdf_device_t osdev, __qdf_mempool_t pool)
 	if (prealloc_disabled)
 		return  qdf_mem_malloc(pool->elem_size);
 
-	spin_lock_bh(&pool->lock);
+	if (__qdf_mempool_alloc_bulk(osdev, pool, &buf, 1) != 1)
+		return NULL;
 
-	buf = STAILQ_FIRST(&pool->free_list);
-	if (buf) {
-		STAILQ_REMOVE_HEAD(&pool->free_list, mempool_entry);
-		pool->free_cnt--;
+	return buf;
+}
+qdf_export_symbol(__qdf_mempool_alloc);
+
+/**
+ * __qdf_mempool_alloc_bulk() - allocate several elements of a memory pool
+ * @osdev: platform device object
+ * @pool: handle to memory pool
+ * @elems: filled with the allocated elements
+ * @count: number of elements to allocate
+ *
+ * Elements come from the magazine of the current CPU, which is refilled
+ * from the pool free list in batches; only when both are empty are the
+ * magazines of the other CPUs looked at.
+ *
+ * Return: number of elements allocated, less than @count if the pool ran
+ * out of elements
+ */
+int __qdf_mempool_alloc_bulk(qdf_device_t osdev, __qdf_mempool_t pool,
+			     void **elems, int count)
+{
+	struct __qdf_mempool_mag *mag;
+	int num = 0;
+
+	if (!pool)
+		return 0;
+
+	if (prealloc_disabled) {
+		for (num = 0; num < count; num++) {
+			elems[num] = qdf_mem_malloc(pool->elem_size);
+			if (!elems[num])
+				break;
+		}
+
+		return num;
 	}
 
-	/* TBD: Update free count if debug is enabled */
-	spin_unlock_bh(&pool->lock);
+	mag = raw_cpu_ptr(pool->mag);
+	spin_lock_bh(&mag->lock);
 
-	return buf;
+	while (mag->count && num < count)
+		elems[num++] = mag->elem[--mag->count];
+
+	if (num < count) {
+		/* take what is missing at once, then top up the magazine */
+		num += __qdf_mempool_get(pool, &elems[num], count - num);
+		if (num == count)
+			mag->count = __qdf_mempool_get(pool, mag->elem,
+						       __QDF_MEMPOOL_MAG_BATCH);
+	}
+
+	spin_unlock_bh(&mag->lock);
+
+	if (num < count)
+		num += __qdf_mempool_steal(pool, mag, &elems[num],
+					   count - num);
+
+	return num;
 }
-qdf_export_symbol(__qdf_mempool_alloc);
+qdf_export_symbol(__qdf_mempool_alloc_bulk);
 
 /**
  * __qdf_mempool_free() - Free a memory pool element
@@ -1376,15 +1528,55 @@ void __qdf_mempool_free(qdf_device_t osdev, __qdf_mempool_t pool, void *buf)
 	if (prealloc_disabled)
 		return qdf_mem_free(buf);
 
-	spin_lock_bh(&pool->lock);
-	pool->free_cnt++;
-
-	STAILQ_INSERT_TAIL
-		(&pool->free_list, (mempool_elem_t *)buf, mempool_entry);
-	spin_unlock_bh(&pool->lock);
+	__qdf_mempool_free_bulk(osdev, pool, &buf, 1);
 }
 qdf_export_symbol(__qdf_mempool_free);
 
+/**
+ * __qdf_mempool_free_bulk() - free several memory pool elements
+ * @osdev: platform device object
+ * @pool: handle to memory pool
+ * @elems: elements to be freed
+ * @count: number of elements
+ *
+ * Elements go to the magazine of the current CPU; when it is full, a batch
+ * of them goes back to the pool free list.
+ *
+ * Return: none
+ */
+void __qdf_mempool_free_bulk(qdf_device_t osdev, __qdf_mempool_t pool,
+			     void **elems, int count)
+{
+	struct __qdf_mempool_mag *mag;
+	int num = 0;
+
+	if (!pool)
+		return;
+
+	if (prealloc_disabled) {
+		for (num = 0; num < count; num++)
+			qdf_mem_free(elems[num]);
+
+		return;
+	}
+
+	mag = raw_cpu_ptr(pool->mag);
+	spin_lock_bh(&mag->lock);
+
+	while (num < count) {
+		if (mag->count == __QDF_MEMPOOL_MAG_SIZE) {
+			mag->count -= __QDF_MEMPOOL_MAG_BATCH;
+			__qdf_mempool_put(pool, &mag->elem[mag->count],
+					  __QDF_MEMPOOL_MAG_BATCH);
+		}
+
+		mag->elem[mag->count++] = elems[num++];
+	}
+
+	spin_unlock_bh(&mag->lock);
+}
+qdf_export_symbol(__qdf_mempool_free_bulk);
+
 #ifdef CNSS_MEM_PRE_ALLOC
 static bool qdf_might_be_prealloc(void *ptr)
 {
@@ -131,6 +131,51 @@ static qdf_atomic_t nbuf_count;
 static bool is_initial_mem_debug_disabled;
 #endif
 
+#if defined(NBUF_MEMORY_DEBUG) && defined(NBUF_MEMORY_DEBUG_SAMPLE_SHIFT)
+#if NBUF_MEMORY_DEBUG_SAMPLE_SHIFT < 1 || NBUF_MEMORY_DEBUG_SAMPLE_SHIFT > 16
+#error "NBUF_MEMORY_DEBUG_SAMPLE_SHIFT must be in 1..16"
+#endif
+
+/* Picks the nbufs tracked, set once when nbuf debug is initialized */
+static uint32_t qdf_nbuf_sample_salt;
+
+/**
+ * qdf_net_buf_debug_sampling() - check if nbuf tracking is sampled
+ *
+ * Return: true
+ */
+static inline bool qdf_net_buf_debug_sampling(void)
+{
+	return true;
+}
+
+/**
+ * qdf_net_buf_debug_is_sampled() - check if an nbuf is tracked
+ * @net_buf: network buffer
+ *
+ * 1 in 2^NBUF_MEMORY_DEBUG_SAMPLE_SHIFT nbufs are tracked, picked by a hash
+ * of their address so that all the events of a given nbuf (alloc, map,
+ * unmap, free) agree on it without any state kept per nbuf.
+ *
+ * Return: true if @net_buf is tracked
+ */
+static inline bool qdf_net_buf_debug_is_sampled(qdf_nbuf_t net_buf)
+{
+	return !hash_32((uint32_t)((uintptr_t)net_buf >> 6) ^
+			qdf_nbuf_sample_salt, NBUF_MEMORY_DEBUG_SAMPLE_SHIFT);
+}
+#else
+static inline bool qdf_net_buf_debug_sampling(void)
+{
+	return false;
+}
+
+static inline bool qdf_net_buf_debug_is_sampled(qdf_nbuf_t net_buf)
+{
+	return true;
+}
+#endif /* NBUF_MEMORY_DEBUG_SAMPLE_SHIFT */
+
 /**
  *  __qdf_nbuf_get_ip_offset - Get IPV4/V6 header offset
  * @data: Pointer to network data buffer
@@ -727,6 +772,42 @@ void __qdf_nbuf_free(struct sk_buff *skb)
 
 qdf_export_symbol(__qdf_nbuf_free);
 
+/**
+ * __qdf_nbuf_list_consume() - free a list of successfully consumed nbufs
+ * @skb: head of a list of network buffers linked through skb->next
+ *
+ * Meant for tx completion: the buffers are released as consumed rather
+ * than dropped, and when serving a softirq they are returned through the
+ * per-CPU NAPI skb cache so they can be reused by the next allocation on
+ * this CPU instead of going back to the slab one by one. Process context
+ * with only bottom halves disabled must not touch that cache.
+ *
+ * Return: none
+ */
+void __qdf_nbuf_list_consume(struct sk_buff *skb)
+{
+	struct sk_buff *next;
+	int budget = in_serving_softirq() ? 1 : 0;
+
+	while (skb) {
+		next = skb->next;
+		skb->next = NULL;
+
+		if (!pld_nbuf_pre_alloc_free(skb)) {
+			qdf_nbuf_frag_count_dec(skb);
+			qdf_nbuf_count_dec(skb);
+			if (nbuf_free_cb)
+				nbuf_free_cb(skb);
+			else
+				napi_consume_skb(skb, budget);
+		}
+
+		skb = next;
+	}
+}
+
+qdf_export_symbol(__qdf_nbuf_list_consume);
+
 __qdf_nbuf_t __qdf_nbuf_clone(__qdf_nbuf_t skb)
 {
 	qdf_nbuf_t skb_new = NULL;
@@ -782,9 +863,15 @@ static void
 qdf_nbuf_history_add(qdf_nbuf_t nbuf, const char *func, uint32_t line,
 		     enum qdf_nbuf_event_type type)
 {
-	int32_t idx = qdf_nbuf_circular_index_next(&qdf_nbuf_history_index,
-						   QDF_NBUF_HISTORY_SIZE);
-	struct qdf_nbuf_event *event = &qdf_nbuf_history[idx];
+	int32_t idx;
+	struct qdf_nbuf_event *event;
+
+	if (nbuf && !qdf_net_buf_debug_is_sampled(nbuf))
+		return;
+
+	idx = qdf_nbuf_circular_index_next(&qdf_nbuf_history_index,
+					   QDF_NBUF_HISTORY_SIZE);
+	event = &qdf_nbuf_history[idx];
 
 	if (qdf_atomic_read(&smmu_crashed)) {
 		g_histroy_add_drop++;
@@ -829,7 +916,8 @@ static void qdf_nbuf_map_tracking_deinit(void)
 static QDF_STATUS
 qdf_nbuf_track_map(qdf_nbuf_t nbuf, const char *func, uint32_t line)
 {
-	if (is_initial_mem_debug_disabled)
+	if (is_initial_mem_debug_disabled ||
+	    !qdf_net_buf_debug_is_sampled(nbuf))
 		return QDF_STATUS_SUCCESS;
 
 	return qdf_tracker_track(&qdf_nbuf_map_tracker, nbuf, func, line);
@@ -838,7 +926,8 @@ qdf_nbuf_track_map(qdf_nbuf_t nbuf, const char *func, uint32_t line)
 static void
 qdf_nbuf_untrack_map(qdf_nbuf_t nbuf, const char *func, uint32_t line)
 {
-	if (is_initial_mem_debug_disabled)
+	if (is_initial_mem_debug_disabled ||
+	    !qdf_net_buf_debug_is_sampled(nbuf))
 		return;
 
 	qdf_nbuf_history_add(nbuf, func, line, QDF_NBUF_UNMAP);
@@ -1030,6 +1119,9 @@ static void qdf_nbuf_panic_on_free_if_mapped(qdf_nbuf_t nbuf,
 	char map_func[QDF_TRACKER_FUNC_SIZE];
 	uint32_t map_line;
 
+	if (!qdf_net_buf_debug_is_sampled(nbuf))
+		return;
+
 	if (!qdf_tracker_lookup(&qdf_nbuf_map_tracker, nbuf,
 				&map_func, &map_line))
 		return;
@@ -2641,6 +2733,292 @@ static void qdf_nbuf_track_memory_manager_destroy(void)
 	qdf_net_buf_track_free_list = NULL;
 }
 
+#ifdef NBUF_MEMORY_DEBUG_SAMPLE_SHIFT
+/*
+ * Sampled nbufs are tracked in per-CPU open addressing tables, indexed by
+ * the CPU the nbuf is allocated on. Slots are claimed and released with
+ * cmpxchg only, so tracking takes no lock and allocates no memory; an nbuf
+ * freed on another CPU is looked up in the other tables, which is cheap
+ * enough at the sampling rate. Released slots are left as tombstones so
+ * that probe sequences stay intact.
+ */
+#define QDF_NBUF_SAMPLE_CPUS 8
+#define QDF_NBUF_SAMPLE_TBL_BITS 9
+#define QDF_NBUF_SAMPLE_TBL_SIZE (1 << QDF_NBUF_SAMPLE_TBL_BITS)
+#define QDF_NBUF_SAMPLE_PROBES 16
+#define QDF_NBUF_SAMPLE_TOMBSTONE ((qdf_nbuf_t)1)
+
+/**
+ * struct qdf_nbuf_sample - tracking entry of a sampled nbuf
+ * @net_buf: tracked nbuf, NULL if the slot was never used or
+ *	QDF_NBUF_SAMPLE_TOMBSTONE if it was released
+ * @func_name: function which allocated or last owned the nbuf
+ * @line_num: line in @func_name
+ * @map_func_name: function which last mapped or unmapped the nbuf
+ * @map_line_num: line in @map_func_name
+ * @is_nbuf_mapped: nbuf is mapped
+ * @size: allocation size
+ * @time: allocation timestamp
+ */
+struct qdf_nbuf_sample {
+	qdf_nbuf_t net_buf;
+	const char *func_name;
+	uint32_t line_num;
+	const char *map_func_name;
+	uint32_t map_line_num;
+	bool is_nbuf_mapped;
+	size_t size;
+	uint64_t time;
+};
+
+static struct qdf_nbuf_sample
+qdf_nbuf_sample_tbl[QDF_NBUF_SAMPLE_CPUS][QDF_NBUF_SAMPLE_TBL_SIZE];
+static qdf_atomic_t qdf_nbuf_sample_count;
+static qdf_atomic_t qdf_nbuf_sample_drops;
+
+/**
+ * qdf_net_buf_sample_init() - reset the sampled nbuf tracking
+ *
+ * Return: none
+ */
+static void qdf_net_buf_sample_init(void)
+{
+	qdf_nbuf_sample_salt = (uint32_t)qdf_get_log_timestamp();
+	qdf_mem_zero(qdf_nbuf_sample_tbl, sizeof(qdf_nbuf_sample_tbl));
+	qdf_atomic_init(&qdf_nbuf_sample_count);
+	qdf_atomic_init(&qdf_nbuf_sample_drops);
+}
+
+/**
+ * qdf_net_buf_sample_find() - look up an nbuf in one sample table
+ * @tbl: sample table of a CPU
+ * @net_buf: network buffer
+ *
+ * Return: tracking entry, NULL if not found
+ */
+static struct qdf_nbuf_sample *
+qdf_net_buf_sample_find(struct qdf_nbuf_sample *tbl, qdf_nbuf_t net_buf)
+{
+	uint32_t idx = hash_ptr(net_buf, QDF_NBUF_SAMPLE_TBL_BITS);
+	qdf_nbuf_t key;
+	int probe;
+
+	for (probe = 0; probe < QDF_NBUF_SAMPLE_PROBES; probe++) {
+		key = READ_ONCE(tbl[idx].net_buf);
+		if (key == net_buf)
+			return &tbl[idx];
+		if (!key)
+			break;
+		idx = (idx + 1) & (QDF_NBUF_SAMPLE_TBL_SIZE - 1);
+	}
+
+	return NULL;
+}
+
+/**
+ * qdf_net_buf_sample_look_up() - look up a sampled nbuf in all the tables
+ * @net_buf: network buffer
+ *
+ * The table of the current CPU is searched first.
+ *
+ * Return: tracking entry, NULL if not found
+ */
+static struct qdf_nbuf_sample *qdf_net_buf_sample_look_up(qdf_nbuf_t net_buf)
+{
+	int this_cpu = qdf_get_cpu() % QDF_NBUF_SAMPLE_CPUS;
+	struct qdf_nbuf_sample *entry;
+	int cpu;
+
+	entry = qdf_net_buf_sample_find(qdf_nbuf_sample_tbl[this_cpu], net_buf);
+	for (cpu = 0; !entry && cpu < QDF_NBUF_SAMPLE_CPUS; cpu++) {
+		if (cpu == this_cpu)
+			continue;
+		entry = qdf_net_buf_sample_find(qdf_nbuf_sample_tbl[cpu],
+						net_buf);
+	}
+
+	return entry;
+}
+
+/**
+ * qdf_net_buf_sample_add() - start tracking a sampled nbuf
+ * @net_buf: network buffer
+ * @size: allocation size
+ * @func_name: allocating function
+ * @line_num: line in @func_name
+ *
+ * Return: none
+ */
+static void qdf_net_buf_sample_add(qdf_nbuf_t net_buf, size_t size,
+				   const char *func_name, uint32_t line_num)
+{
+	struct qdf_nbuf_sample *tbl =
+		qdf_nbuf_sample_tbl[qdf_get_cpu() % QDF_NBUF_SAMPLE_CPUS];
+	uint32_t idx = hash_ptr(net_buf, QDF_NBUF_SAMPLE_TBL_BITS);
+	qdf_nbuf_t key;
+	int probe;
+
+	for (probe = 0; probe < QDF_NBUF_SAMPLE_PROBES; probe++) {
+		key = READ_ONCE(tbl[idx].net_buf);
+		if ((!key || key == QDF_NBUF_SAMPLE_TOMBSTONE) &&
+		    cmpxchg(&tbl[idx].net_buf, key, net_buf) == key) {
+			tbl[idx].func_name = func_name;
+			tbl[idx].line_num = line_num;
+			tbl[idx].map_func_name = NULL;
+			tbl[idx].map_line_num = 0;
+			tbl[idx].is_nbuf_mapped = false;
+			tbl[idx].size = size;
+			tbl[idx].time = qdf_get_log_timestamp();
+			qdf_mem_skb_inc(size);
+			qdf_atomic_inc(&qdf_nbuf_sample_count);
+			return;
+		}
+		idx = (idx + 1) & (QDF_NBUF_SAMPLE_TBL_SIZE - 1);
+	}
+
+	/* untracked frees are only reported once tracking failed */
+	qdf_net_buf_track_fail_count++;
+	qdf_atomic_inc(&qdf_nbuf_sample_drops);
+}
+
+/**
+ * qdf_net_buf_sample_update() - update the owner of a sampled nbuf
+ * @net_buf: network buffer
+ * @func_name: new owner function
+ * @line_num: line in @func_name
+ *
+ * Return: none
+ */
+static void qdf_net_buf_sample_update(qdf_nbuf_t net_buf,
+				      const char *func_name, uint32_t line_num)
+{
+	struct qdf_nbuf_sample *entry = qdf_net_buf_sample_look_up(net_buf);
+
+	if (!entry)
+		return;
+
+	entry->func_name = func_name;
+	entry->line_num = line_num;
+}
+
+/**
+ * qdf_net_buf_sample_update_map() - record a map or unmap of a sampled nbuf
+ * @net_buf: network buffer
+ * @func_name: mapping or unmapping function
+ * @line_num: line in @func_name
+ * @mapped: true for a map, false for an unmap
+ *
+ * Return: none
+ */
+static void qdf_net_buf_sample_update_map(qdf_nbuf_t net_buf,
+					  const char *func_name,
+					  uint32_t line_num, bool mapped)
+{
+	struct qdf_nbuf_sample *entry = qdf_net_buf_sample_look_up(net_buf);
+
+	if (!entry)
+		return;
+
+	entry->map_func_name = func_name;
+	entry->map_line_num = line_num;
+	entry->is_nbuf_mapped = mapped;
+}
+
+/**
+ * qdf_net_buf_sample_delete() - stop tracking a sampled nbuf
+ * @net_buf: network buffer
+ *
+ * Return: none
+ */
+static void qdf_net_buf_sample_delete(qdf_nbuf_t net_buf)
+{
+	struct qdf_nbuf_sample *entry = qdf_net_buf_sample_look_up(net_buf);
+
+	if (!entry) {
+		if (qdf_net_buf_track_fail_count)
+			qdf_print("Untracked net_buf free: %pK with tracking failures count: %u",
+				  net_buf, qdf_net_buf_track_fail_count);
+		else
+			QDF_MEMDEBUG_PANIC("Unallocated buffer ! Double free of net_buf %pK ?",
+					   net_buf);
+		return;
+	}
+
+	qdf_mem_skb_dec(entry->size);
+	/* only the owner of the nbuf releases its entry */
+	smp_store_release(&entry->net_buf, QDF_NBUF_SAMPLE_TOMBSTONE);
+}
+
+/**
+ * qdf_net_buf_sample_check_for_leaks() - report the sampled nbufs not freed
+ *
+ * Return: number of leaked nbufs found
+ */
+static uint32_t qdf_net_buf_sample_check_for_leaks(void)
+{
+	struct qdf_nbuf_sample *entry;
+	uint32_t count = 0;
+	int cpu, idx;
+
+	for (cpu = 0; cpu < QDF_NBUF_SAMPLE_CPUS; cpu++) {
+		for (idx = 0; idx < QDF_NBUF_SAMPLE_TBL_SIZE; idx++) {
+			entry = &qdf_nbuf_sample_tbl[cpu][idx];
+			if (!entry->net_buf ||
+			    entry->net_buf == QDF_NBUF_SAMPLE_TOMBSTONE)
+				continue;
+
+			count++;
+			qdf_info("SKB buf memory Leak@ Func %s, @Line %d, size %zu, nbuf %pK",
+				 entry->func_name, entry->line_num,
+				 entry->size, entry->net_buf);
+			qdf_info("SKB leak last map/unmap %s, line %d mapped=%d",
+				 entry->map_func_name ? entry->map_func_name :
+				 "<none>", entry->map_line_num,
+				 entry->is_nbuf_mapped);
+		}
+	}
+
+	qdf_info("Tracked 1 in %u nbufs: %d sampled, %d not tracked (table full), %u leaked",
+		 1 << NBUF_MEMORY_DEBUG_SAMPLE_SHIFT,
+		 qdf_atomic_read(&qdf_nbuf_sample_count),
+		 qdf_atomic_read(&qdf_nbuf_sample_drops), count);
+
+	return count;
+}
+#else
+static inline void qdf_net_buf_sample_init(void)
+{
+}
+
+static inline void qdf_net_buf_sample_add(qdf_nbuf_t net_buf, size_t size,
+					  const char *func_name,
+					  uint32_t line_num)
+{
+}
+
+static inline void qdf_net_buf_sample_update(qdf_nbuf_t net_buf,
+					     const char *func_name,
+					     uint32_t line_num)
+{
+}
+
+static inline void qdf_net_buf_sample_update_map(qdf_nbuf_t net_buf,
+						 const char *func_name,
+						 uint32_t line_num,
+						 bool mapped)
+{
+}
+
+static inline void qdf_net_buf_sample_delete(qdf_nbuf_t net_buf)
+{
+}
+
+static inline uint32_t qdf_net_buf_sample_check_for_leaks(void)
+{
+	return 0;
+}
+#endif /* NBUF_MEMORY_DEBUG_SAMPLE_SHIFT */
+
 /**
  * qdf_net_buf_debug_init() - initialize network buffer debug functionality
  *
@@ -2650,6 +3028,11 @@ static void qdf_nbuf_track_memory_manager_destroy(void)
  * suppose to call qdf_net_buf_debug_release_skb() such that the SKB is not
  * reported as memory leak.
  *
+ * With NBUF_MEMORY_DEBUG_SAMPLE_SHIFT only a sample of the SKBs is tracked,
+ * along with their history and map/unmap events, which keeps the overhead
+ * low enough to reproduce throughput dependent leaks; leaks are then caught
+ * statistically.
+ *
  * Return: none
  */
 void qdf_net_buf_debug_init(void)
@@ -2663,6 +3046,7 @@ void qdf_net_buf_debug_init(void)
 
 	qdf_atomic_set(&qdf_nbuf_history_index, -1);
 
+	qdf_net_buf_sample_init();
 	qdf_nbuf_map_tracking_init();
 	qdf_nbuf_track_memory_manager_create();
 
@@ -2714,6 +3098,8 @@ void qdf_net_buf_debug_exit(void)
 		spin_unlock_irqrestore(&g_qdf_net_buf_track_lock[i], irq_flag);
 	}
 
+	count += qdf_net_buf_sample_check_for_leaks();
+
 	qdf_nbuf_track_memory_manager_destroy();
 	qdf_nbuf_map_tracking_deinit();
 
@@ -2781,6 +3167,14 @@ void qdf_net_buf_debug_add_node(qdf_nbuf_t net_buf, size_t size,
 	if (is_initial_mem_debug_disabled)
 		return;
 
+	if (!qdf_net_buf_debug_is_sampled(net_buf))
+		return;
+
+	if (qdf_net_buf_debug_sampling()) {
+		qdf_net_buf_sample_add(net_buf, size, func_name, line_num);
+		return;
+	}
+
 	new_node = qdf_nbuf_track_alloc();
 
 	i = qdf_net_buf_debug_hash(net_buf);
@@ -2832,6 +3226,14 @@ void qdf_net_buf_debug_update_node(qdf_nbuf_t net_buf, const char *func_name,
 	if (is_initial_mem_debug_disabled)
 		return;
 
+	if (!qdf_net_buf_debug_is_sampled(net_buf))
+		return;
+
+	if (qdf_net_buf_debug_sampling()) {
+		qdf_net_buf_sample_update(net_buf, func_name, line_num);
+		return;
+	}
+
 	i = qdf_net_buf_debug_hash(net_buf);
 	spin_lock_irqsave(&g_qdf_net_buf_track_lock[i], irq_flag);
 
@@ -2859,6 +3261,15 @@ void qdf_net_buf_debug_update_map_node(qdf_nbuf_t net_buf,
 	if (is_initial_mem_debug_disabled)
 		return;
 
+	if (!qdf_net_buf_debug_is_sampled(net_buf))
+		return;
+
+	if (qdf_net_buf_debug_sampling()) {
+		qdf_net_buf_sample_update_map(net_buf, func_name, line_num,
+					      true);
+		return;
+	}
+
 	i = qdf_net_buf_debug_hash(net_buf);
 	spin_lock_irqsave(&g_qdf_net_buf_track_lock[i], irq_flag);
 
@@ -2884,6 +3295,15 @@ void qdf_net_buf_debug_update_unmap_node(qdf_nbuf_t net_buf,
 	if (is_initial_mem_debug_disabled)
 		return;
 
+	if (!qdf_net_buf_debug_is_sampled(net_buf))
+		return;
+
+	if (qdf_net_buf_debug_sampling()) {
+		qdf_net_buf_sample_update_map(net_buf, func_name, line_num,
+					      false);
+		return;
+	}
+
 	i = qdf_net_buf_debug_hash(net_buf);
 	spin_lock_irqsave(&g_qdf_net_buf_track_lock[i], irq_flag);
 
@@ -2914,6 +3334,14 @@ void qdf_net_buf_debug_delete_node(qdf_nbuf_t net_buf)
 	if (is_initial_mem_debug_disabled)
 		return;
 
+	if (!qdf_net_buf_debug_is_sampled(net_buf))
+		return;
+
+	if (qdf_net_buf_debug_sampling()) {
+		qdf_net_buf_sample_delete(net_buf);
+		return;
+	}
+
 	i = qdf_net_buf_debug_hash(net_buf);
 	spin_lock_irqsave(&g_qdf_net_buf_track_lock[i], irq_flag);
 
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_mem.h"
+#include "qdf_module.h"
+#include "qdf_ptr_rhash.h"
+#include "qdf_trace.h"
+
+#define qdf_ptr_rhash_tbl_size(tbl) ((uint32_t)1 << (tbl)->bits)
+
+static struct qdf_ptr_rhash_table *
+qdf_ptr_rhash_tbl_alloc(struct qdf_ptr_rhash *ht, uint8_t bits, uint8_t link)
+{
+	struct qdf_ptr_rhash_table *tbl;
+
+	/* called under the table spinlock once the table is in use */
+	tbl = qdf_mem_malloc_atomic(sizeof(*tbl) +
+				    sizeof(tbl->buckets[0]) * (1 << bits));
+	if (!tbl)
+		return NULL;
+
+	tbl->ht = ht;
+	tbl->bits = bits;
+	tbl->link = link;
+
+	return tbl;
+}
+
+static void qdf_ptr_rhash_tbl_retire(qdf_rcu_head_t *rcu)
+{
+	struct qdf_ptr_rhash_table *tbl =
+		qdf_container_of(rcu, struct qdf_ptr_rhash_table, rcu);
+
+	/* no lookup can walk the link of @tbl anymore, it can be reused */
+	qdf_atomic_set(&tbl->ht->retiring, 0);
+	qdf_mem_free(tbl);
+}
+
+struct qdf_ptr_rhash *qdf_ptr_rhash_create(uint8_t min_bits, uint8_t max_bits)
+{
+	struct qdf_ptr_rhash *ht;
+
+	QDF_BUG(min_bits <= max_bits);
+	if (min_bits > max_bits)
+		return NULL;
+
+	ht = qdf_mem_malloc(sizeof(*ht));
+	if (!ht)
+		return NULL;
+
+	ht->tbl = qdf_ptr_rhash_tbl_alloc(ht, min_bits, 0);
+	if (!ht->tbl) {
+		qdf_mem_free(ht);
+		return NULL;
+	}
+
+	ht->min_bits = min_bits;
+	ht->max_bits = max_bits;
+	qdf_atomic_init(&ht->retiring);
+	qdf_spinlock_create(&ht->lock);
+
+	return ht;
+}
+qdf_export_symbol(qdf_ptr_rhash_create);
+
+void qdf_ptr_rhash_destroy(struct qdf_ptr_rhash *ht)
+{
+	QDF_BUG(!ht->count);
+
+	/* the callback freeing the last replaced table still uses @ht */
+	if (qdf_atomic_read(&ht->retiring))
+		qdf_rcu_barrier();
+
+	qdf_spinlock_destroy(&ht->lock);
+	if (ht->new_tbl)
+		qdf_mem_free(ht->new_tbl);
+	qdf_mem_free(ht->tbl);
+	qdf_mem_free(ht);
+}
+qdf_export_symbol(qdf_ptr_rhash_destroy);
+
+static inline uint32_t qdf_ptr_rhash_bucket(struct qdf_ptr_rhash_table *tbl,
+					    uintptr_t key)
+{
+	return __qdf_ptr_hash_key(key, tbl->bits);
+}
+
+static void qdf_ptr_rhash_link(struct qdf_ptr_rhash_table *tbl,
+			       struct qdf_ptr_rhash_entry *entry)
+{
+	struct qdf_ptr_rhash_entry **head =
+		&tbl->buckets[qdf_ptr_rhash_bucket(tbl, entry->key)];
+
+	entry->next[tbl->link] = *head;
+	/* lookups must see the entry fully linked once it is reachable */
+	qdf_rcu_publish_barrier();
+	*head = entry;
+}
+
+static void qdf_ptr_rhash_unlink(struct qdf_ptr_rhash_table *tbl,
+				 struct qdf_ptr_rhash_entry **pprev)
+{
+	/* lookups on the entry can still move on to the rest of the chain */
+	*pprev = (*pprev)->next[tbl->link];
+}
+
+/**
+ * qdf_ptr_rhash_rehashed() - check if a key has been moved to @ht->new_tbl
+ * @ht: the qdf_ptr_rhash
+ * @key: the key to check
+ *
+ * Return: true if entries of @key have to be linked into both tables
+ */
+static bool qdf_ptr_rhash_rehashed(struct qdf_ptr_rhash *ht, uintptr_t key)
+{
+	return ht->new_tbl &&
+	       qdf_ptr_rhash_bucket(ht->tbl, key) < ht->rehash_pos;
+}
+
+/**
+ * qdf_ptr_rhash_target_bits() - table size the load factor asks for
+ * @ht: the qdf_ptr_rhash
+ *
+ * Once out of bounds, the load factor is brought back under
+ * QDF_PTR_RHASH_MAX_LOAD in one rehash, however far it drifted while a
+ * replaced table was waiting for a grace period.
+ *
+ * Return: the number of bits the table should use
+ */
+static uint8_t qdf_ptr_rhash_target_bits(struct qdf_ptr_rhash *ht)
+{
+	uint64_t load = (uint64_t)ht->count * 100;
+	uint64_t size = qdf_ptr_rhash_tbl_size(ht->tbl);
+	uint8_t bits;
+
+	if (load <= size * QDF_PTR_RHASH_MAX_LOAD &&
+	    load >= size * QDF_PTR_RHASH_MIN_LOAD)
+		return ht->tbl->bits;
+
+	for (bits = ht->min_bits; bits < ht->max_bits; bits++) {
+		if (load <= ((uint64_t)1 << bits) * QDF_PTR_RHASH_MAX_LOAD)
+			break;
+	}
+
+	return bits;
+}
+
+/**
+ * qdf_ptr_rhash_rehash_step() - advance the incremental rehash
+ * @ht: the qdf_ptr_rhash, locked
+ *
+ * Starts a rehash if the load factor is out of bounds, moves the next
+ * QDF_PTR_RHASH_REHASH_STEP buckets of the current table to the new one,
+ * and switches lookups to the new table once all buckets are moved.
+ *
+ * Return: None
+ */
+static void qdf_ptr_rhash_rehash_step(struct qdf_ptr_rhash *ht)
+{
+	struct qdf_ptr_rhash_table *tbl = ht->tbl;
+	struct qdf_ptr_rhash_entry *entry;
+	uint8_t bits;
+	int i;
+
+	if (!ht->new_tbl) {
+		bits = qdf_ptr_rhash_target_bits(ht);
+		if (bits == tbl->bits || qdf_atomic_read(&ht->retiring))
+			return;
+
+		/* on failure, retry on the next add/remove */
+		ht->new_tbl = qdf_ptr_rhash_tbl_alloc(ht, bits, !tbl->link);
+		if (!ht->new_tbl)
+			return;
+
+		ht->rehash_pos = 0;
+	}
+
+	for (i = 0; i < QDF_PTR_RHASH_REHASH_STEP &&
+		    ht->rehash_pos < qdf_ptr_rhash_tbl_size(tbl); i++) {
+		for (entry = tbl->buckets[ht->rehash_pos]; entry;
+		     entry = entry->next[tbl->link])
+			qdf_ptr_rhash_link(ht->new_tbl, entry);
+		ht->rehash_pos++;
+	}
+
+	if (ht->rehash_pos < qdf_ptr_rhash_tbl_size(tbl))
+		return;
+
+	/* the new table is complete, hand it over to lookups */
+	qdf_rcu_publish_barrier();
+	ht->tbl = ht->new_tbl;
+	ht->new_tbl = NULL;
+	ht->resizes++;
+
+	qdf_atomic_set(&ht->retiring, 1);
+	qdf_call_rcu(&tbl->rcu, qdf_ptr_rhash_tbl_retire);
+}
+
+void __qdf_ptr_rhash_add(struct qdf_ptr_rhash *ht, uintptr_t key,
+			 struct qdf_ptr_rhash_entry *entry)
+{
+	qdf_spin_lock_bh(&ht->lock);
+
+	entry->key = key;
+	if (qdf_ptr_rhash_rehashed(ht, key))
+		qdf_ptr_rhash_link(ht->new_tbl, entry);
+	qdf_ptr_rhash_link(ht->tbl, entry);
+	ht->count++;
+
+	qdf_ptr_rhash_rehash_step(ht);
+
+	qdf_spin_unlock_bh(&ht->lock);
+}
+qdf_export_symbol(__qdf_ptr_rhash_add);
+
+struct qdf_ptr_rhash_entry *
+__qdf_ptr_rhash_remove(struct qdf_ptr_rhash *ht, uintptr_t key)
+{
+	struct qdf_ptr_rhash_table *tbl;
+	struct qdf_ptr_rhash_entry **pprev;
+	struct qdf_ptr_rhash_entry *entry = NULL;
+
+	qdf_spin_lock_bh(&ht->lock);
+
+	tbl = ht->tbl;
+	for (pprev = &tbl->buckets[qdf_ptr_rhash_bucket(tbl, key)]; *pprev;
+	     pprev = &(*pprev)->next[tbl->link]) {
+		if ((*pprev)->key == key) {
+			entry = *pprev;
+			qdf_ptr_rhash_unlink(tbl, pprev);
+			break;
+		}
+	}
+
+	if (!entry)
+		goto unlock;
+
+	/* the new table may chain entries of the same key in another order */
+	if (qdf_ptr_rhash_rehashed(ht, key)) {
+		tbl = ht->new_tbl;
+		pprev = &tbl->buckets[qdf_ptr_rhash_bucket(tbl, key)];
+		while (*pprev != entry)
+			pprev = &(*pprev)->next[tbl->link];
+		qdf_ptr_rhash_unlink(tbl, pprev);
+	}
+
+	ht->count--;
+	qdf_ptr_rhash_rehash_step(ht);
+
+unlock:
+	qdf_spin_unlock_bh(&ht->lock);
+
+	return entry;
+}
+qdf_export_symbol(__qdf_ptr_rhash_remove);
+
+void qdf_ptr_rhash_get_stats(struct qdf_ptr_rhash *ht,
+			     struct qdf_ptr_hash_stats *stats)
+{
+	struct qdf_ptr_rhash_table *tbl;
+	struct qdf_ptr_rhash_entry *entry;
+	uint32_t bucket;
+	uint32_t len;
+
+	qdf_mem_zero(stats, sizeof(*stats));
+
+	qdf_spin_lock_bh(&ht->lock);
+
+	tbl = ht->tbl;
+	for (bucket = 0; bucket < qdf_ptr_rhash_tbl_size(tbl); bucket++) {
+		len = 0;
+		for (entry = tbl->buckets[bucket]; entry;
+		     entry = entry->next[tbl->link])
+			len++;
+		qdf_ptr_hash_stats_add_chain(stats, len);
+	}
+	stats->resizes = ht->resizes;
+
+	qdf_spin_unlock_bh(&ht->lock);
+}
+qdf_export_symbol(qdf_ptr_rhash_get_stats);
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: qdf_test_host.c
+ * Runs the qdf unit tests and benchmarks as a userspace program.
+ *
+ * Usage: qdf_test_host [-v] [-l] [all | <test>...]
+ *
+ * A test fails if it returns errors or hits a QDF_BUG() on the way, which
+ * on the host is counted instead of crashing. The exit status is 0 only if
+ * every selected test passed.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "qdf_types.h"
+#include "hal_srng_sim_test.h"
+#include "qdf_bench_test.h"
+#include "qdf_delayed_work_test.h"
+#include "qdf_hashtable_test.h"
+#include "qdf_periodic_work_test.h"
+#include "qdf_ptr_hash_test.h"
+#include "qdf_rcu_test.h"
+#include "qdf_slist_test.h"
+#include "qdf_str.h"
+#include "qdf_talloc.h"
+#include "qdf_talloc_test.h"
+#include "qdf_trace.h"
+#include "qdf_tracker_test.h"
+#include "qdf_types_test.h"
+
+typedef uint32_t (*qdf_ut_callback)(void);
+
+struct qdf_ut_entry {
+	const qdf_ut_callback callback;
+	const char *name;
+};
+
+static const struct qdf_ut_entry qdf_ut_entries[] = {
+	{ .name = "qdf_delayed_work", .callback = qdf_delayed_work_unit_test },
+	{ .name = "qdf_ht", .callback = qdf_ht_unit_test },
+	{ .name = "qdf_periodic_work",
+	  .callback = qdf_periodic_work_unit_test },
+	{ .name = "qdf_ptr_hash", .callback = qdf_ptr_hash_unit_test },
+	{ .name = "qdf_rcu", .callback = qdf_rcu_unit_test },
+	{ .name = "qdf_slist", .callback = qdf_slist_unit_test },
+	{ .name = "qdf_talloc", .callback = qdf_talloc_unit_test },
+	{ .name = "qdf_tracker", .callback = qdf_tracker_unit_test },
+	{ .name = "qdf_types", .callback = qdf_types_unit_test },
+	{ .name = "hal_srng_sim", .callback = hal_srng_sim_unit_test },
+	{ .name = "qdf_bench", .callback = qdf_bench_unit_test },
+};
+
+#define qdf_for_each_ut_entry(cursor) \
+	for (cursor = qdf_ut_entries; \
+	     cursor < qdf_ut_entries + QDF_ARRAY_SIZE(qdf_ut_entries); \
+	     cursor++)
+
+static const struct qdf_ut_entry *qdf_ut_lookup(const char *name)
+{
+	const struct qdf_ut_entry *entry;
+
+	qdf_for_each_ut_entry(entry) {
+		if (qdf_str_eq(entry->name, name))
+			return entry;
+	}
+
+	return NULL;
+}
+
+static uint32_t qdf_ut_single(const struct qdf_ut_entry *entry)
+{
+	uint32_t bugs = __qdf_bug_count();
+	uint32_t errors;
+
+	qdf_nofl_info("START: '%s'", entry->name);
+
+	errors = entry->callback();
+	errors += __qdf_bug_count() - bugs;
+	if (errors)
+		qdf_nofl_err("FAIL: '%s' with %u errors", entry->name, errors);
+	else
+		qdf_nofl_info("PASS: '%s'", entry->name);
+
+	return errors;
+}
+
+static void qdf_ut_usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s [-v] [-l] [all | <test>...]\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+	const struct qdf_ut_entry *entry;
+	uint32_t failed = 0;
+	int opt;
+	int i;
+
+	while ((opt = getopt(argc, argv, "lvh")) != -1) {
+		switch (opt) {
+		case 'l':
+			qdf_for_each_ut_entry(entry)
+				printf("%s\n", entry->name);
+			return 0;
+		case 'v':
+			qdf_host_trace_set_level(QDF_TRACE_LEVEL_DEBUG);
+			break;
+		default:
+			qdf_ut_usage(argv[0]);
+			return opt == 'h' ? 0 : 2;
+		}
+	}
+
+	/* resolve all names first, a typo should not cost a full run */
+	for (i = optind; i < argc; i++) {
+		if (!qdf_str_eq(argv[i], "all") && !qdf_ut_lookup(argv[i])) {
+			qdf_nofl_err("Unit test '%s' not found", argv[i]);
+			return 2;
+		}
+	}
+
+	/* what qdf_mod_init() sets up for the features under test */
+	qdf_talloc_feature_init();
+
+	if (optind == argc || (optind == argc - 1 &&
+			       qdf_str_eq(argv[optind], "all"))) {
+		qdf_for_each_ut_entry(entry)
+			failed += !!qdf_ut_single(entry);
+	} else {
+		for (i = optind; i < argc; i++)
+			failed += !!qdf_ut_single(qdf_ut_lookup(argv[i]));
+	}
+
+	qdf_talloc_feature_deinit();
+
+	if (failed)
+		qdf_nofl_err("%u unit tests failed", failed);
+	else
+		qdf_nofl_info("Unit tests complete");
+
+	return failed ? 1 : 0;
+}
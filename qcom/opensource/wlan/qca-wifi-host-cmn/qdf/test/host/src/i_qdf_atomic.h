@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_atomic.h
+ * Userspace (host test build) atomic API, on top of the GCC __atomic
+ * builtins. All operations are sequentially consistent, which is at least
+ * as strong as what the kernel primitives guarantee.
+ */
+
+#ifndef I_QDF_ATOMIC_H
+#define I_QDF_ATOMIC_H
+
+#include <qdf_status.h>         /* QDF_STATUS */
+#include <stdbool.h>
+#include <stdint.h>
+
+#define __QDF_BITS_PER_LONG (8 * sizeof(unsigned long))
+#define __QDF_BIT_WORD(nr) ((nr) / __QDF_BITS_PER_LONG)
+#define __QDF_BIT_MASK(nr) (1UL << ((nr) % __QDF_BITS_PER_LONG))
+
+typedef struct {
+	int counter;
+} __qdf_atomic_t;
+
+static inline QDF_STATUS __qdf_atomic_init(__qdf_atomic_t *v)
+{
+	__atomic_store_n(&v->counter, 0, __ATOMIC_SEQ_CST);
+	return QDF_STATUS_SUCCESS;
+}
+
+static inline int32_t __qdf_atomic_read(__qdf_atomic_t *v)
+{
+	return __atomic_load_n(&v->counter, __ATOMIC_SEQ_CST);
+}
+
+static inline void __qdf_atomic_inc(__qdf_atomic_t *v)
+{
+	__atomic_add_fetch(&v->counter, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline void __qdf_atomic_dec(__qdf_atomic_t *v)
+{
+	__atomic_sub_fetch(&v->counter, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline void __qdf_atomic_add(int i, __qdf_atomic_t *v)
+{
+	__atomic_add_fetch(&v->counter, i, __ATOMIC_SEQ_CST);
+}
+
+static inline void __qdf_atomic_sub(int i, __qdf_atomic_t *v)
+{
+	__atomic_sub_fetch(&v->counter, i, __ATOMIC_SEQ_CST);
+}
+
+static inline int32_t __qdf_atomic_dec_and_test(__qdf_atomic_t *v)
+{
+	return !__atomic_sub_fetch(&v->counter, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline void __qdf_atomic_set(__qdf_atomic_t *v, int i)
+{
+	__atomic_store_n(&v->counter, i, __ATOMIC_SEQ_CST);
+}
+
+static inline int32_t __qdf_atomic_inc_return(__qdf_atomic_t *v)
+{
+	return __atomic_add_fetch(&v->counter, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline int32_t __qdf_atomic_dec_return(__qdf_atomic_t *v)
+{
+	return __atomic_sub_fetch(&v->counter, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline int32_t __qdf_atomic_cmpxchg(__qdf_atomic_t *v, int32_t old,
+					   int32_t new)
+{
+	__atomic_compare_exchange_n(&v->counter, &old, new, false,
+				    __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+	return old;
+}
+
+static inline int32_t __qdf_atomic_inc_not_zero(__qdf_atomic_t *v)
+{
+	int32_t old = __qdf_atomic_read(v);
+
+	while (old) {
+		if (__atomic_compare_exchange_n(&v->counter, &old, old + 1,
+						false, __ATOMIC_SEQ_CST,
+						__ATOMIC_SEQ_CST))
+			return 1;
+	}
+
+	return 0;
+}
+
+static inline void __qdf_atomic_set_bit(int nr, volatile unsigned long *addr)
+{
+	__atomic_or_fetch(&addr[__QDF_BIT_WORD(nr)], __QDF_BIT_MASK(nr),
+			  __ATOMIC_SEQ_CST);
+}
+
+static inline void __qdf_atomic_clear_bit(int nr, volatile unsigned long *addr)
+{
+	__atomic_and_fetch(&addr[__QDF_BIT_WORD(nr)], ~__QDF_BIT_MASK(nr),
+			   __ATOMIC_SEQ_CST);
+}
+
+static inline void __qdf_atomic_change_bit(int nr, volatile unsigned long *addr)
+{
+	__atomic_xor_fetch(&addr[__QDF_BIT_WORD(nr)], __QDF_BIT_MASK(nr),
+			   __ATOMIC_SEQ_CST);
+}
+
+static inline int __qdf_atomic_test_and_set_bit(int nr,
+						volatile unsigned long *addr)
+{
+	return !!(__atomic_fetch_or(&addr[__QDF_BIT_WORD(nr)],
+				    __QDF_BIT_MASK(nr), __ATOMIC_SEQ_CST) &
+		  __QDF_BIT_MASK(nr));
+}
+
+static inline int __qdf_atomic_test_and_clear_bit(int nr,
+						  volatile unsigned long *addr)
+{
+	return !!(__atomic_fetch_and(&addr[__QDF_BIT_WORD(nr)],
+				     ~__QDF_BIT_MASK(nr), __ATOMIC_SEQ_CST) &
+		  __QDF_BIT_MASK(nr));
+}
+
+static inline int __qdf_atomic_test_and_change_bit(int nr,
+						   volatile unsigned long *addr)
+{
+	return !!(__atomic_fetch_xor(&addr[__QDF_BIT_WORD(nr)],
+				     __QDF_BIT_MASK(nr), __ATOMIC_SEQ_CST) &
+		  __QDF_BIT_MASK(nr));
+}
+
+static inline int __qdf_atomic_test_bit(int nr, volatile unsigned long *addr)
+{
+	return !!(__atomic_load_n(&addr[__QDF_BIT_WORD(nr)],
+				  __ATOMIC_SEQ_CST) & __QDF_BIT_MASK(nr));
+}
+
+#endif
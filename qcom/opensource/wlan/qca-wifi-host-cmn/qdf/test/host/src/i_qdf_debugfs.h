@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_debugfs.h
+ * Userspace (host test build) debugfs types. WLAN_DEBUGFS is never set for
+ * the host build, so only the types are needed.
+ */
+
+#ifndef _I_QDF_DEBUGFS_H
+#define _I_QDF_DEBUGFS_H
+
+typedef struct dentry *__qdf_dentry_t;
+typedef struct seq_file *__qdf_debugfs_file_t;
+typedef struct debugfs_blob_wrapper *__qdf_debugfs_blob_wrap_t;
+typedef void *__qdf_entry_t;
+typedef const struct file_operations *__qdf_file_ops_t;
+
+#endif /* _I_QDF_DEBUGFS_H */
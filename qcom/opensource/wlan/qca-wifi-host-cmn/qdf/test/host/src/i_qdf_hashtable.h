@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_hashtable.h
+ * Userspace (host test build) hashtable, with the same layout and bucket
+ * selection as the kernel's linux/hashtable.h.
+ */
+
+#ifndef __I_QDF_HASHTABLE_H
+#define __I_QDF_HASHTABLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "i_qdf_ptr_hash.h"
+
+struct hlist_node {
+	struct hlist_node *next;
+	struct hlist_node **pprev;
+};
+
+struct hlist_head {
+	struct hlist_node *first;
+};
+
+static inline void __qdf_hlist_add_head(struct hlist_node *n,
+					struct hlist_head *h)
+{
+	n->next = h->first;
+	if (h->first)
+		h->first->pprev = &n->next;
+	h->first = n;
+	n->pprev = &h->first;
+}
+
+static inline void __qdf_hlist_del_init(struct hlist_node *n)
+{
+	if (!n->pprev)
+		return;
+
+	*n->pprev = n->next;
+	if (n->next)
+		n->next->pprev = n->pprev;
+	n->next = NULL;
+	n->pprev = NULL;
+}
+
+#define __qdf_hlist_entry_safe(ptr, type, member) \
+	({ typeof(ptr) ____ptr = (ptr); \
+	   ____ptr ? container_of(____ptr, type, member) : NULL; })
+
+#define __qdf_hlist_for_each_entry(pos, head, member) \
+	for (pos = __qdf_hlist_entry_safe((head)->first, typeof(*(pos)), \
+					  member); \
+	     pos; \
+	     pos = __qdf_hlist_entry_safe((pos)->member.next, \
+					  typeof(*(pos)), member))
+
+#define __qdf_hlist_for_each_entry_safe(pos, n, head, member) \
+	for (pos = __qdf_hlist_entry_safe((head)->first, typeof(*pos), \
+					  member); \
+	     pos && ({ n = pos->member.next; 1; }); \
+	     pos = __qdf_hlist_entry_safe(n, typeof(*pos), member))
+
+#define __QDF_HASH_SIZE(table) (sizeof(table) / sizeof((table)[0]))
+#define __QDF_HASH_BITS(table) __builtin_ctz(__QDF_HASH_SIZE(table))
+#define __qdf_hash_min(val, bits) \
+	(sizeof(val) <= 4 ? __qdf_hash_32(val, bits) : \
+			    __qdf_hash_long(val, bits))
+
+#define __qdf_ht hlist_head
+#define __qdf_ht_entry hlist_node
+#define __qdf_ht_declare(name, bits) struct hlist_head name[1 << (bits)]
+
+#define __qdf_ht_init(table) \
+do { \
+	unsigned int __i; \
+	for (__i = 0; __i < __QDF_HASH_SIZE(table); __i++) \
+		(table)[__i].first = NULL; \
+} while (false)
+
+#define __qdf_ht_deinit(table) do { } while (false)
+
+#define __qdf_ht_empty(table) \
+	({ \
+		unsigned int __i; \
+		bool __empty = true; \
+		for (__i = 0; __i < __QDF_HASH_SIZE(table); __i++) \
+			if ((table)[__i].first) \
+				__empty = false; \
+		__empty; \
+	})
+
+#define __qdf_ht_add(table, entry, key) \
+	__qdf_hlist_add_head(entry, \
+			     &(table)[__qdf_hash_min(key, \
+						     __QDF_HASH_BITS(table))])
+
+#define __qdf_ht_remove(entry) __qdf_hlist_del_init(entry)
+
+#define __qdf_ht_for_each(table, i, cursor, entry_field) \
+	for ((i) = 0, cursor = NULL; \
+	     !cursor && (i) < __QDF_HASH_SIZE(table); (i)++) \
+		__qdf_hlist_for_each_entry(cursor, &(table)[i], entry_field)
+
+#define __qdf_ht_for_each_in_bucket(table, cursor, entry_field, key) \
+	__qdf_hlist_for_each_entry(cursor, \
+		&(table)[__qdf_hash_min(key, __QDF_HASH_BITS(table))], \
+		entry_field)
+
+#define __qdf_ht_for_each_match(table, cursor, entry_field, key, key_field) \
+	__qdf_ht_for_each_in_bucket(table, (cursor), entry_field, (key)) \
+		if ((cursor)->key_field == (key))
+
+#define __qdf_ht_get(table, cursor, entry_field, key, key_field) \
+do { \
+	cursor = NULL; \
+	__qdf_ht_for_each_match(table, cursor, entry_field, key, key_field) \
+		break; \
+} while (false)
+
+#define __qdf_ht_for_each_safe(table, i, tmp, cursor, entry_field) \
+	for ((i) = 0, cursor = NULL; \
+	     !cursor && (i) < __QDF_HASH_SIZE(table); (i)++) \
+		__qdf_hlist_for_each_entry_safe(cursor, tmp, &(table)[i], \
+						entry_field)
+
+#endif /* __I_QDF_HASHTABLE_H */
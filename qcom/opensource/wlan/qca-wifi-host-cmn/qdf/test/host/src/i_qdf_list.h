@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_list.h
+ * Userspace (host test build) list types.
+ *
+ * Provides the subset of the kernel's linux/list.h and linux/llist.h that
+ * qdf uses, with the same semantics, so that linux/src/qdf_list.c builds
+ * unchanged on the host.
+ */
+
+#if !defined(__I_QDF_LIST_H)
+#define __I_QDF_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+struct list_head {
+	struct list_head *next, *prev;
+};
+
+static inline void INIT_LIST_HEAD(struct list_head *list)
+{
+	list->next = list;
+	list->prev = list;
+}
+
+static inline void __qdf_host_list_add(struct list_head *new,
+				       struct list_head *prev,
+				       struct list_head *next)
+{
+	next->prev = new;
+	new->next = next;
+	new->prev = prev;
+	prev->next = new;
+}
+
+static inline void list_add(struct list_head *new, struct list_head *head)
+{
+	__qdf_host_list_add(new, head, head->next);
+}
+
+static inline void list_add_tail(struct list_head *new, struct list_head *head)
+{
+	__qdf_host_list_add(new, head->prev, head);
+}
+
+static inline void list_del_init(struct list_head *entry)
+{
+	entry->next->prev = entry->prev;
+	entry->prev->next = entry->next;
+	INIT_LIST_HEAD(entry);
+}
+
+static inline int list_empty(const struct list_head *head)
+{
+	return head->next == head;
+}
+
+static inline void list_cut_position(struct list_head *list,
+				     struct list_head *head,
+				     struct list_head *entry)
+{
+	struct list_head *new_first = entry->next;
+
+	if (list_empty(head))
+		return;
+
+	if (head == entry) {
+		INIT_LIST_HEAD(list);
+		return;
+	}
+
+	list->next = head->next;
+	list->next->prev = list;
+	list->prev = entry;
+	entry->next = list;
+	head->next = new_first;
+	new_first->prev = head;
+}
+
+static inline void list_splice_tail_init(struct list_head *list,
+					 struct list_head *head)
+{
+	struct list_head *first = list->next;
+	struct list_head *last = list->prev;
+
+	if (list_empty(list))
+		return;
+
+	first->prev = head->prev;
+	head->prev->next = first;
+	last->next = head;
+	head->prev = last;
+	INIT_LIST_HEAD(list);
+}
+
+#define list_entry(ptr, type, member) container_of(ptr, type, member)
+
+#define list_first_entry_or_null(ptr, type, member) \
+	(!list_empty(ptr) ? list_entry((ptr)->next, type, member) : NULL)
+
+#define list_for_each(pos, head) \
+	for (pos = (head)->next; pos != (head); pos = pos->next)
+
+#define list_for_each_entry(pos, head, member) \
+	for (pos = list_entry((head)->next, typeof(*pos), member); \
+	     &pos->member != (head); \
+	     pos = list_entry(pos->member.next, typeof(*pos), member))
+
+#define list_for_each_entry_safe(pos, n, head, member) \
+	for (pos = list_entry((head)->next, typeof(*pos), member), \
+	     n = list_entry(pos->member.next, typeof(*pos), member); \
+	     &pos->member != (head); \
+	     pos = n, n = list_entry(n->member.next, typeof(*n), member))
+
+#define list_for_each_entry_from(pos, head, member) \
+	for (; &pos->member != (head); \
+	     pos = list_entry(pos->member.next, typeof(*pos), member))
+
+/* Type declarations */
+typedef struct list_head __qdf_list_node_t;
+
+/**
+ * typedef __qdf_list_t - list abstraction
+ * @anchor: list head
+ * @count: number of nodes in the list
+ * @max_size: max size of the list
+ */
+typedef struct qdf_list_s {
+	__qdf_list_node_t anchor;
+	uint32_t count;
+	uint32_t max_size;
+} __qdf_list_t;
+
+static inline void __qdf_list_create(__qdf_list_t *list, uint32_t max_size)
+{
+	INIT_LIST_HEAD(&list->anchor);
+	list->count = 0;
+	list->max_size = max_size;
+}
+
+static inline uint32_t __qdf_list_size(__qdf_list_t *list)
+{
+	return list->count;
+}
+
+static inline uint32_t __qdf_list_max_size(__qdf_list_t *list)
+{
+	return list->max_size;
+}
+
+#define __QDF_LIST_ANCHOR(list) ((list).anchor)
+
+#define __QDF_LIST_NODE_INIT(prev_node, next_node) \
+	{ .prev = &(prev_node), .next = &(next_node), }
+
+#define __QDF_LIST_NODE_INIT_SINGLE(node) \
+	__QDF_LIST_NODE_INIT(node, node)
+
+#define __QDF_LIST_INIT(tail, head) \
+	{ .anchor = __QDF_LIST_NODE_INIT(tail, head), }
+
+#define __QDF_LIST_INIT_SINGLE(node) \
+	__QDF_LIST_INIT(node, node)
+
+#define __QDF_LIST_INIT_EMPTY(list) \
+	__QDF_LIST_INIT_SINGLE(list.anchor)
+
+#define __qdf_list_for_each(list_ptr, cursor, node_field) \
+	list_for_each_entry(cursor, &(list_ptr)->anchor, node_field)
+
+#define __qdf_list_for_each_del(list_ptr, cursor, next, node_field) \
+	list_for_each_entry_safe(cursor, next, &(list_ptr)->anchor, node_field)
+
+#define __qdf_list_for_each_from(list_ptr, cursor, node_field) \
+	list_for_each_entry_from(cursor, &(list_ptr)->anchor, node_field)
+
+#define __qdf_list_first_entry_or_null(list_ptr, type, node_field) \
+	list_first_entry_or_null(&(list_ptr)->anchor, type, node_field)
+
+static inline void __qdf_init_list_head(__qdf_list_node_t *list_head)
+{
+	INIT_LIST_HEAD(list_head);
+}
+
+struct llist_node {
+	struct llist_node *next;
+};
+
+struct llist_head {
+	struct llist_node *first;
+};
+
+typedef struct llist_head __qdf_llist_head_t;
+typedef struct llist_node __qdf_llist_node_t;
+
+static inline void __qdf_init_llist_head(__qdf_llist_head_t *head)
+{
+	head->first = NULL;
+}
+
+static inline bool __qdf_llist_add(__qdf_llist_node_t *node,
+				   __qdf_llist_head_t *head)
+{
+	struct llist_node *first = __atomic_load_n(&head->first,
+						   __ATOMIC_RELAXED);
+
+	do {
+		node->next = first;
+	} while (!__atomic_compare_exchange_n(&head->first, &first, node,
+					      true, __ATOMIC_RELEASE,
+					      __ATOMIC_RELAXED));
+
+	return !first;
+}
+
+static inline __qdf_llist_node_t *
+__qdf_llist_del_first(__qdf_llist_head_t *head)
+{
+	struct llist_node *entry = __atomic_load_n(&head->first,
+						   __ATOMIC_ACQUIRE);
+
+	do {
+		if (!entry)
+			return NULL;
+	} while (!__atomic_compare_exchange_n(&head->first, &entry,
+					      entry->next, true,
+					      __ATOMIC_ACQUIRE,
+					      __ATOMIC_ACQUIRE));
+
+	return entry;
+}
+
+static inline __qdf_llist_node_t *__qdf_llist_del_all(__qdf_llist_head_t *head)
+{
+	return __atomic_exchange_n(&head->first, NULL, __ATOMIC_ACQUIRE);
+}
+
+static inline __qdf_llist_node_t *
+__qdf_llist_reverse_order(__qdf_llist_node_t *node)
+{
+	struct llist_node *new_head = NULL;
+	struct llist_node *tmp;
+
+	while (node) {
+		tmp = node;
+		node = node->next;
+		tmp->next = new_head;
+		new_head = tmp;
+	}
+
+	return new_head;
+}
+
+static inline bool __qdf_llist_empty(const __qdf_llist_head_t *head)
+{
+	return !__atomic_load_n(&head->first, __ATOMIC_RELAXED);
+}
+
+static inline __qdf_llist_node_t *__qdf_llist_next(__qdf_llist_node_t *node)
+{
+	return node->next;
+}
+#endif
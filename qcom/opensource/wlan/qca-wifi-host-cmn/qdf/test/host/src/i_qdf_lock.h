@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_lock.h
+ * Userspace (host test build) lock API, on top of pthreads.
+ *
+ * There are no interrupts or bottom halves in a process, so all spinlock
+ * flavours map to the same pthread spinlock.
+ */
+
+#if !defined(__I_QDF_LOCK_H)
+#define __I_QDF_LOCK_H
+
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <qdf_types.h>
+#include <qdf_status.h>
+
+enum {
+	LOCK_RELEASED = 0x11223344,
+	LOCK_ACQUIRED,
+	LOCK_DESTROYED
+};
+
+/**
+ * struct qdf_lock_s - mutex abstraction
+ * @m_lock: Mutex lock
+ * @cookie: Lock cookie
+ * @process_id: Process ID to track lock
+ * @state: Lock status
+ * @refcount: Reference count for recursive lock
+ * @stats: a structure that contains usage statistics
+ */
+struct qdf_lock_s {
+	pthread_mutex_t m_lock;
+	uint32_t cookie;
+	int process_id;
+	uint32_t state;
+	uint8_t refcount;
+	struct lock_stats stats;
+};
+
+typedef struct qdf_lock_s __qdf_mutex_t;
+
+/**
+ * typedef __qdf_spinlock_t - spinlock abstraction
+ * @spinlock: pthread spinlock
+ * @flags: unused on the host
+ */
+typedef struct __qdf_spinlock {
+	pthread_spinlock_t spinlock;
+	unsigned long flags;
+} __qdf_spinlock_t;
+
+struct semaphore {
+	sem_t sem;
+};
+
+typedef struct semaphore __qdf_semaphore_t;
+
+typedef struct qdf_wake_lock {
+	const char *name;
+} qdf_wake_lock_t;
+
+typedef struct qdf_runtime_lock {
+	void *lock;
+} qdf_runtime_lock_t;
+
+#define LINUX_LOCK_COOKIE 0x12345678
+
+static inline QDF_STATUS __qdf_semaphore_init(__qdf_semaphore_t *m)
+{
+	sem_init(&m->sem, 0, 1);
+	return QDF_STATUS_SUCCESS;
+}
+
+static inline int __qdf_semaphore_acquire(__qdf_semaphore_t *m)
+{
+	while (sem_wait(&m->sem) && errno == EINTR)
+		;
+	return 0;
+}
+
+static inline int __qdf_semaphore_acquire_intr(__qdf_semaphore_t *m)
+{
+	return sem_wait(&m->sem) ? -EINTR : 0;
+}
+
+static inline void __qdf_semaphore_release(__qdf_semaphore_t *m)
+{
+	sem_post(&m->sem);
+}
+
+static inline int __qdf_semaphore_acquire_timeout(__qdf_semaphore_t *m,
+						  unsigned long timeout)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_sec += timeout / 1000;
+	ts.tv_nsec += (timeout % 1000) * 1000000L;
+	if (ts.tv_nsec >= 1000000000L) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000L;
+	}
+
+	return sem_timedwait(&m->sem, &ts) ? -ETIME : 0;
+}
+
+static inline QDF_STATUS __qdf_spinlock_create(__qdf_spinlock_t *lock)
+{
+	pthread_spin_init(&lock->spinlock, PTHREAD_PROCESS_PRIVATE);
+	lock->flags = 0;
+	return QDF_STATUS_SUCCESS;
+}
+
+#define __qdf_spinlock_destroy(lock) pthread_spin_destroy(&(lock)->spinlock)
+
+static inline void __qdf_spin_lock(__qdf_spinlock_t *lock)
+{
+	pthread_spin_lock(&lock->spinlock);
+}
+
+static inline void __qdf_spin_unlock(__qdf_spinlock_t *lock)
+{
+	pthread_spin_unlock(&lock->spinlock);
+}
+
+static inline void __qdf_spin_lock_irqsave(__qdf_spinlock_t *lock)
+{
+	__qdf_spin_lock(lock);
+}
+
+static inline void __qdf_spin_unlock_irqrestore(__qdf_spinlock_t *lock)
+{
+	__qdf_spin_unlock(lock);
+}
+
+#define __qdf_spin_lock_irq(_p_lock, _flags) pthread_spin_lock(_p_lock)
+#define __qdf_spin_unlock_irq(_p_lock, _flags) pthread_spin_unlock(_p_lock)
+
+static inline int __qdf_spin_trylock(__qdf_spinlock_t *lock)
+{
+	return !pthread_spin_trylock(&lock->spinlock);
+}
+
+static inline int __qdf_spin_is_locked(__qdf_spinlock_t *lock)
+{
+	if (!__qdf_spin_trylock(lock))
+		return 1;
+
+	__qdf_spin_unlock(lock);
+	return 0;
+}
+
+static inline int __qdf_spin_trylock_bh(__qdf_spinlock_t *lock)
+{
+	return __qdf_spin_trylock(lock);
+}
+
+static inline void __qdf_spin_lock_bh(__qdf_spinlock_t *lock)
+{
+	__qdf_spin_lock(lock);
+}
+
+static inline void __qdf_spin_unlock_bh(__qdf_spinlock_t *lock)
+{
+	__qdf_spin_unlock(lock);
+}
+
+static inline bool __qdf_spinlock_irq_exec(qdf_handle_t hdl,
+					   __qdf_spinlock_t *lock,
+					   qdf_irqlocked_func_t func,
+					   void *arg)
+{
+	bool ret;
+
+	__qdf_spin_lock(lock);
+	ret = func(arg);
+	__qdf_spin_unlock(lock);
+
+	return ret;
+}
+
+static inline bool __qdf_in_softirq(void)
+{
+	return false;
+}
+#endif /* __I_QDF_LOCK_H */
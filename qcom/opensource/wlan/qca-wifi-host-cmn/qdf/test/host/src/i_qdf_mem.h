@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_mem.h
+ * Userspace (host test build) memory API.
+ *
+ * Heap allocations go to libc. There is no device, so DMA "mappings" are
+ * identity mappings of host virtual addresses.
+ */
+
+#ifndef __I_QDF_MEM_H
+#define __I_QDF_MEM_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <qdf_status.h>
+#include <qdf_types.h>
+
+#define __qdf_cache_line_sz 64
+#define __page_size ((size_t)4096)
+#define __qdf_align(a, mask) (((a) + ((mask) - 1)) & ~((typeof(a))(mask) - 1))
+
+#define QDF_RET_IP __builtin_return_address(0)
+
+#define QDF_MEMDEBUG_PANIC(reason_fmt, args...) \
+	QDF_DEBUG_PANIC(reason_fmt, ## args)
+
+typedef enum dma_data_direction __dma_data_direction;
+
+typedef struct __qdf_mempool_ctxt *__qdf_mempool_t;
+
+int __qdf_mempool_init(qdf_device_t osdev, __qdf_mempool_t *pool, int pool_cnt,
+		       size_t pool_entry_size, u_int32_t flags);
+void __qdf_mempool_destroy(qdf_device_t osdev, __qdf_mempool_t pool);
+void *__qdf_mempool_alloc(qdf_device_t osdev, __qdf_mempool_t pool);
+void __qdf_mempool_free(qdf_device_t osdev, __qdf_mempool_t pool, void *buf);
+int __qdf_mempool_alloc_bulk(qdf_device_t osdev, __qdf_mempool_t pool,
+			     void **elems, int count);
+void __qdf_mempool_free_bulk(qdf_device_t osdev, __qdf_mempool_t pool,
+			     void **elems, int count);
+
+static inline uint32_t __qdf_mem_map_nbytes_single(qdf_device_t osdev,
+						   void *buf, qdf_dma_dir_t dir,
+						   int nbytes,
+						   qdf_dma_addr_t *phy_addr)
+{
+	*phy_addr = (qdf_dma_addr_t)buf;
+	return QDF_STATUS_SUCCESS;
+}
+
+static inline void __qdf_mem_dma_cache_sync(qdf_device_t osdev,
+					    qdf_dma_addr_t buf,
+					    qdf_dma_dir_t dir,
+					    int nbytes)
+{
+}
+
+static inline void __qdf_mem_unmap_nbytes_single(qdf_device_t osdev,
+						 qdf_dma_addr_t phy_addr,
+						 qdf_dma_dir_t dir, int nbytes)
+{
+}
+
+static inline bool __qdf_mem_smmu_s1_enabled(qdf_device_t osdev)
+{
+	return false;
+}
+
+/* qdf_mem_virt_to_phys() calls the kernel virt_to_phys() directly */
+#define virt_to_phys(vaddr) ((qdf_dma_addr_t)(uintptr_t)(vaddr))
+
+static inline unsigned long
+__qdf_mem_paddr_from_dmaaddr(qdf_device_t osdev, qdf_dma_addr_t dma_addr)
+{
+	return dma_addr;
+}
+
+static inline int
+__qdf_os_mem_dma_get_sgtable(struct device *dev, void *sgt, void *cpu_addr,
+			     qdf_dma_addr_t dma_addr, size_t size)
+{
+	return -1;
+}
+
+static inline void __qdf_os_mem_free_sgtable(struct sg_table *sgt)
+{
+}
+
+static inline void __qdf_dma_get_sgtable_dma_addr(struct sg_table *sgt)
+{
+}
+
+static inline qdf_dma_addr_t __qdf_mem_get_dma_addr(qdf_device_t osdev,
+						    qdf_mem_info_t *mem_info)
+{
+	return (qdf_dma_addr_t)mem_info->pa;
+}
+
+static inline qdf_dma_addr_t *
+__qdf_mem_get_dma_addr_ptr(qdf_device_t osdev, qdf_mem_info_t *mem_info)
+{
+	return (qdf_dma_addr_t *)(&mem_info->pa);
+}
+
+static inline void __qdf_update_mem_map_table(qdf_device_t osdev,
+					      qdf_mem_info_t *mem_info,
+					      qdf_dma_addr_t dma_addr,
+					      uint32_t mem_size)
+{
+	mem_info->pa = dma_addr;
+	mem_info->iova = dma_addr;
+	mem_info->size = mem_size;
+}
+
+static inline uint32_t
+__qdf_mem_get_dma_size(qdf_device_t osdev, qdf_mem_info_t *mem_info)
+{
+	return mem_info->size;
+}
+
+static inline void
+__qdf_mem_set_dma_size(qdf_device_t osdev, qdf_mem_info_t *mem_info,
+		       uint32_t mem_size)
+{
+	mem_info->size = mem_size;
+}
+
+static inline qdf_dma_addr_t
+__qdf_mem_get_dma_pa(qdf_device_t osdev, qdf_mem_info_t *mem_info)
+{
+	return mem_info->pa;
+}
+
+static inline void
+__qdf_mem_set_dma_pa(qdf_device_t osdev, qdf_mem_info_t *mem_info,
+		     qdf_dma_addr_t dma_pa)
+{
+	mem_info->pa = dma_pa;
+}
+
+void *__qdf_mem_alloc_consistent(qdf_device_t osdev, void *dev,
+				 qdf_size_t size, qdf_dma_addr_t *paddr,
+				 const char *func, uint32_t line);
+void *__qdf_mem_malloc(qdf_size_t size, const char *func, uint32_t line);
+void __qdf_mem_free(void *ptr);
+void *__qdf_mem_valloc(size_t size, const char *func, uint32_t line);
+void __qdf_mem_vfree(void *ptr);
+void __qdf_mem_free_consistent(qdf_device_t osdev, void *dev,
+			       qdf_size_t size, void *vaddr,
+			       qdf_dma_addr_t paddr, qdf_dma_context_t memctx);
+#endif /* __I_QDF_MEM_H */
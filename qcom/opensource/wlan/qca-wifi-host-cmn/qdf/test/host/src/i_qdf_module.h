@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_module.h
+ * Userspace (host test build) module API. Everything is linked into one
+ * executable, so there is nothing to export and no module to load.
+ */
+
+#ifndef _I_QDF_MODULE_H
+#define _I_QDF_MODULE_H
+
+#include <qdf_types.h>
+
+#define __qdf_virt_module_init(_x)
+#define __qdf_virt_module_exit(_x)
+#define __qdf_virt_module_name(_name)
+#define __qdf_export_symbol(_sym)
+#define __qdf_declare_param(_name, _type)
+#define __qdf_declare_param_array(_name, _type, _num)
+
+#endif /* _I_QDF_MODULE_H */
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_ptr_hash.h
+ * Userspace (host test build) pointer hashing, the multiplicative hash of
+ * the kernel's linux/hash.h.
+ */
+
+#ifndef __I_QDF_PTR_HASH_H
+#define __I_QDF_PTR_HASH_H
+
+#include <stdint.h>
+
+#define __QDF_GOLDEN_RATIO_32 0x61C88647
+#define __QDF_GOLDEN_RATIO_64 0x61C8864680B583EBull
+
+static inline uint32_t __qdf_hash_32(uint32_t val, unsigned int bits)
+{
+	return (val * __QDF_GOLDEN_RATIO_32) >> (32 - bits);
+}
+
+static inline uint32_t __qdf_hash_64(uint64_t val, unsigned int bits)
+{
+	return (val * __QDF_GOLDEN_RATIO_64) >> (64 - bits);
+}
+
+#if __SIZEOF_LONG__ == 4
+#define __qdf_hash_long(val, bits) __qdf_hash_32(val, bits)
+#else
+#define __qdf_hash_long(val, bits) __qdf_hash_64(val, bits)
+#endif
+
+#define __qdf_ptr_hash_key(key, bits) __qdf_hash_long(key, bits)
+
+#endif /* __I_QDF_PTR_HASH_H */
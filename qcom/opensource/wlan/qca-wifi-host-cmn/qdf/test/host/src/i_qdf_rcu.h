@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_rcu.h
+ * Userspace (host test build) read-copy-update.
+ *
+ * Readers hold a process wide reader-writer lock (only the outermost
+ * qdf_rcu_read_lock() of a thread takes it, so read sections nest), and a
+ * grace period is an acquire/release of the write side. Callbacks queued
+ * with qdf_call_rcu() run on a reclaim thread after a grace period, so
+ * they may be queued from inside read sections, as in the kernel.
+ */
+
+#ifndef __I_QDF_RCU_H
+#define __I_QDF_RCU_H
+
+/**
+ * struct rcu_head - callback queued by qdf_call_rcu()
+ * @next: next queued callback
+ * @func: callback
+ */
+struct rcu_head {
+	struct rcu_head *next;
+	void (*func)(struct rcu_head *head);
+};
+
+typedef struct rcu_head __qdf_rcu_head_t;
+
+void __qdf_host_rcu_read_lock(void);
+void __qdf_host_rcu_read_unlock(void);
+void __qdf_host_call_rcu(struct rcu_head *head,
+			 void (*func)(struct rcu_head *head));
+void __qdf_host_synchronize_rcu(void);
+void __qdf_host_rcu_barrier(void);
+
+#define __qdf_rcu_read_lock() __qdf_host_rcu_read_lock()
+#define __qdf_rcu_read_unlock() __qdf_host_rcu_read_unlock()
+#define __qdf_call_rcu(head, func) __qdf_host_call_rcu(head, func)
+#define __qdf_synchronize_rcu() __qdf_host_synchronize_rcu()
+#define __qdf_rcu_barrier() __qdf_host_rcu_barrier()
+#define __qdf_rcu_publish_barrier() __atomic_thread_fence(__ATOMIC_RELEASE)
+#define __qdf_rcu_read_ptr(ptr) \
+	({ typeof(ptr) __p = __atomic_load_n(&(ptr), __ATOMIC_CONSUME); __p; })
+
+#endif /* __I_QDF_RCU_H */
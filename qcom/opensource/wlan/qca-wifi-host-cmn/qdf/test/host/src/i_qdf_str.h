@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_str.h
+ * Userspace (host test build) string API.
+ */
+
+#ifndef __I_QDF_STR_H
+#define __I_QDF_STR_H
+
+#include <ctype.h>
+#include <string.h>
+
+char *__qdf_str_skip_spaces(const char *str);
+char *__qdf_str_strim(char *str);
+ssize_t __qdf_str_strscpy(char *dest, const char *src, size_t dest_size);
+
+#define __qdf_is_space(c) isspace(c)
+#define __qdf_str_cmp(left, right) strcmp(left, right)
+#define __qdf_str_lcopy(dest, src, dest_size) \
+	__qdf_str_strscpy(dest, src, dest_size)
+#define __qdf_str_left_trim(str) __qdf_str_skip_spaces(str)
+#define __qdf_str_len(str) strlen(str)
+#define __qdf_str_trim(str) __qdf_str_strim(str)
+#define __qdf_str_nlen(str, limit) strnlen(str, limit)
+#define __qdf_str_ncmp(left, right, limit) strncmp(left, right, limit)
+#define __qdf_str_sep(buf, delim) strsep(buf, delim)
+
+#endif /* __I_QDF_STR_H */
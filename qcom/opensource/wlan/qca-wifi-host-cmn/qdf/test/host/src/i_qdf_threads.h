@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_threads.h
+ * Userspace (host test build) thread type, a pthread with the state
+ * qdf_thread_should_stop() and qdf_thread_join() need.
+ */
+
+#ifndef __I_QDF_THREADS_H
+#define __I_QDF_THREADS_H
+
+#include <pthread.h>
+#include <stdbool.h>
+
+/**
+ * struct task_struct - host thread
+ * @tid: pthread id
+ * @handler: thread function (qdf_create_thread)
+ * @callback: thread function (qdf_thread_run)
+ * @context: argument of @handler/@callback
+ * @status: return value of @callback
+ * @started: the pthread has been created
+ * @should_stop: set by qdf_thread_join()
+ * @name: thread name
+ */
+struct task_struct {
+	pthread_t tid;
+	int (*handler)(void *data);
+	QDF_STATUS (*callback)(void *context);
+	void *context;
+	QDF_STATUS status;
+	bool started;
+	volatile bool should_stop;
+	char name[16];
+};
+
+typedef struct task_struct __qdf_thread_t;
+
+#endif /* __I_QDF_THREADS_H */
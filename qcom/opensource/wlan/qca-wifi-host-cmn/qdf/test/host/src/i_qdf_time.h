@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_time.h
+ * Userspace (host test build) time API.
+ *
+ * ktime is a nanosecond count and a system tick (jiffy) is one millisecond
+ * of CLOCK_MONOTONIC, i.e. HZ is 1000.
+ */
+
+#ifndef _I_QDF_TIME_H
+#define _I_QDF_TIME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+
+#define HZ 1000
+
+#define do_div(n, base) ({ \
+	uint32_t __rem = (n) % (base); \
+	(n) /= (base); \
+	__rem; \
+})
+
+typedef unsigned long __qdf_time_t;
+typedef int64_t __qdf_ktime_t;
+typedef struct timespec __qdf_timespec_t;
+typedef struct work_struct __qdf_work_struct_t;
+
+static inline int64_t __qdf_clock_ns(clockid_t clock)
+{
+	struct timespec ts;
+
+	clock_gettime(clock, &ts);
+	return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static inline __qdf_ktime_t __qdf_ns_to_ktime(uint64_t ns)
+{
+	return ns;
+}
+
+static inline __qdf_ktime_t __qdf_ktime_add(__qdf_ktime_t ktime1,
+					    __qdf_ktime_t ktime2)
+{
+	return ktime1 + ktime2;
+}
+
+static inline __qdf_ktime_t __qdf_ktime_get(void)
+{
+	return __qdf_clock_ns(CLOCK_MONOTONIC);
+}
+
+static inline __qdf_ktime_t __qdf_ktime_real_get(void)
+{
+	return __qdf_clock_ns(CLOCK_REALTIME);
+}
+
+static inline __qdf_ktime_t __qdf_ktime_add_ns(__qdf_ktime_t ktime, int64_t ns)
+{
+	return ktime + ns;
+}
+
+static inline int64_t __qdf_ktime_to_ns(__qdf_ktime_t ktime)
+{
+	return ktime;
+}
+
+static inline int64_t __qdf_ktime_to_ms(__qdf_ktime_t ktime)
+{
+	return ktime / 1000000;
+}
+
+static inline __qdf_time_t __qdf_system_ticks(void)
+{
+	return __qdf_clock_ns(CLOCK_MONOTONIC) / 1000000;
+}
+
+#define __qdf_system_ticks_per_sec HZ
+
+static inline uint32_t __qdf_system_ticks_to_msecs(unsigned long ticks)
+{
+	return ticks;
+}
+
+static inline __qdf_time_t __qdf_system_msecs_to_ticks(uint32_t msecs)
+{
+	return msecs;
+}
+
+static inline __qdf_time_t __qdf_get_system_uptime(void)
+{
+	return __qdf_system_ticks();
+}
+
+static inline unsigned long __qdf_get_system_timestamp(void)
+{
+	return __qdf_system_ticks();
+}
+
+static inline void __qdf_udelay(uint32_t usecs)
+{
+	int64_t end = __qdf_clock_ns(CLOCK_MONOTONIC) + usecs * 1000LL;
+
+	while (__qdf_clock_ns(CLOCK_MONOTONIC) < end)
+		;
+}
+
+static inline void __qdf_mdelay(uint32_t msecs)
+{
+	__qdf_udelay(msecs * 1000);
+}
+
+static inline bool __qdf_system_time_after(__qdf_time_t a, __qdf_time_t b)
+{
+	return (long)(b) - (long)(a) < 0;
+}
+
+static inline bool __qdf_system_time_before(__qdf_time_t a, __qdf_time_t b)
+{
+	return __qdf_system_time_after(b, a);
+}
+
+static inline bool __qdf_system_time_after_eq(__qdf_time_t a, __qdf_time_t b)
+{
+	return (long)(a) - (long)(b) >= 0;
+}
+
+static inline uint64_t __qdf_sched_clock(void)
+{
+	return __qdf_clock_ns(CLOCK_MONOTONIC);
+}
+
+static inline uint64_t __qdf_get_monotonic_boottime(void)
+{
+	return __qdf_clock_ns(CLOCK_BOOTTIME) / 1000;
+}
+
+static inline uint64_t __qdf_get_log_timestamp(void)
+{
+	return __qdf_clock_ns(CLOCK_MONOTONIC) / 1000;
+}
+
+static inline uint64_t __qdf_get_bootbased_boottime_ns(void)
+{
+	return __qdf_clock_ns(CLOCK_BOOTTIME);
+}
+
+static inline __qdf_ktime_t __qdf_time_ms_to_ktime(uint64_t ms)
+{
+	return ms * 1000000;
+}
+
+static inline __qdf_ktime_t __qdf_time_ktime_real_get(void)
+{
+	return __qdf_ktime_real_get();
+}
+
+static inline unsigned long long __qdf_time_sched_clock(void)
+{
+	return __qdf_sched_clock();
+}
+
+static inline __qdf_ktime_t __qdf_time_ktime_sub(__qdf_ktime_t ktime1,
+						 __qdf_ktime_t ktime2)
+{
+	return ktime1 - ktime2;
+}
+
+static inline __qdf_ktime_t __qdf_time_ktime_set(const int64_t secs,
+						 const unsigned long nsecs)
+{
+	return secs * 1000000000LL + nsecs;
+}
+
+static inline int64_t __qdf_time_ktime_to_us(__qdf_ktime_t ktime)
+{
+	return ktime / 1000;
+}
+
+static inline void __qdf_time_ktime_get_real_time(__qdf_timespec_t *ts)
+{
+	clock_gettime(CLOCK_REALTIME, ts);
+}
+#endif
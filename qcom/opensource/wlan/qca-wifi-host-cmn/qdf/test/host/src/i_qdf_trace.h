@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_trace.h
+ * Userspace (host test build) trace and assert definitions.
+ *
+ * Traces go to stderr through qdf_trace_msg(). QDF_BUG() and
+ * QDF_DEBUG_PANIC() never stop the process: they report the failure and
+ * bump a counter, so that the test runner can attribute failed assertions
+ * to the test which hit them and keep going.
+ */
+
+#if !defined(__I_QDF_TRACE_H)
+#define __I_QDF_TRACE_H
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#define QDF_TRACE qdf_trace_msg
+#define QDF_VTRACE qdf_vtrace_msg
+#define QDF_TRACE_HEX_DUMP qdf_trace_hex_dump
+
+#define __QDF_TRACE_RATE_LIMITED(params...) QDF_TRACE(params)
+#define __QDF_TRACE_HEX_DUMP_RATE_LIMITED(params...) QDF_TRACE_HEX_DUMP(params)
+
+#define __QDF_TRACE_NO_FL(log_level, module_id, format, args...) \
+	QDF_TRACE(module_id, log_level, format, ## args)
+
+#define __QDF_TRACE_FL(log_level, module_id, format, args...) \
+	QDF_TRACE(module_id, log_level, FL(format), ## args)
+
+#define __QDF_TRACE_RL(log_level, module_id, format, args...) \
+	__QDF_TRACE_RATE_LIMITED(module_id, log_level, FL(format), ## args)
+
+#define __QDF_TRACE_RL_NO_FL(log_level, module_id, format, args...) \
+	__QDF_TRACE_RATE_LIMITED(module_id, log_level, format, ## args)
+
+#define __QDF_TRACE_HEX_DUMP_RL(log_level, module_id, args...) \
+	__QDF_TRACE_HEX_DUMP_RATE_LIMITED(module_id, log_level, ## args)
+
+#define QDF_TRACE_FATAL(params...) \
+	__QDF_TRACE_FL(QDF_TRACE_LEVEL_FATAL, ## params)
+#define QDF_TRACE_FATAL_NO_FL(params...) \
+	__QDF_TRACE_NO_FL(QDF_TRACE_LEVEL_FATAL, ## params)
+#define QDF_TRACE_FATAL_RL(params...) \
+	__QDF_TRACE_RL(QDF_TRACE_LEVEL_FATAL, ## params)
+#define QDF_TRACE_FATAL_RL_NO_FL(params...) \
+	__QDF_TRACE_RL_NO_FL(QDF_TRACE_LEVEL_FATAL, ## params)
+#define QDF_VTRACE_FATAL(module_id, fmt, args) \
+	QDF_VTRACE(module_id, QDF_TRACE_LEVEL_FATAL, fmt, args)
+#define QDF_TRACE_HEX_DUMP_FATAL_RL(params...) \
+	__QDF_TRACE_HEX_DUMP_RL(QDF_TRACE_LEVEL_FATAL, ## params)
+
+#define QDF_TRACE_ERROR(params...) \
+	__QDF_TRACE_FL(QDF_TRACE_LEVEL_ERROR, ## params)
+#define QDF_TRACE_ERROR_NO_FL(params...) \
+	__QDF_TRACE_NO_FL(QDF_TRACE_LEVEL_ERROR, ## params)
+#define QDF_TRACE_ERROR_RL(params...) \
+	__QDF_TRACE_RL(QDF_TRACE_LEVEL_ERROR, ## params)
+#define QDF_TRACE_ERROR_RL_NO_FL(params...) \
+	__QDF_TRACE_RL_NO_FL(QDF_TRACE_LEVEL_ERROR, ## params)
+#define QDF_VTRACE_ERROR(module_id, fmt, args) \
+	QDF_VTRACE(module_id, QDF_TRACE_LEVEL_ERROR, fmt, args)
+#define QDF_TRACE_HEX_DUMP_ERROR_RL(params...) \
+	__QDF_TRACE_HEX_DUMP_RL(QDF_TRACE_LEVEL_ERROR, ## params)
+
+#define QDF_TRACE_WARN(params...) \
+	__QDF_TRACE_FL(QDF_TRACE_LEVEL_WARN, ## params)
+#define QDF_TRACE_WARN_NO_FL(params...) \
+	__QDF_TRACE_NO_FL(QDF_TRACE_LEVEL_WARN, ## params)
+#define QDF_TRACE_WARN_RL(params...) \
+	__QDF_TRACE_RL(QDF_TRACE_LEVEL_WARN, ## params)
+#define QDF_TRACE_WARN_RL_NO_FL(params...) \
+	__QDF_TRACE_RL_NO_FL(QDF_TRACE_LEVEL_WARN, ## params)
+#define QDF_VTRACE_WARN(module_id, fmt, args) \
+	QDF_VTRACE(module_id, QDF_TRACE_LEVEL_WARN, fmt, args)
+#define QDF_TRACE_HEX_DUMP_WARN_RL(params...) \
+	__QDF_TRACE_HEX_DUMP_RL(QDF_TRACE_LEVEL_WARN, ## params)
+
+#define QDF_TRACE_INFO(params...) \
+	__QDF_TRACE_FL(QDF_TRACE_LEVEL_INFO, ## params)
+#define QDF_TRACE_INFO_NO_FL(params...) \
+	__QDF_TRACE_NO_FL(QDF_TRACE_LEVEL_INFO, ## params)
+#define QDF_TRACE_INFO_RL(params...) \
+	__QDF_TRACE_RL(QDF_TRACE_LEVEL_INFO, ## params)
+#define QDF_TRACE_INFO_RL_NO_FL(params...) \
+	__QDF_TRACE_RL_NO_FL(QDF_TRACE_LEVEL_INFO, ## params)
+#define QDF_VTRACE_INFO(module_id, fmt, args) \
+	QDF_VTRACE(module_id, QDF_TRACE_LEVEL_INFO, fmt, args)
+#define QDF_TRACE_HEX_DUMP_INFO_RL(params...) \
+	__QDF_TRACE_HEX_DUMP_RL(QDF_TRACE_LEVEL_INFO, ## params)
+
+#define QDF_TRACE_DEBUG(params...) \
+	__QDF_TRACE_FL(QDF_TRACE_LEVEL_DEBUG, ## params)
+#define QDF_TRACE_DEBUG_NO_FL(params...) \
+	__QDF_TRACE_NO_FL(QDF_TRACE_LEVEL_DEBUG, ## params)
+#define QDF_TRACE_DEBUG_RL(params...) \
+	__QDF_TRACE_RL(QDF_TRACE_LEVEL_DEBUG, ## params)
+#define QDF_TRACE_DEBUG_RL_NO_FL(params...) \
+	__QDF_TRACE_RL_NO_FL(QDF_TRACE_LEVEL_DEBUG, ## params)
+#define QDF_VTRACE_DEBUG(module_id, fmt, args) \
+	QDF_VTRACE(module_id, QDF_TRACE_LEVEL_DEBUG, fmt, args)
+#define QDF_TRACE_HEX_DUMP_DEBUG_RL(params...) \
+	__QDF_TRACE_HEX_DUMP_RL(QDF_TRACE_LEVEL_DEBUG, ## params)
+
+#define QDF_TRACE_ENTER(params...) \
+	__QDF_TRACE_FL(QDF_TRACE_LEVEL_DEBUG, ## params)
+#define QDF_TRACE_EXIT(params...) \
+	__QDF_TRACE_FL(QDF_TRACE_LEVEL_DEBUG, ## params)
+
+#define QDF_ENABLE_TRACING
+#define qdf_scnprintf scnprintf
+
+int scnprintf(char *buf, size_t size, const char *fmt, ...);
+
+void __printf(3, 4) qdf_trace_msg(QDF_MODULE_ID module, QDF_TRACE_LEVEL level,
+				  const char *str_format, ...);
+
+void qdf_vtrace_msg(QDF_MODULE_ID module, QDF_TRACE_LEVEL level,
+		    const char *str_format, va_list val);
+
+static inline void qdf_vprint(const char *fmt, va_list args)
+{
+	QDF_VTRACE_INFO(QDF_MODULE_ID_ANY, fmt, args);
+}
+
+/**
+ * __qdf_bug() - account for a failed QDF_BUG()/QDF_DEBUG_PANIC()
+ *
+ * Return: None
+ */
+void __qdf_bug(void);
+
+/**
+ * __qdf_bug_count() - number of failed assertions so far
+ *
+ * Return: count of __qdf_bug() calls since the process started
+ */
+uint32_t __qdf_bug_count(void);
+
+/**
+ * qdf_host_trace_set_level() - set the most verbose level printed
+ * @level: trace level, QDF_TRACE_LEVEL_INFO by default
+ *
+ * Return: None
+ */
+void qdf_host_trace_set_level(QDF_TRACE_LEVEL level);
+
+#define QDF_ASSERT(_condition) \
+	do { \
+		if (!(_condition)) { \
+			fprintf(stderr, "QDF ASSERT in %s Line %d\n", \
+				__func__, __LINE__); \
+		} \
+	} while (0)
+
+#define QDF_DEBUG_PANIC(reason_fmt, args...) \
+	QDF_DEBUG_PANIC_FL(__func__, __LINE__, reason_fmt, ## args)
+
+#define QDF_DEBUG_PANIC_FL(func, line, fmt, args...) \
+	do { \
+		fprintf(stderr, "WLAN Panic @ %s:%d: " fmt "\n", \
+			func, line, ##args); \
+		__qdf_bug(); \
+	} while (false)
+
+#define QDF_BUG(_condition) \
+	do { \
+		if (!(_condition)) { \
+			fprintf(stderr, "QDF BUG in %s Line %d: " \
+				"Failed assertion '" #_condition "'\n", \
+				__func__, __LINE__); \
+			__qdf_bug(); \
+		} \
+	} while (0)
+
+#define QDF_BUG_ON_ASSERT(_condition) \
+	do { \
+		if (!(_condition)) { \
+			__qdf_bug(); \
+		} \
+	} while (0)
+
+#define __QDF_SYMBOL_LEN 1
+
+static inline void
+__qdf_minidump_log(void *start_addr,
+		   const size_t size, const char *name) {}
+static inline void
+__qdf_minidump_remove(void *start_addr,
+		      const size_t size, const char *name) {}
+#endif /* __I_QDF_TRACE_H */
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_types.h
+ * Userspace (host test build) definitions of the QDF types.
+ *
+ * This directory stands in for qdf/linux/src when qdf is compiled as a
+ * plain Linux process: the public qdf/inc headers are used unchanged and
+ * the __qdf_* layer below them is implemented over libc and pthreads.
+ */
+
+#ifndef __I_QDF_TYPES_H
+#define __I_QDF_TYPES_H
+
+#include <ctype.h>
+#include <endian.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+#define __iomem
+#define __ahdecl
+#define __qdf_must_check __attribute__((warn_unused_result))
+#define __qdf_packed __attribute__((packed))
+#define __qdf_inline inline
+
+#if !defined(__printf)
+#define __printf(a, b) __attribute__((format(printf, a, b)))
+#endif
+
+#ifndef __dma_addr_t_already_defined__
+#define __dma_addr_t_already_defined__
+typedef unsigned long dma_addr_t;
+#endif
+
+typedef unsigned long phys_addr_t;
+
+struct sg_table {
+	unsigned int nents;
+};
+
+typedef struct sg_table __sgtable_t;
+
+/* IS_ENABLED(CONFIG_X) is 1 if CONFIG_X is defined to 1, as in the kernel */
+#define __QDF_ARG_PLACEHOLDER_1 0,
+#define __qdf_take_second_arg(__ignored, val, ...) val
+#define __qdf_is_defined(x) ___qdf_is_defined(x)
+#define ___qdf_is_defined(val) ____qdf_is_defined(__QDF_ARG_PLACEHOLDER_##val)
+#define ____qdf_is_defined(arg1_or_junk) \
+	__qdf_take_second_arg(arg1_or_junk 1, 0)
+#define IS_ENABLED(option) __qdf_is_defined(option)
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+typedef unsigned short umode_t;
+
+typedef uint16_t __le16;
+typedef uint32_t __le32;
+typedef uint64_t __le64;
+typedef uint16_t __be16;
+typedef uint32_t __be32;
+typedef uint64_t __be64;
+
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+#define QDF_LITTLE_ENDIAN_MACHINE
+#else
+#define QDF_BIG_ENDIAN_MACHINE
+#endif
+
+enum dma_data_direction {
+	DMA_BIDIRECTIONAL = 0,
+	DMA_TO_DEVICE = 1,
+	DMA_FROM_DEVICE = 2,
+	DMA_NONE = 3,
+};
+
+#define __QDF_CLOCK_REALTIME 0
+#define __QDF_CLOCK_MONOTONIC 1
+#define __QDF_HRTIMER_MODE_ABS 0
+#define __QDF_HRTIMER_MODE_REL 0
+#define __QDF_HRTIMER_MODE_PINNED 0
+#define __QDF_HRTIMER_NORESTART 0
+#define __QDF_HRTIMER_RESTART 0
+
+#define __QDF_MAX_SCATTER 1
+#define NSEC_PER_MSEC 1000000L
+#define __QDF_NSEC_PER_MSEC NSEC_PER_MSEC
+
+#define __QDF_DMA_BIDIRECTIONAL DMA_BIDIRECTIONAL
+#define __QDF_DMA_TO_DEVICE DMA_TO_DEVICE
+#define __QDF_DMA_FROM_DEVICE DMA_FROM_DEVICE
+
+typedef int (*__qdf_os_intr)(void *);
+typedef dma_addr_t __qdf_dma_addr_t;
+typedef size_t __qdf_dma_size_t;
+typedef dma_addr_t __qdf_dma_context_t;
+typedef struct net_device *__qdf_netdev_t;
+typedef unsigned long __qdf_cpu_mask;
+typedef __le16 __qdf_le16_t;
+typedef __le32 __qdf_le32_t;
+typedef __le64 __qdf_le64_t;
+typedef __be16 __qdf_be16_t;
+typedef __be32 __qdf_be32_t;
+typedef __be64 __qdf_be64_t;
+
+/**
+ * typedef __qdf_mem_info_t - shared mem info struct
+ * @pa : physical address
+ * @iova: i/o virtual address
+ * @size: allocated memory size
+ * @result: status
+ */
+typedef struct __qdf_shared_mem_info {
+	phys_addr_t pa;
+	unsigned long iova;
+	size_t size;
+	int result;
+} __qdf_mem_info_t;
+
+#define qdf_dma_mem_context(context) dma_addr_t context
+#define qdf_get_dma_mem_context(var, field) ((qdf_dma_context_t)(var->field))
+
+/**
+ * typedef __qdf_resource_t - qdf resource type
+ * @paddr: Physical address
+ * @vaddr: Virtual address
+ * @len: Length
+ */
+typedef struct __qdf_resource {
+	unsigned long paddr;
+	void __iomem *vaddr;
+	unsigned long len;
+} __qdf_resource_t;
+
+struct __qdf_mempool_ctxt;
+
+#define MAX_MEM_POOLS 64
+
+/**
+ * enum qdf_bus_type - Supported Bus types
+ * @QDF_BUS_TYPE_NONE: None Bus type for error check
+ * @QDF_BUS_TYPE_PCI: PCI Bus
+ * @QDF_BUS_TYPE_AHB: AHB Bus
+ * @QDF_BUS_TYPE_SNOC: SNOC Bus
+ * @QDF_BUS_TYPE_SIM: Simulator
+ * @QDF_BUS_TYPE_SDIO: SDIO Bus
+ * @QDF_BUS_TYPE_USB: USB Bus
+ * @QDF_BUS_TYPE_IPCI: IPCI Bus
+ */
+enum qdf_bus_type {
+	QDF_BUS_TYPE_NONE = -1,
+	QDF_BUS_TYPE_PCI = 0,
+	QDF_BUS_TYPE_AHB,
+	QDF_BUS_TYPE_SNOC,
+	QDF_BUS_TYPE_SIM,
+	QDF_BUS_TYPE_SDIO,
+	QDF_BUS_TYPE_USB,
+	QDF_BUS_TYPE_IPCI
+};
+
+/**
+ * struct __qdf_device - generic qdf device type
+ * @drv: Pointer to driver
+ * @drv_hdl: Pointer to driver handle
+ * @drv_name: Pointer to driver name
+ * @irq: IRQ
+ * @dev: Pointer to device
+ * @res: QDF resource
+ * @func: Interrupt handler
+ * @mem_pool: array of pointers to mem pool context
+ * @bus_type: Bus type
+ * @bid: Bus ID
+ * @smmu_s1_enabled: SMMU S1 enabled or not
+ */
+struct __qdf_device {
+	void *drv;
+	void *drv_hdl;
+	char *drv_name;
+	int irq;
+	struct device *dev;
+	__qdf_resource_t res;
+	__qdf_os_intr func;
+	struct __qdf_mempool_ctxt *mem_pool[MAX_MEM_POOLS];
+	enum qdf_bus_type bus_type;
+	const struct hif_bus_id *bid;
+	bool smmu_s1_enabled;
+};
+typedef struct __qdf_device *__qdf_device_t;
+
+typedef size_t __qdf_size_t;
+typedef off_t __qdf_off_t;
+typedef void __iomem *__qdf_iomem_t;
+
+typedef uint32_t ath_dma_addr_t;
+
+/**
+ * typedef __qdf_segment_t - segment of memory
+ * @daddr: dma address
+ * @len: length of segment
+ */
+typedef struct __qdf_segment {
+	dma_addr_t daddr;
+	uint32_t len;
+} __qdf_segment_t;
+
+/**
+ * struct __qdf_dma_map - dma map of memory
+ * @mapped: mapped address
+ * @nsegs: number of segments
+ * @coherent: coherency status
+ * @seg: segment of memory
+ */
+struct __qdf_dma_map {
+	uint32_t mapped;
+	uint32_t nsegs;
+	uint32_t coherent;
+	__qdf_segment_t seg[__QDF_MAX_SCATTER];
+};
+typedef struct __qdf_dma_map *__qdf_dma_map_t;
+
+enum __qdf_net_wireless_evcode {
+	__QDF_IEEE80211_ASSOC,
+	__QDF_IEEE80211_REASSOC,
+	__QDF_IEEE80211_DISASSOC,
+	__QDF_IEEE80211_JOIN,
+	__QDF_IEEE80211_LEAVE,
+	__QDF_IEEE80211_SCAN,
+	__QDF_IEEE80211_REPLAY,
+	__QDF_IEEE80211_MICHAEL,
+	__QDF_IEEE80211_REJOIN,
+	__QDF_CUSTOM_PUSH_BUTTON,
+};
+
+int __qdf_kstrtoint(const char *s, unsigned int base, int *res);
+int __qdf_kstrtouint(const char *s, unsigned int base, unsigned int *res);
+
+#define __qdf_snprint snprintf
+#define __qdf_vsnprint vsnprintf
+#define __qdf_toupper toupper
+#define qdf_kstrtoint __qdf_kstrtoint
+#define qdf_kstrtouint __qdf_kstrtouint
+
+#ifndef container_of
+#define container_of(ptr, type, member) \
+	((type *)((char *)(ptr) - offsetof(type, member)))
+#endif
+
+#define QDF_COMPILER_GNUC
+#define QDF_OS_LINUX
+
+#ifndef fallthrough
+#define fallthrough __attribute__((__fallthrough__))
+#endif
+
+#endif /* __I_QDF_TYPES_H */
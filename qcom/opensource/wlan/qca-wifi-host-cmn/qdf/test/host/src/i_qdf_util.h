@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: i_qdf_util.h
+ * Userspace (host test build) utility API.
+ */
+
+#ifndef _I_QDF_UTIL_H
+#define _I_QDF_UTIL_H
+
+#include <arpa/inet.h>
+#include <endian.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <qdf_types.h>
+
+/**
+ * typedef __qdf_wait_queue_head_t - wait queue emulated with a condvar
+ * @lock: protects the wait/wake handshake
+ * @cond: signalled on every wake up
+ */
+typedef struct {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+} __qdf_wait_queue_head_t;
+
+#define __qdf_init_waitqueue_head(_q) \
+	do { \
+		pthread_mutex_init(&(_q)->lock, NULL); \
+		pthread_cond_init(&(_q)->cond, NULL); \
+	} while (0)
+
+#define __qdf_wait_queue_interruptible(wait_queue, condition) \
+	({ \
+		pthread_mutex_lock(&(wait_queue).lock); \
+		while (!(condition)) \
+			pthread_cond_wait(&(wait_queue).cond, \
+					  &(wait_queue).lock); \
+		pthread_mutex_unlock(&(wait_queue).lock); \
+		0; \
+	})
+
+/* @timeout is in jiffies, which are milliseconds on the host */
+#define __qdf_wait_queue_timeout(wait_queue, condition, timeout) \
+	({ \
+		struct timespec __ts; \
+		long __ret = 1; \
+		clock_gettime(CLOCK_REALTIME, &__ts); \
+		__ts.tv_sec += (timeout) / 1000; \
+		__ts.tv_nsec += ((timeout) % 1000) * 1000000L; \
+		if (__ts.tv_nsec >= 1000000000L) { \
+			__ts.tv_sec++; \
+			__ts.tv_nsec -= 1000000000L; \
+		} \
+		pthread_mutex_lock(&(wait_queue).lock); \
+		while (!(condition)) { \
+			if (pthread_cond_timedwait(&(wait_queue).cond, \
+						   &(wait_queue).lock, \
+						   &__ts)) { \
+				__ret = !!(condition); \
+				break; \
+			} \
+		} \
+		pthread_mutex_unlock(&(wait_queue).lock); \
+		__ret; \
+	})
+
+#define __qdf_wake_up(_q) \
+	do { \
+		pthread_mutex_lock(&(_q)->lock); \
+		pthread_cond_broadcast(&(_q)->cond); \
+		pthread_mutex_unlock(&(_q)->lock); \
+	} while (0)
+
+#define __qdf_wake_up_interruptible(_q) __qdf_wake_up(_q)
+#define __qdf_wake_up_completion(_q) __qdf_wake_up(_q)
+
+#define __qdf_unlikely(_expr) __builtin_expect(!!(_expr), 0)
+#define __qdf_likely(_expr) __builtin_expect(!!(_expr), 1)
+
+#define __QDF_BITS_TO_LONGS(bits) \
+	(((bits) + 8 * sizeof(long) - 1) / (8 * sizeof(long)))
+#define __qdf_bitmap(name, bits) unsigned long name[__QDF_BITS_TO_LONGS(bits)]
+
+static inline void __qdf_set_bit(unsigned int nr, unsigned long *addr)
+{
+	addr[nr / (8 * sizeof(long))] |= 1UL << (nr % (8 * sizeof(long)));
+}
+
+static inline void __qdf_clear_bit(unsigned int nr, unsigned long *addr)
+{
+	addr[nr / (8 * sizeof(long))] &= ~(1UL << (nr % (8 * sizeof(long))));
+}
+
+static inline bool __qdf_test_bit(unsigned int nr, unsigned long *addr)
+{
+	return addr[nr / (8 * sizeof(long))] &
+	       (1UL << (nr % (8 * sizeof(long))));
+}
+
+static inline bool __qdf_test_and_clear_bit(unsigned int nr,
+					    unsigned long *addr)
+{
+	bool set = __qdf_test_bit(nr, addr);
+
+	__qdf_clear_bit(nr, addr);
+	return set;
+}
+
+static inline unsigned long __qdf_find_first_bit(unsigned long *addr,
+						 unsigned long nbits)
+{
+	unsigned long i;
+
+	for (i = 0; i < nbits; i++)
+		if (__qdf_test_bit(i, addr))
+			return i;
+
+	return nbits;
+}
+
+static inline bool __qdf_bitmap_empty(unsigned long *addr,
+				      unsigned long nbits)
+{
+	return __qdf_find_first_bit(addr, nbits) == nbits;
+}
+
+static inline int __qdf_bitmap_and(unsigned long *dst, unsigned long *src1,
+				   unsigned long *src2, unsigned long nbits)
+{
+	unsigned long i;
+	unsigned long res = 0;
+
+	for (i = 0; i < __QDF_BITS_TO_LONGS(nbits); i++) {
+		dst[i] = src1[i] & src2[i];
+		res |= dst[i];
+	}
+
+	return !!res;
+}
+
+static inline void __qdf_set_macaddr_broadcast(struct qdf_mac_addr *mac_addr)
+{
+	memset(mac_addr, 0xff, QDF_MAC_ADDR_SIZE);
+}
+
+static inline void __qdf_zero_macaddr(struct qdf_mac_addr *mac_addr)
+{
+	memset(mac_addr, 0, QDF_MAC_ADDR_SIZE);
+}
+
+static inline bool __qdf_is_macaddr_equal(struct qdf_mac_addr *mac_addr1,
+					  struct qdf_mac_addr *mac_addr2)
+{
+	return !memcmp(mac_addr1, mac_addr2, QDF_MAC_ADDR_SIZE);
+}
+
+#define __qdf_in_interrupt() 0
+
+#define __qdf_min(_a, _b) ((_a) < (_b) ? (_a) : (_b))
+#define __qdf_max(_a, _b) ((_a) > (_b) ? (_a) : (_b))
+
+#define __QDF_DECLARE_EWMA(name, _factor, _weight)
+#define __qdf_ewma_tx_lag int
+#define __qdf_ewma_rx_rssi int
+#define __qdf_ewma_tx_lag_init(tx_lag)
+#define __qdf_ewma_tx_lag_add(tx_lag, value)
+#define __qdf_ewma_tx_lag_read(tx_lag) 0
+#define __qdf_ewma_rx_rssi_init(rx_rssi)
+#define __qdf_ewma_rx_rssi_add(rx_rssi, value)
+#define __qdf_ewma_rx_rssi_read(rx_rssi) 0
+
+#define __qdf_ffz(mask) (~(mask) == 0 ? -1 : __builtin_ctzl(~(mask)))
+
+#define __qdf_assert(expr) do { \
+	if (__qdf_unlikely(!(expr))) { \
+		fprintf(stderr, "Assertion failed! %s:%s %s:%d\n", \
+			#expr, __func__, __FILE__, __LINE__); \
+		QDF_BUG(0); \
+	} \
+} while (0)
+
+#define __qdf_target_assert(expr) __qdf_assert(expr)
+
+#define QDF_COMPILE_TIME_ASSERT(assertion_name, predicate) \
+	typedef char assertion_name[(predicate) ? 1 : -1]
+
+#define __qdf_container_of(ptr, type, member) \
+	((type *)((char *)(ptr) - offsetof(type, member)))
+
+#define __qdf_ntohs ntohs
+#define __qdf_ntohl ntohl
+#define __qdf_htons htons
+#define __qdf_htonl htonl
+
+#define __qdf_cpu_to_le16 htole16
+#define __qdf_cpu_to_le32 htole32
+#define __qdf_cpu_to_le64 htole64
+#define __qdf_le16_to_cpu le16toh
+#define __qdf_le32_to_cpu le32toh
+#define __qdf_le64_to_cpu le64toh
+#define __qdf_cpu_to_be16 htobe16
+#define __qdf_cpu_to_be32 htobe32
+#define __qdf_cpu_to_be64 htobe64
+#define __qdf_be16_to_cpu be16toh
+#define __qdf_be32_to_cpu be32toh
+#define __qdf_be64_to_cpu be64toh
+
+#define __qdf_wmb() __atomic_thread_fence(__ATOMIC_RELEASE)
+#define __qdf_rmb() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define __qdf_mb() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __qdf_ioread32(offset) (*(volatile uint32_t *)(offset))
+#define __qdf_iowrite32(offset, value) \
+	((void)(*(volatile uint32_t *)(offset) = (value)))
+
+#define __qdf_roundup(x, y) ((((x) + ((y) - 1)) / (y)) * (y))
+#define __qdf_ceil(x, y) (((x) + (y) - 1) / (y))
+
+#define __qdf_prefetch(x) __builtin_prefetch(x)
+
+/**
+ * __qdf_get_cpu() - CPU the calling thread currently runs on
+ *
+ * Like the kernel version this is only a hint, the thread may migrate
+ * right after the call.
+ *
+ * Return: cpu id
+ */
+static inline int __qdf_get_cpu(void)
+{
+	int cpu = sched_getcpu();
+
+	return cpu < 0 ? 0 : cpu;
+}
+
+static inline int __qdf_device_init_wakeup(__qdf_device_t qdf_dev, bool enable)
+{
+	return 0;
+}
+
+static inline uint64_t __qdf_get_totalramsize(void)
+{
+	return (uint64_t)sysconf(_SC_PHYS_PAGES) * sysconf(_SC_PAGESIZE) /
+		1024;
+}
+
+static inline uint32_t __qdf_get_lower_32_bits(__qdf_dma_addr_t addr)
+{
+	return (uint32_t)addr;
+}
+
+static inline uint32_t __qdf_get_upper_32_bits(__qdf_dma_addr_t addr)
+{
+	return (uint32_t)((uint64_t)addr >> 32);
+}
+
+static inline unsigned long __qdf_rounddown_pow_of_two(unsigned long n)
+{
+	if (!n)
+		return 0;
+
+	return 1UL << (8 * sizeof(long) - 1 - __builtin_clzl(n));
+}
+
+static inline int __qdf_set_dma_coherent_mask(struct device *dev,
+					      uint8_t addr_bits)
+{
+	return 0;
+}
+
+static inline void __qdf_get_random_bytes(void *buf, int nbytes)
+{
+	uint8_t *p = buf;
+
+	while (nbytes--)
+		*p++ = (uint8_t)random();
+}
+
+static inline uint64_t __qdf_do_div(uint64_t dividend, uint32_t divisor)
+{
+	return dividend / divisor;
+}
+
+static inline uint64_t __qdf_do_div_rem(uint64_t dividend, uint32_t divisor)
+{
+	return dividend % divisor;
+}
+
+static inline int __qdf_hex_to_bin(char ch)
+{
+	if (ch >= '0' && ch <= '9')
+		return ch - '0';
+	ch = tolower(ch);
+	if (ch >= 'a' && ch <= 'f')
+		return ch - 'a' + 10;
+	return -1;
+}
+
+static inline int __qdf_hex_str_to_binary(u8 *dst, const char *src,
+					  size_t count)
+{
+	int hi, lo;
+
+	while (count--) {
+		hi = __qdf_hex_to_bin(*src++);
+		lo = __qdf_hex_to_bin(*src++);
+		if (hi < 0 || lo < 0)
+			return -EINVAL;
+		*dst++ = (hi << 4) | lo;
+	}
+
+	return 0;
+}
+
+static inline int __qdf_fls(uint32_t x)
+{
+	return x ? 32 - __builtin_clz(x) : 0;
+}
+
+static inline int __qdf_get_smp_processor_id(void)
+{
+	return __qdf_get_cpu();
+}
+#endif /*_I_QDF_UTIL_H*/
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: qdf_host.c
+ * Userspace (host test build) implementation of the kernel library
+ * helpers the qdf string and type APIs map to, and of the odd qdf/linux
+ * function the sources built on the host call.
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include "qdf_mc_timer.h"
+#include "qdf_str.h"
+#include "qdf_time.h"
+#include "qdf_types.h"
+
+char *__qdf_str_skip_spaces(const char *str)
+{
+	while (isspace(*str))
+		str++;
+
+	return (char *)str;
+}
+
+char *__qdf_str_strim(char *str)
+{
+	size_t len;
+
+	str = __qdf_str_skip_spaces(str);
+	len = strlen(str);
+	while (len && isspace(str[len - 1]))
+		str[--len] = '\0';
+
+	return str;
+}
+
+ssize_t __qdf_str_strscpy(char *dest, const char *src, size_t dest_size)
+{
+	size_t len;
+
+	if (!dest_size)
+		return -E2BIG;
+
+	len = strnlen(src, dest_size);
+	if (len == dest_size) {
+		memcpy(dest, src, dest_size - 1);
+		dest[dest_size - 1] = '\0';
+		return -E2BIG;
+	}
+
+	memcpy(dest, src, len + 1);
+
+	return len;
+}
+
+/**
+ * qdf_host_kstrtoll() - kstrtoll() over strtoll()
+ * @s: string to parse, a single trailing newline is allowed
+ * @base: number base, 0 to detect it from the prefix
+ * @min: smallest accepted value
+ * @max: largest accepted value
+ * @res: parsed value
+ *
+ * Return: 0 on success, -EINVAL on malformed input, -ERANGE on overflow
+ */
+static int qdf_host_kstrtoll(const char *s, unsigned int base, long long min,
+			     long long max, long long *res)
+{
+	char *end;
+	long long val;
+
+	if (!*s || isspace(*s))
+		return -EINVAL;
+
+	errno = 0;
+	val = strtoll(s, &end, base);
+	if (errno == ERANGE || val < min || val > max)
+		return -ERANGE;
+
+	if (end == s || (*end && strcmp(end, "\n")))
+		return -EINVAL;
+
+	*res = val;
+
+	return 0;
+}
+
+int __qdf_kstrtoint(const char *s, unsigned int base, int *res)
+{
+	long long val;
+	int ret;
+
+	ret = qdf_host_kstrtoll(s, base, INT_MIN, INT_MAX, &val);
+	if (!ret)
+		*res = val;
+
+	return ret;
+}
+
+int __qdf_kstrtouint(const char *s, unsigned int base, unsigned int *res)
+{
+	long long val;
+	int ret;
+
+	if (*s == '-')
+		return -EINVAL;
+
+	ret = qdf_host_kstrtoll(s, base, 0, UINT_MAX, &val);
+	if (!ret)
+		*res = val;
+
+	return ret;
+}
+
+unsigned long qdf_mc_timer_get_system_time(void)
+{
+	return __qdf_clock_ns(CLOCK_MONOTONIC) / 1000000;
+}
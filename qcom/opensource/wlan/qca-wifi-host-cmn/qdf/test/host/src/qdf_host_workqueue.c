@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: qdf_host_workqueue.c
+ * Userspace (host test build) delayed work, see qdf_host_workqueue.h
+ */
+
+#include <pthread.h>
+#include <time.h>
+#include "qdf_host_workqueue.h"
+#include "qdf_time.h"
+
+/**
+ * struct qdf_host_wq - the worker thread and its queue
+ * @lock: protects everything below
+ * @cond: signalled when @head changes or a work completes
+ * @head: pending works, sorted by expiry
+ * @running: work the worker is running, if any
+ * @started: the worker thread has been created
+ * @tid: worker thread id
+ */
+static struct qdf_host_wq {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	struct delayed_work *head;
+	struct delayed_work *running;
+	bool started;
+	pthread_t tid;
+} qdf_host_wq = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.cond = PTHREAD_COND_INITIALIZER,
+};
+
+static void qdf_host_wq_wait_until(struct qdf_host_wq *wq, int64_t ns)
+{
+	struct timespec ts;
+
+	/* the condvar runs on CLOCK_REALTIME, expiries on CLOCK_MONOTONIC */
+	ns += __qdf_clock_ns(CLOCK_REALTIME) - __qdf_clock_ns(CLOCK_MONOTONIC);
+	ts.tv_sec = ns / 1000000000;
+	ts.tv_nsec = ns % 1000000000;
+	pthread_cond_timedwait(&wq->cond, &wq->lock, &ts);
+}
+
+static void *qdf_host_wq_main(void *data)
+{
+	struct qdf_host_wq *wq = data;
+	struct delayed_work *dwork;
+
+	pthread_mutex_lock(&wq->lock);
+	while (true) {
+		dwork = wq->head;
+		if (!dwork) {
+			pthread_cond_wait(&wq->cond, &wq->lock);
+			continue;
+		}
+
+		if (dwork->expires > __qdf_clock_ns(CLOCK_MONOTONIC)) {
+			qdf_host_wq_wait_until(wq, dwork->expires);
+			continue;
+		}
+
+		wq->head = dwork->next;
+		dwork->pending = false;
+		wq->running = dwork;
+		pthread_mutex_unlock(&wq->lock);
+
+		/* the work may requeue or free itself from here on */
+		dwork->work.func(&dwork->work);
+
+		pthread_mutex_lock(&wq->lock);
+		wq->running = NULL;
+		pthread_cond_broadcast(&wq->cond);
+	}
+
+	return NULL;
+}
+
+bool schedule_delayed_work(struct delayed_work *dwork, unsigned long delay)
+{
+	struct qdf_host_wq *wq = &qdf_host_wq;
+	struct delayed_work **pos;
+
+	pthread_mutex_lock(&wq->lock);
+	if (dwork->pending) {
+		pthread_mutex_unlock(&wq->lock);
+		return false;
+	}
+
+	if (!wq->started) {
+		pthread_create(&wq->tid, NULL, qdf_host_wq_main, wq);
+		pthread_detach(wq->tid);
+		wq->started = true;
+	}
+
+	dwork->expires = __qdf_clock_ns(CLOCK_MONOTONIC) +
+			 (int64_t)delay * 1000000;
+	for (pos = &wq->head; *pos; pos = &(*pos)->next) {
+		if ((*pos)->expires > dwork->expires)
+			break;
+	}
+	dwork->next = *pos;
+	*pos = dwork;
+	dwork->pending = true;
+
+	pthread_cond_broadcast(&wq->cond);
+	pthread_mutex_unlock(&wq->lock);
+
+	return true;
+}
+
+static bool __cancel_delayed_work(struct qdf_host_wq *wq,
+				  struct delayed_work *dwork)
+{
+	struct delayed_work **pos;
+
+	if (!dwork->pending)
+		return false;
+
+	for (pos = &wq->head; *pos != dwork; pos = &(*pos)->next)
+		;
+	*pos = dwork->next;
+	dwork->pending = false;
+
+	return true;
+}
+
+bool cancel_delayed_work(struct delayed_work *dwork)
+{
+	struct qdf_host_wq *wq = &qdf_host_wq;
+	bool pending;
+
+	pthread_mutex_lock(&wq->lock);
+	pending = __cancel_delayed_work(wq, dwork);
+	pthread_mutex_unlock(&wq->lock);
+
+	return pending;
+}
+
+bool cancel_delayed_work_sync(struct delayed_work *dwork)
+{
+	struct qdf_host_wq *wq = &qdf_host_wq;
+	bool pending = false;
+
+	pthread_mutex_lock(&wq->lock);
+	/* a running work may requeue itself, cancel until it is idle */
+	do {
+		pending |= __cancel_delayed_work(wq, dwork);
+		if (wq->running == dwork && wq->tid != pthread_self())
+			pthread_cond_wait(&wq->cond, &wq->lock);
+	} while (dwork->pending ||
+		 (wq->running == dwork && wq->tid != pthread_self()));
+	pthread_mutex_unlock(&wq->lock);
+
+	return pending;
+}
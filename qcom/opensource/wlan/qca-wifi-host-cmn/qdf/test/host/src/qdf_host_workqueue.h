@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: qdf_host_workqueue.h
+ * Userspace (host test build) emulation of the kernel delayed work API.
+ *
+ * Works run one at a time on a single worker thread, in expiry order, like
+ * on the kernel system workqueue. Only what the qdf deferred work wrappers
+ * use is provided, so that linux/src/qdf_delayed_work.c and
+ * linux/src/qdf_periodic_work.c build unchanged on the host.
+ */
+
+#ifndef __QDF_HOST_WORKQUEUE_H
+#define __QDF_HOST_WORKQUEUE_H
+
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+struct work_struct;
+typedef void (*work_func_t)(struct work_struct *work);
+
+/**
+ * struct work_struct - work item
+ * @func: work function
+ */
+struct work_struct {
+	work_func_t func;
+};
+
+/**
+ * struct delayed_work - work item run after a delay
+ * @work: the work item
+ * @expires: CLOCK_MONOTONIC ns at which @work is due
+ * @pending: @work is on the worker queue
+ * @next: next item on the worker queue
+ */
+struct delayed_work {
+	struct work_struct work;
+	int64_t expires;
+	bool pending;
+	struct delayed_work *next;
+};
+
+#define INIT_DELAYED_WORK(_dwork, _func) \
+	do { \
+		(_dwork)->work.func = (_func); \
+		(_dwork)->pending = false; \
+		(_dwork)->next = NULL; \
+	} while (0)
+
+#define INIT_DEFERRABLE_WORK(_dwork, _func) INIT_DELAYED_WORK(_dwork, _func)
+
+#define msecs_to_jiffies(msecs) ((unsigned long)(msecs))
+
+#define schedule() sched_yield()
+
+/**
+ * schedule_delayed_work() - queue a delayed work on the worker thread
+ * @dwork: work to queue
+ * @delay: delay in jiffies (ms)
+ *
+ * Return: false if @dwork was already pending, true otherwise
+ */
+bool schedule_delayed_work(struct delayed_work *dwork, unsigned long delay);
+
+/**
+ * cancel_delayed_work() - dequeue a pending delayed work
+ * @dwork: work to cancel
+ *
+ * Return: true if @dwork was pending
+ */
+bool cancel_delayed_work(struct delayed_work *dwork);
+
+/**
+ * cancel_delayed_work_sync() - dequeue a delayed work and wait until it is
+ *	neither pending nor running
+ * @dwork: work to cancel
+ *
+ * Return: true if @dwork was pending
+ */
+bool cancel_delayed_work_sync(struct delayed_work *dwork);
+
+#endif /* __QDF_HOST_WORKQUEUE_H */
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: qdf_mem.c
+ * Userspace (host test build) memory implementation, libc heap
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "qdf_atomic.h"
+#include "qdf_mem.h"
+#include "qdf_trace.h"
+
+static qdf_atomic_t qdf_host_kmalloc_bytes;
+
+void *__qdf_mem_malloc(qdf_size_t size, const char *func, uint32_t line)
+{
+	void *ptr;
+
+	if (!size) {
+		qdf_nofl_err("Cannot malloc 0 bytes @ %s:%d", func, line);
+		return NULL;
+	}
+
+	ptr = calloc(1, size);
+	if (!ptr)
+		qdf_nofl_err("Failed to malloc %zuB @ %s:%d", size, func, line);
+
+	return ptr;
+}
+
+void *qdf_mem_malloc_atomic_fl(qdf_size_t size, const char *func,
+			       uint32_t line)
+{
+	return __qdf_mem_malloc(size, func, line);
+}
+
+void __qdf_mem_free(void *ptr)
+{
+	free(ptr);
+}
+
+void *__qdf_mem_valloc(size_t size, const char *func, uint32_t line)
+{
+	return __qdf_mem_malloc(size, func, line);
+}
+
+void __qdf_mem_vfree(void *ptr)
+{
+	free(ptr);
+}
+
+void *__qdf_mem_alloc_consistent(qdf_device_t osdev, void *dev,
+				 qdf_size_t size, qdf_dma_addr_t *paddr,
+				 const char *func, uint32_t line)
+{
+	void *vaddr = __qdf_mem_malloc(size, func, line);
+
+	*paddr = (qdf_dma_addr_t)(uintptr_t)vaddr;
+
+	return vaddr;
+}
+
+void __qdf_mem_free_consistent(qdf_device_t osdev, void *dev,
+			       qdf_size_t size, void *vaddr,
+			       qdf_dma_addr_t paddr, qdf_dma_context_t memctx)
+{
+	free(vaddr);
+}
+
+void qdf_mem_kmalloc_inc(qdf_size_t size)
+{
+	qdf_atomic_add(size, &qdf_host_kmalloc_bytes);
+}
+
+void qdf_mem_kmalloc_dec(qdf_size_t size)
+{
+	qdf_atomic_sub(size, &qdf_host_kmalloc_bytes);
+}
+
+void qdf_mem_set(void *ptr, uint32_t num_bytes, uint32_t value)
+{
+	QDF_BUG(ptr);
+	if (!ptr)
+		return;
+
+	memset(ptr, value, num_bytes);
+}
+
+void qdf_mem_copy(void *dst_addr, const void *src_addr, uint32_t num_bytes)
+{
+	/* special case where dst_addr or src_addr can be NULL */
+	if (!num_bytes)
+		return;
+
+	QDF_BUG(dst_addr);
+	QDF_BUG(src_addr);
+	if (!dst_addr || !src_addr)
+		return;
+
+	memcpy(dst_addr, src_addr, num_bytes);
+}
+
+void qdf_mem_move(void *dst_addr, const void *src_addr, uint32_t num_bytes)
+{
+	/* special case where dst_addr or src_addr can be NULL */
+	if (!num_bytes)
+		return;
+
+	QDF_BUG(dst_addr);
+	QDF_BUG(src_addr);
+	if (!dst_addr || !src_addr)
+		return;
+
+	memmove(dst_addr, src_addr, num_bytes);
+}
+
+int qdf_mem_cmp(const void *left, const void *right, size_t size)
+{
+	QDF_BUG(left);
+	QDF_BUG(right);
+
+	return memcmp(left, right, size);
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: qdf_nbuf.h
+ * Host test build replacement of the network buffer API.
+ *
+ * Network buffers wrap sk_buff and have no userspace equivalent, so the host
+ * build only provides the opaque type the rest of qdf/inc refers to, and the
+ * few buffer helpers HAL inlines call. This header shadows qdf/inc/qdf_nbuf.h
+ * on the host include path.
+ */
+
+#ifndef _QDF_NBUF_H
+#define _QDF_NBUF_H
+
+#include <qdf_types.h>
+
+struct sk_buff;
+struct mon_rx_status;
+
+typedef struct qdf_nbuf_host *qdf_nbuf_t;
+
+/* qdf_trace.h refers to qdf_nbuf_t, it has to come after the typedef */
+#include <i_qdf_trace.h>
+#include <qdf_trace.h>
+#include <qdf_util.h>
+
+/**
+ * qdf_nbuf_dma_inv_range() - Invalidate the specified virtual address range
+ * @buf_start: start address
+ * @buf_end: end address
+ *
+ * Host memory is coherent, there is nothing to invalidate.
+ *
+ * Return: none
+ */
+static inline void
+qdf_nbuf_dma_inv_range(const void *buf_start, const void *buf_end)
+{
+}
+
+#endif /* _QDF_NBUF_H */
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: qdf_rcu.c
+ * Userspace (host test build) read-copy-update, see i_qdf_rcu.h
+ */
+
+#include <pthread.h>
+#include "qdf_types.h"
+#include "qdf_rcu.h"
+
+/**
+ * struct qdf_host_rcu - grace period and reclaim state
+ * @gp_lock: read side held by readers, write side taken for a grace period
+ * @lock: protects the fields below
+ * @cond: signalled when callbacks are queued or have been run
+ * @head: callbacks queued since the reclaimer last ran, newest first
+ * @queued: callbacks queued so far
+ * @done: callbacks run so far
+ * @started: the reclaim thread has been created
+ * @tid: reclaim thread id
+ */
+static struct qdf_host_rcu {
+	pthread_rwlock_t gp_lock;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	struct rcu_head *head;
+	uint64_t queued;
+	uint64_t done;
+	bool started;
+	pthread_t tid;
+} qdf_host_rcu = {
+	.gp_lock = PTHREAD_RWLOCK_WRITER_NONRECURSIVE_INITIALIZER_NP,
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.cond = PTHREAD_COND_INITIALIZER,
+};
+
+static __thread uint32_t qdf_host_rcu_nesting;
+
+void __qdf_host_rcu_read_lock(void)
+{
+	if (!qdf_host_rcu_nesting++)
+		pthread_rwlock_rdlock(&qdf_host_rcu.gp_lock);
+}
+
+void __qdf_host_rcu_read_unlock(void)
+{
+	if (!--qdf_host_rcu_nesting)
+		pthread_rwlock_unlock(&qdf_host_rcu.gp_lock);
+}
+
+void __qdf_host_synchronize_rcu(void)
+{
+	/* once the write side is acquired, all prior readers are done */
+	pthread_rwlock_wrlock(&qdf_host_rcu.gp_lock);
+	pthread_rwlock_unlock(&qdf_host_rcu.gp_lock);
+}
+
+static void *qdf_host_rcu_main(void *data)
+{
+	struct qdf_host_rcu *rcu = data;
+	struct rcu_head *head;
+	struct rcu_head *next;
+	uint64_t count;
+
+	pthread_mutex_lock(&rcu->lock);
+	while (true) {
+		if (!rcu->head) {
+			pthread_cond_wait(&rcu->cond, &rcu->lock);
+			continue;
+		}
+
+		head = rcu->head;
+		rcu->head = NULL;
+		pthread_mutex_unlock(&rcu->lock);
+
+		__qdf_host_synchronize_rcu();
+		for (count = 0; head; head = next, count++) {
+			next = head->next;
+			head->func(head);
+		}
+
+		pthread_mutex_lock(&rcu->lock);
+		rcu->done += count;
+		pthread_cond_broadcast(&rcu->cond);
+	}
+
+	return NULL;
+}
+
+void __qdf_host_call_rcu(struct rcu_head *head,
+			 void (*func)(struct rcu_head *head))
+{
+	struct qdf_host_rcu *rcu = &qdf_host_rcu;
+
+	head->func = func;
+
+	pthread_mutex_lock(&rcu->lock);
+	if (!rcu->started) {
+		pthread_create(&rcu->tid, NULL, qdf_host_rcu_main, rcu);
+		pthread_detach(rcu->tid);
+		rcu->started = true;
+	}
+
+	head->next = rcu->head;
+	rcu->head = head;
+	rcu->queued++;
+	pthread_cond_broadcast(&rcu->cond);
+	pthread_mutex_unlock(&rcu->lock);
+}
+
+void __qdf_host_rcu_barrier(void)
+{
+	struct qdf_host_rcu *rcu = &qdf_host_rcu;
+	uint64_t target;
+
+	pthread_mutex_lock(&rcu->lock);
+	target = rcu->queued;
+	while (rcu->done < target)
+		pthread_cond_wait(&rcu->cond, &rcu->lock);
+	pthread_mutex_unlock(&rcu->lock);
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: qdf_threads.c
+ * Userspace (host test build) thread implementation over pthreads.
+ *
+ * As with kthreads, a thread made by qdf_create_thread() only starts
+ * running on qdf_wake_up_process(), and qdf_thread_join() raises
+ * qdf_thread_should_stop() for the thread before waiting for it to exit.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "qdf_atomic.h"
+#include "qdf_mem.h"
+#include "qdf_str.h"
+#include "qdf_threads.h"
+#include "qdf_time.h"
+#include "qdf_trace.h"
+
+static __thread qdf_thread_t *qdf_host_current;
+static qdf_atomic_t qdf_thread_id;
+
+void qdf_sleep(uint32_t ms_interval)
+{
+	qdf_sleep_us(ms_interval * 1000);
+}
+
+void qdf_sleep_us(uint32_t us_interval)
+{
+	struct timespec ts = {
+		.tv_sec = us_interval / 1000000,
+		.tv_nsec = (us_interval % 1000000) * 1000,
+	};
+
+	while (nanosleep(&ts, &ts) && errno == EINTR)
+		;
+}
+
+void qdf_busy_wait(uint32_t us_interval)
+{
+	int64_t end = __qdf_clock_ns(CLOCK_MONOTONIC) +
+		      (int64_t)us_interval * 1000;
+
+	while (__qdf_clock_ns(CLOCK_MONOTONIC) < end)
+		;
+}
+
+static void *qdf_host_thread_main(void *data)
+{
+	qdf_thread_t *thread = data;
+
+	qdf_host_current = thread;
+	if (thread->callback)
+		thread->status = thread->callback(thread->context);
+	else
+		thread->status = (QDF_STATUS)thread->handler(thread->context);
+
+	return NULL;
+}
+
+static qdf_thread_t *qdf_host_thread_alloc(const char *name)
+{
+	qdf_thread_t *thread;
+
+	thread = qdf_mem_malloc(sizeof(*thread));
+	if (!thread)
+		return NULL;
+
+	qdf_str_lcopy(thread->name, name, sizeof(thread->name));
+
+	return thread;
+}
+
+qdf_thread_t *qdf_create_thread(int (*thread_handler)(void *data), void *data,
+				const char thread_name[])
+{
+	qdf_thread_t *thread = qdf_host_thread_alloc(thread_name);
+
+	if (!thread)
+		return NULL;
+
+	thread->handler = thread_handler;
+	thread->context = data;
+
+	return thread;
+}
+
+int qdf_wake_up_process(qdf_thread_t *thread)
+{
+	if (thread->started)
+		return 0;
+
+	if (pthread_create(&thread->tid, NULL, qdf_host_thread_main, thread))
+		return 0;
+
+	thread->started = true;
+
+	return 1;
+}
+
+qdf_thread_t *qdf_thread_run(qdf_thread_func callback, void *context)
+{
+	qdf_thread_t *thread;
+	char name[sizeof(thread->name)];
+
+	snprintf(name, sizeof(name), "qdf %u",
+		 qdf_atomic_inc_return(&qdf_thread_id) - 1);
+	thread = qdf_host_thread_alloc(name);
+	if (!thread)
+		return NULL;
+
+	thread->callback = callback;
+	thread->context = context;
+	if (!qdf_wake_up_process(thread)) {
+		qdf_mem_free(thread);
+		return NULL;
+	}
+
+	return thread;
+}
+
+QDF_STATUS qdf_thread_join(qdf_thread_t *thread)
+{
+	QDF_STATUS status = QDF_STATUS_E_INVAL;
+
+	QDF_BUG(thread);
+
+	thread->should_stop = true;
+	if (thread->started) {
+		pthread_join(thread->tid, NULL);
+		status = thread->status;
+	}
+	qdf_mem_free(thread);
+
+	return status;
+}
+
+bool qdf_thread_should_stop(void)
+{
+	return qdf_host_current && qdf_host_current->should_stop;
+}
+
+qdf_thread_t *qdf_get_current_task(void)
+{
+	return qdf_host_current;
+}
+
+int qdf_get_current_pid(void)
+{
+	return gettid();
+}
+
+const char *qdf_get_current_comm(void)
+{
+	return qdf_host_current ? qdf_host_current->name : "main";
+}
+
+void qdf_set_wake_up_idle(bool idle)
+{
+}
+
+void qdf_set_user_nice(qdf_thread_t *thread, long nice)
+{
+}
+
+void qdf_print_thread_trace(qdf_thread_t *thread)
+{
+}
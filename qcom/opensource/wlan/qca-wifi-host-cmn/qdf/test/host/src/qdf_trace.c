@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * DOC: qdf_trace.c
+ * Userspace (host test build) trace and assert implementation
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include "qdf_atomic.h"
+#include "qdf_trace.h"
+
+static QDF_TRACE_LEVEL qdf_host_trace_level = QDF_TRACE_LEVEL_INFO;
+static qdf_atomic_t qdf_host_bug_count;
+
+void qdf_host_trace_set_level(QDF_TRACE_LEVEL level)
+{
+	qdf_host_trace_level = level;
+}
+
+void qdf_vtrace_msg(QDF_MODULE_ID module, QDF_TRACE_LEVEL level,
+		    const char *str_format, va_list val)
+{
+	if (level > qdf_host_trace_level)
+		return;
+
+	vfprintf(stderr, str_format, val);
+	fputc('\n', stderr);
+}
+
+void qdf_trace_msg(QDF_MODULE_ID module, QDF_TRACE_LEVEL level,
+		   const char *str_format, ...)
+{
+	va_list val;
+
+	va_start(val, str_format);
+	qdf_vtrace_msg(module, level, str_format, val);
+	va_end(val);
+}
+
+void qdf_trace_hex_dump(QDF_MODULE_ID module, QDF_TRACE_LEVEL level,
+			void *data, int buf_len)
+{
+	const uint8_t *buf = data;
+	int i;
+
+	if (level > qdf_host_trace_level)
+		return;
+
+	for (i = 0; i < buf_len; i++)
+		fprintf(stderr, "%02x%c", buf[i],
+			(i % 16 == 15 || i == buf_len - 1) ? '\n' : ' ');
+}
+
+int scnprintf(char *buf, size_t size, const char *fmt, ...)
+{
+	va_list args;
+	int len;
+
+	if (!size)
+		return 0;
+
+	va_start(args, fmt);
+	len = vsnprintf(buf, size, fmt, args);
+	va_end(args);
+
+	if (len < 0)
+		return 0;
+
+	return (size_t)len >= size ? size - 1 : len;
+}
+
+void __qdf_bug(void)
+{
+	qdf_atomic_inc(&qdf_host_bug_count);
+}
+
+uint32_t __qdf_bug_count(void)
+{
+	return qdf_atomic_read(&qdf_host_bug_count);
+}
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_atomic.h"
+#include "qdf_bench_test.h"
+#include "qdf_flex_mem.h"
+#include "qdf_list.h"
+#include "qdf_mem.h"
+#include "qdf_ptr_hash.h"
+#include "qdf_ptr_rhash.h"
+#include "qdf_rcu.h"
+#include "qdf_threads.h"
+#include "qdf_time.h"
+#include "qdf_trace.h"
+
+#define qdf_bench_item_count 4096
+#define qdf_bench_rounds 64
+#define qdf_bench_ptr_hash_bits 10
+#define qdf_bench_flex_mem_batch 64
+#define qdf_bench_thread_count 4
+
+/**
+ * qdf_bench_report() - print the result of one benchmark
+ * @name: benchmark name
+ * @ops: number of operations timed
+ * @start: qdf_ktime_get() when the timed section started
+ *
+ * Return: None
+ */
+static void qdf_bench_report(const char *name, uint64_t ops,
+			     qdf_ktime_t start)
+{
+	uint64_t elapsed_ns = qdf_ktime_to_ns(qdf_ktime_get()) -
+			      qdf_ktime_to_ns(start);
+
+	qdf_nofl_info("bench %-24s %10llu ops %12llu ns %6llu ns/op",
+		      name, (unsigned long long)ops,
+		      (unsigned long long)elapsed_ns,
+		      (unsigned long long)qdf_do_div(elapsed_ns,
+						     (uint32_t)(ops ? ops : 1)));
+}
+
+struct qdf_bench_ptr_hash_item {
+	uint32_t id;
+	struct qdf_ptr_hash_entry entry;
+};
+
+static uint32_t qdf_bench_ptr_hash(void)
+{
+	struct qdf_bench_ptr_hash_item *items;
+	struct qdf_bench_ptr_hash_item *item;
+	struct qdf_ptr_hash *ht;
+	qdf_ktime_t start;
+	int round;
+	int i;
+
+	items = qdf_mem_malloc(sizeof(*items) * qdf_bench_item_count);
+	QDF_BUG(items);
+	if (!items)
+		return 1;
+
+	ht = qdf_ptr_hash_create(qdf_bench_ptr_hash_bits);
+	QDF_BUG(ht);
+	if (!ht) {
+		qdf_mem_free(items);
+		return 1;
+	}
+
+	start = qdf_ktime_get();
+	for (i = 0; i < qdf_bench_item_count; i++) {
+		items[i].id = i;
+		qdf_ptr_hash_add(ht, &items[i], &items[i], entry);
+	}
+	qdf_bench_report("ptr_hash add", qdf_bench_item_count, start);
+
+	start = qdf_ktime_get();
+	for (round = 0; round < qdf_bench_rounds; round++) {
+		for (i = 0; i < qdf_bench_item_count; i++) {
+			item = qdf_ptr_hash_get(ht, &items[i], item, entry);
+			QDF_BUG(item && item->id == i);
+		}
+	}
+	qdf_bench_report("ptr_hash get",
+			 qdf_bench_item_count * qdf_bench_rounds, start);
+
+	start = qdf_ktime_get();
+	for (round = 0; round < qdf_bench_rounds; round++) {
+		for (i = 0; i < qdf_bench_item_count; i++)
+			QDF_BUG(!qdf_ptr_hash_get(ht, &items[i].entry, item,
+						  entry));
+	}
+	qdf_bench_report("ptr_hash miss",
+			 qdf_bench_item_count * qdf_bench_rounds, start);
+
+	start = qdf_ktime_get();
+	for (i = 0; i < qdf_bench_item_count; i++) {
+		item = qdf_ptr_hash_remove(ht, &items[i], item, entry);
+		QDF_BUG(item && item->id == i);
+	}
+	qdf_bench_report("ptr_hash remove", qdf_bench_item_count, start);
+
+	QDF_BUG(qdf_ptr_hash_empty(ht));
+
+	qdf_ptr_hash_destroy(ht);
+	qdf_mem_free(items);
+
+	return 0;
+}
+
+struct qdf_bench_ptr_rhash_item {
+	uint32_t id;
+	struct qdf_ptr_rhash_entry entry;
+};
+
+static uint32_t qdf_bench_ptr_rhash(void)
+{
+	struct qdf_bench_ptr_rhash_item *items;
+	struct qdf_bench_ptr_rhash_item *item;
+	struct qdf_ptr_hash_stats stats;
+	struct qdf_ptr_rhash *ht;
+	qdf_ktime_t start;
+	int round;
+	int i;
+
+	items = qdf_mem_malloc(sizeof(*items) * qdf_bench_item_count);
+	QDF_BUG(items);
+	if (!items)
+		return 1;
+
+	/* starts small, has to grow to the size of the fixed table above */
+	ht = qdf_ptr_rhash_create(2, qdf_bench_ptr_hash_bits + 2);
+	QDF_BUG(ht);
+	if (!ht) {
+		qdf_mem_free(items);
+		return 1;
+	}
+
+	start = qdf_ktime_get();
+	for (i = 0; i < qdf_bench_item_count; i++) {
+		items[i].id = i;
+		qdf_ptr_rhash_add(ht, &items[i], &items[i], entry);
+	}
+	qdf_bench_report("ptr_rhash add", qdf_bench_item_count, start);
+
+	start = qdf_ktime_get();
+	qdf_rcu_read_lock();
+	for (round = 0; round < qdf_bench_rounds; round++) {
+		for (i = 0; i < qdf_bench_item_count; i++) {
+			item = qdf_ptr_rhash_get(ht, &items[i], item, entry);
+			QDF_BUG(item && item->id == i);
+		}
+	}
+	qdf_rcu_read_unlock();
+	qdf_bench_report("ptr_rhash get",
+			 qdf_bench_item_count * qdf_bench_rounds, start);
+
+	qdf_ptr_rhash_get_stats(ht, &stats);
+	qdf_ptr_hash_print_stats("bench ptr_rhash", &stats);
+
+	start = qdf_ktime_get();
+	for (i = 0; i < qdf_bench_item_count; i++) {
+		item = qdf_ptr_rhash_remove(ht, &items[i], item, entry);
+		QDF_BUG(item && item->id == i);
+	}
+	qdf_bench_report("ptr_rhash remove", qdf_bench_item_count, start);
+
+	QDF_BUG(qdf_ptr_rhash_empty(ht));
+
+	qdf_ptr_rhash_destroy(ht);
+	qdf_mem_free(items);
+
+	return 0;
+}
+
+DEFINE_QDF_FLEX_MEM_POOL(qdf_bench_flex_mem_pool, sizeof(uintptr_t), 0);
+
+/**
+ * qdf_bench_flex_mem_run() - alloc and free batches of flex_mem items
+ * @pool: pool to allocate from
+ * @batches: number of batches
+ *
+ * Every item is tagged with an address unique to the calling thread, so an
+ * item handed out twice at the same time is detected.
+ *
+ * Return: number of items found corrupted
+ */
+static uint32_t qdf_bench_flex_mem_run(struct qdf_flex_mem_pool *pool,
+				       uint32_t batches)
+{
+	uintptr_t *items[qdf_bench_flex_mem_batch];
+	uintptr_t tag = (uintptr_t)&items;
+	uint32_t errors = 0;
+	uint32_t batch;
+	int i;
+
+	for (batch = 0; batch < batches; batch++) {
+		for (i = 0; i < qdf_bench_flex_mem_batch; i++) {
+			items[i] = qdf_flex_mem_alloc(pool);
+			if (!items[i])
+				return errors + 1;
+			*items[i] = tag;
+		}
+
+		for (i = 0; i < qdf_bench_flex_mem_batch; i++) {
+			if (*items[i] != tag)
+				errors++;
+			qdf_flex_mem_free(pool, items[i]);
+		}
+	}
+
+	return errors;
+}
+
+struct qdf_bench_flex_mem_ctx {
+	struct qdf_flex_mem_pool *pool;
+	qdf_atomic_t errors;
+	qdf_atomic_t done;
+};
+
+static QDF_STATUS qdf_bench_flex_mem_worker(void *context)
+{
+	struct qdf_bench_flex_mem_ctx *ctx = context;
+	uint32_t errors;
+
+	errors = qdf_bench_flex_mem_run(ctx->pool, qdf_bench_item_count /
+					qdf_bench_flex_mem_batch *
+					qdf_bench_rounds);
+	qdf_atomic_add(errors, &ctx->errors);
+
+	qdf_atomic_inc(&ctx->done);
+	while (!qdf_thread_should_stop())
+		qdf_sleep(1);
+
+	return QDF_STATUS_SUCCESS;
+}
+
+static uint32_t qdf_bench_flex_mem(void)
+{
+	struct qdf_bench_flex_mem_ctx ctx;
+	qdf_thread_t *workers[qdf_bench_thread_count];
+	uint32_t batches = qdf_bench_item_count / qdf_bench_flex_mem_batch *
+			   qdf_bench_rounds;
+	qdf_ktime_t start;
+	int i;
+
+	qdf_flex_mem_init(&qdf_bench_flex_mem_pool);
+
+	start = qdf_ktime_get();
+	QDF_BUG(!qdf_bench_flex_mem_run(&qdf_bench_flex_mem_pool, batches));
+	qdf_bench_report("flex_mem alloc+free",
+			 batches * qdf_bench_flex_mem_batch, start);
+
+	qdf_mem_zero(&ctx, sizeof(ctx));
+	ctx.pool = &qdf_bench_flex_mem_pool;
+	qdf_atomic_init(&ctx.errors);
+	qdf_atomic_init(&ctx.done);
+
+	start = qdf_ktime_get();
+	for (i = 0; i < qdf_bench_thread_count; i++) {
+		workers[i] = qdf_thread_run(qdf_bench_flex_mem_worker, &ctx);
+		QDF_BUG(workers[i]);
+		if (!workers[i])
+			qdf_atomic_inc(&ctx.done);
+	}
+
+	while (qdf_atomic_read(&ctx.done) < qdf_bench_thread_count)
+		qdf_sleep(1);
+	qdf_bench_report("flex_mem alloc+free mt",
+			 (uint64_t)batches * qdf_bench_flex_mem_batch *
+			 qdf_bench_thread_count, start);
+
+	for (i = 0; i < qdf_bench_thread_count; i++) {
+		if (workers[i])
+			qdf_thread_join(workers[i]);
+	}
+
+	/* no item was ever handed out to two threads at once */
+	QDF_BUG(!qdf_atomic_read(&ctx.errors));
+
+	qdf_flex_mem_deinit(&qdf_bench_flex_mem_pool);
+
+	return 0;
+}
+
+struct qdf_bench_list_item {
+	uint32_t id;
+	qdf_list_node_t node;
+};
+
+static uint32_t qdf_bench_list(void)
+{
+	struct qdf_bench_list_item *items;
+	struct qdf_bench_list_item *item;
+	qdf_list_node_t *node;
+	qdf_list_t list;
+	qdf_ktime_t start;
+	int round;
+	int i;
+
+	items = qdf_mem_malloc(sizeof(*items) * qdf_bench_item_count);
+	QDF_BUG(items);
+	if (!items)
+		return 1;
+
+	qdf_list_create(&list, qdf_bench_item_count);
+
+	start = qdf_ktime_get();
+	for (round = 0; round < qdf_bench_rounds; round++) {
+		for (i = 0; i < qdf_bench_item_count; i++) {
+			items[i].id = i;
+			qdf_list_insert_back(&list, &items[i].node);
+		}
+
+		for (i = 0; i < qdf_bench_item_count; i++) {
+			QDF_BUG(QDF_IS_STATUS_SUCCESS(
+				qdf_list_remove_front(&list, &node)));
+			item = qdf_container_of(node, struct qdf_bench_list_item,
+						node);
+			QDF_BUG(item->id == i);
+		}
+	}
+	qdf_bench_report("list insert+remove",
+			 qdf_bench_item_count * qdf_bench_rounds, start);
+
+	QDF_BUG(qdf_list_empty(&list));
+
+	qdf_list_destroy(&list);
+	qdf_mem_free(items);
+
+	return 0;
+}
+
+uint32_t qdf_bench_unit_test(void)
+{
+	uint32_t errors = 0;
+
+	errors += qdf_bench_ptr_hash();
+	errors += qdf_bench_ptr_rhash();
+	errors += qdf_bench_flex_mem();
+	errors += qdf_bench_list();
+
+	return errors;
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "qdf_atomic.h"
+#include "qdf_mem.h"
+#include "qdf_mempool_test.h"
+#include "qdf_threads.h"
+#include "qdf_time.h"
+#include "qdf_trace.h"
+#include "qdf_util.h"
+
+#define qdf_mempool_test_thread_count 4
+#define qdf_mempool_test_elem_count 1024
+#define qdf_mempool_test_elem_size 64
+#define qdf_mempool_test_iterations 100000
+#define qdf_mempool_test_bulk 8
+
+struct qdf_mempool_test_ctx {
+	qdf_device_t osdev;
+	qdf_mempool_t pool;
+	qdf_atomic_t ops;
+	qdf_atomic_t errors;
+	qdf_atomic_t done;
+};
+
+static QDF_STATUS qdf_mempool_test_worker(void *context)
+{
+	struct qdf_mempool_test_ctx *ctx = context;
+	void *elems[qdf_mempool_test_bulk];
+	/* the address of a local is unique to this thread */
+	uintptr_t tag = (uintptr_t)&elems;
+	uint32_t i;
+	int num;
+	int j;
+
+	for (i = 0; i < qdf_mempool_test_iterations; i++) {
+		/* alternate single and bulk operations */
+		if (i & 1) {
+			num = qdf_mempool_alloc_bulk(ctx->osdev, ctx->pool,
+						     elems,
+						     qdf_mempool_test_bulk);
+		} else {
+			elems[0] = qdf_mempool_alloc(ctx->osdev, ctx->pool);
+			num = elems[0] ? 1 : 0;
+		}
+
+		/* an element handed out twice gets its tag overwritten */
+		for (j = 0; j < num; j++)
+			*(uintptr_t *)elems[j] = tag;
+		for (j = 0; j < num; j++) {
+			if (*(uintptr_t *)elems[j] != tag)
+				qdf_atomic_inc(&ctx->errors);
+		}
+
+		if (i & 1)
+			qdf_mempool_free_bulk(ctx->osdev, ctx->pool, elems,
+					      num);
+		else if (num)
+			qdf_mempool_free(ctx->osdev, ctx->pool, elems[0]);
+
+		qdf_atomic_add(num, &ctx->ops);
+	}
+
+	qdf_atomic_inc(&ctx->done);
+	while (!qdf_thread_should_stop())
+		qdf_sleep(1);
+
+	return QDF_STATUS_SUCCESS;
+}
+
+static uint32_t qdf_mempool_test_throughput(struct qdf_mempool_test_ctx *ctx)
+{
+	qdf_thread_t *workers[qdf_mempool_test_thread_count];
+	uint64_t start_us, elapsed_us;
+	int i;
+
+	start_us = qdf_get_log_timestamp_usecs();
+	for (i = 0; i < qdf_mempool_test_thread_count; i++) {
+		workers[i] = qdf_thread_run(qdf_mempool_test_worker, ctx);
+		QDF_BUG(workers[i]);
+		if (!workers[i])
+			qdf_atomic_inc(&ctx->done);
+	}
+
+	while (qdf_atomic_read(&ctx->done) < qdf_mempool_test_thread_count)
+		qdf_sleep(1);
+	elapsed_us = qdf_get_log_timestamp_usecs() - start_us;
+
+	for (i = 0; i < qdf_mempool_test_thread_count; i++) {
+		if (workers[i])
+			qdf_thread_join(workers[i]);
+	}
+
+	qdf_nofl_info("mempool %s: %d threads, %d alloc/free in %llu us, %llu per ms",
+		      qdf_prealloc_disabled_config_get() ? "kmalloc" :
+		      "prealloc", qdf_mempool_test_thread_count,
+		      qdf_atomic_read(&ctx->ops), elapsed_us,
+		      qdf_do_div((uint64_t)qdf_atomic_read(&ctx->ops) * 1000,
+				 (uint32_t)elapsed_us + 1));
+
+	/* no element was ever handed out to two threads at once */
+	QDF_BUG(!qdf_atomic_read(&ctx->errors));
+
+	return 0;
+}
+
+static uint32_t qdf_mempool_test_capacity(struct qdf_mempool_test_ctx *ctx)
+{
+	void **elems;
+	int num;
+
+	elems = qdf_mem_malloc(sizeof(*elems) * qdf_mempool_test_elem_count);
+	QDF_BUG(elems);
+	if (!elems)
+		return 1;
+
+	/* elements cached per CPU by the workers are all reachable */
+	num = qdf_mempool_alloc_bulk(ctx->osdev, ctx->pool, elems,
+				     qdf_mempool_test_elem_count);
+	QDF_BUG(num == qdf_mempool_test_elem_count);
+
+	qdf_mempool_free_bulk(ctx->osdev, ctx->pool, elems, num);
+	qdf_mem_free(elems);
+
+	return 0;
+}
+
+uint32_t qdf_mempool_unit_test(void)
+{
+	struct qdf_mempool_test_ctx ctx;
+	uint32_t errors = 0;
+
+	qdf_mem_zero(&ctx, sizeof(ctx));
+	ctx.osdev = qdf_mem_malloc(sizeof(*ctx.osdev));
+	QDF_BUG(ctx.osdev);
+	if (!ctx.osdev)
+		return 1;
+
+	if (qdf_mempool_init(ctx.osdev, &ctx.pool,
+			     qdf_mempool_test_elem_count,
+			     qdf_mempool_test_elem_size, 0)) {
+		QDF_BUG(0);
+		qdf_mem_free(ctx.osdev);
+		return 1;
+	}
+
+	errors += qdf_mempool_test_throughput(&ctx);
+	errors += qdf_mempool_test_capacity(&ctx);
+
+	qdf_mempool_destroy(ctx.osdev, ctx.pool);
+	qdf_mem_free(ctx.osdev);
+
+	return errors;
+}
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2019 The Linux Foundation. All rights reserved.
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
  *
  * Permission to use, copy, modify, and/or distribute this software for
  * any purpose with or without fee is hereby granted, provided that the
@@ -16,18 +17,34 @@
  * PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include "qdf_atomic.h"
+#include "qdf_mem.h"
 #include "qdf_ptr_hash.h"
 #include "qdf_ptr_hash_test.h"
+#include "qdf_ptr_rhash.h"
+#include "qdf_threads.h"
 #include "qdf_trace.h"
 
 #define qdf_ptr_hash_bits 4 /* 16 buckets */
 #define qdf_ptr_hash_entry_count 10
 
+#define qdf_ptr_rhash_min_bits 2
+#define qdf_ptr_rhash_max_bits 12
+#define qdf_ptr_rhash_entry_count 2048
+#define qdf_ptr_rhash_fixed_count 64
+#define qdf_ptr_rhash_reader_count 2
+#define qdf_ptr_rhash_rounds 8
+
 struct qdf_ptr_hash_test_item {
 	uint32_t id;
 	struct qdf_ptr_hash_entry entry;
 };
 
+struct qdf_ptr_rhash_test_item {
+	uint32_t id;
+	struct qdf_ptr_rhash_entry entry;
+};
+
 static uint32_t __qdf_ptr_hash_test_empty(struct qdf_ptr_hash *ht)
 {
 	struct qdf_ptr_hash_test_item *item;
@@ -182,6 +199,226 @@ static uint32_t qdf_ptr_hash_test_create_destroy(void)
 	return errors;
 }
 
+static uint32_t qdf_ptr_hash_test_stats(void)
+{
+	qdf_ptr_hash_declare_ptr(ht, qdf_ptr_hash_bits);
+	struct qdf_ptr_hash_test_item items[qdf_ptr_hash_entry_count];
+	struct qdf_ptr_hash_test_item *item;
+	struct qdf_ptr_hash_stats stats;
+	uint32_t buckets = 0;
+	int i;
+
+	qdf_ptr_hash_init(ht);
+	for (i = 0; i < qdf_ptr_hash_entry_count; i++)
+		qdf_ptr_hash_add(ht, &items[i], &items[i], entry);
+
+	/* the stats of a ptr_hash with items should ... */
+	qdf_ptr_hash_get_stats(ht, &stats);
+
+	/* ... account for all items and buckets */
+	QDF_BUG(stats.entries == qdf_ptr_hash_entry_count);
+	QDF_BUG(stats.buckets == 1 << qdf_ptr_hash_bits);
+	for (i = 0; i < QDF_PTR_HASH_CHAIN_HIST_SIZE; i++)
+		buckets += stats.chain_hist[i];
+	QDF_BUG(buckets == stats.buckets);
+
+	/* ... report a longest chain consistent with the histogram */
+	QDF_BUG(stats.max_chain);
+	QDF_BUG(stats.max_chain >= QDF_PTR_HASH_CHAIN_HIST_SIZE - 1 ||
+		stats.chain_hist[stats.max_chain]);
+
+	for (i = 0; i < qdf_ptr_hash_entry_count; i++)
+		qdf_ptr_hash_remove(ht, &items[i], item, entry);
+	qdf_ptr_hash_deinit(ht);
+
+	return 0;
+}
+
+static uint32_t qdf_ptr_rhash_test_resize(void)
+{
+	struct qdf_ptr_rhash_test_item *items;
+	struct qdf_ptr_rhash_test_item *item;
+	struct qdf_ptr_hash_stats stats;
+	struct qdf_ptr_rhash *ht;
+	int i;
+
+	items = qdf_mem_malloc(sizeof(*items) * qdf_ptr_rhash_entry_count);
+	QDF_BUG(items);
+	if (!items)
+		return 1;
+
+	ht = qdf_ptr_rhash_create(qdf_ptr_rhash_min_bits,
+				  qdf_ptr_rhash_max_bits);
+	QDF_BUG(ht);
+	if (!ht) {
+		qdf_mem_free(items);
+		return 1;
+	}
+
+	/* a new ptr_rhash should be empty */
+	QDF_BUG(qdf_ptr_rhash_empty(ht));
+	QDF_BUG(!qdf_ptr_rhash_get(ht, NULL, item, entry));
+
+	/* a ptr_rhash with items should ... */
+	for (i = 0; i < qdf_ptr_rhash_entry_count; i++) {
+		/* (a rehash can only start once the last replaced table is
+		 * freed, don't let grace periods lag behind)
+		 */
+		if (qdf_atomic_read(&ht->retiring))
+			qdf_rcu_barrier();
+
+		items[i].id = i;
+		qdf_ptr_rhash_add(ht, &items[i], &items[i], entry);
+
+		/* ... get() all items at every step of the rehash */
+		item = qdf_ptr_rhash_get(ht, &items[i / 2], item, entry);
+		QDF_BUG(item && item->id == i / 2);
+	}
+
+	/* ... not be empty */
+	QDF_BUG(!qdf_ptr_rhash_empty(ht));
+
+	/* ... have grown, keeping chains short */
+	qdf_ptr_rhash_get_stats(ht, &stats);
+	QDF_BUG(stats.entries == qdf_ptr_rhash_entry_count);
+	QDF_BUG(stats.resizes);
+	QDF_BUG(stats.buckets > 1 << qdf_ptr_rhash_min_bits);
+	QDF_BUG(stats.entries * 100 <=
+		stats.buckets * QDF_PTR_RHASH_MAX_LOAD * 2);
+
+	/* ... be able to get() all items previously add()'d */
+	for (i = 0; i < qdf_ptr_rhash_entry_count; i++) {
+		item = qdf_ptr_rhash_get(ht, &items[i], item, entry);
+		QDF_BUG(item && item->id == i);
+	}
+
+	/* ... be able to remove() all items previously add()'d */
+	for (i = 0; i < qdf_ptr_rhash_entry_count; i++) {
+		item = qdf_ptr_rhash_remove(ht, &items[i], item, entry);
+		QDF_BUG(item && item->id == i);
+		QDF_BUG(!qdf_ptr_rhash_get(ht, &items[i], item, entry));
+	}
+
+	/* ... be empty after remove()'ing all items */
+	QDF_BUG(qdf_ptr_rhash_empty(ht));
+
+	/* ... shrink back to its minimum size, once replaced tables are freed */
+	for (i = 0; i < qdf_ptr_rhash_entry_count; i++) {
+		qdf_ptr_rhash_get_stats(ht, &stats);
+		if (stats.buckets == 1 << qdf_ptr_rhash_min_bits)
+			break;
+
+		if (qdf_atomic_read(&ht->retiring))
+			qdf_rcu_barrier();
+		qdf_ptr_rhash_add(ht, &items[0], &items[0], entry);
+		qdf_ptr_rhash_remove(ht, &items[0], item, entry);
+	}
+	QDF_BUG(stats.buckets == 1 << qdf_ptr_rhash_min_bits);
+	QDF_BUG(!stats.entries);
+
+	qdf_ptr_rhash_destroy(ht);
+	qdf_mem_free(items);
+
+	return 0;
+}
+
+struct qdf_ptr_rhash_test_ctx {
+	struct qdf_ptr_rhash *ht;
+	struct qdf_ptr_rhash_test_item fixed[qdf_ptr_rhash_fixed_count];
+	qdf_atomic_t lookups;
+	qdf_atomic_t errors;
+};
+
+static QDF_STATUS qdf_ptr_rhash_test_reader(void *context)
+{
+	struct qdf_ptr_rhash_test_ctx *ctx = context;
+	struct qdf_ptr_rhash_test_item *item;
+	int i;
+
+	while (!qdf_thread_should_stop()) {
+		qdf_rcu_read_lock();
+		for (i = 0; i < qdf_ptr_rhash_fixed_count; i++) {
+			item = qdf_ptr_rhash_get(ctx->ht, &ctx->fixed[i],
+						 item, entry);
+			if (!item || item->id != i)
+				qdf_atomic_inc(&ctx->errors);
+		}
+		qdf_rcu_read_unlock();
+		qdf_atomic_inc(&ctx->lookups);
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
+static uint32_t qdf_ptr_rhash_test_concurrent(void)
+{
+	qdf_thread_t *readers[qdf_ptr_rhash_reader_count];
+	struct qdf_ptr_rhash_test_ctx *ctx;
+	struct qdf_ptr_rhash_test_item *items;
+	struct qdf_ptr_rhash_test_item *item;
+	int round;
+	int i;
+
+	ctx = qdf_mem_malloc(sizeof(*ctx));
+	QDF_BUG(ctx);
+	if (!ctx)
+		return 1;
+
+	items = qdf_mem_malloc(sizeof(*items) * qdf_ptr_rhash_entry_count);
+	ctx->ht = qdf_ptr_rhash_create(qdf_ptr_rhash_min_bits,
+				       qdf_ptr_rhash_max_bits);
+	QDF_BUG(items && ctx->ht);
+	if (!items || !ctx->ht)
+		goto free;
+
+	for (i = 0; i < qdf_ptr_rhash_fixed_count; i++) {
+		ctx->fixed[i].id = i;
+		qdf_ptr_rhash_add(ctx->ht, &ctx->fixed[i], &ctx->fixed[i],
+				  entry);
+	}
+
+	for (i = 0; i < qdf_ptr_rhash_reader_count; i++) {
+		readers[i] = qdf_thread_run(qdf_ptr_rhash_test_reader, ctx);
+		QDF_BUG(readers[i]);
+	}
+
+	/* lookups never miss items present all along, while the table
+	 * grows and shrinks under them
+	 */
+	for (round = 0; round < qdf_ptr_rhash_rounds; round++) {
+		for (i = 0; i < qdf_ptr_rhash_entry_count; i++)
+			qdf_ptr_rhash_add(ctx->ht, &items[i], &items[i],
+					  entry);
+		for (i = 0; i < qdf_ptr_rhash_entry_count; i++)
+			QDF_BUG(qdf_ptr_rhash_remove(ctx->ht, &items[i],
+						     item, entry));
+
+		/* removed items can only be added again after a grace
+		 * period
+		 */
+		qdf_synchronize_rcu();
+	}
+
+	for (i = 0; i < qdf_ptr_rhash_reader_count; i++) {
+		if (readers[i])
+			qdf_thread_join(readers[i]);
+	}
+
+	QDF_BUG(!qdf_atomic_read(&ctx->errors));
+
+	for (i = 0; i < qdf_ptr_rhash_fixed_count; i++)
+		qdf_ptr_rhash_remove(ctx->ht, &ctx->fixed[i], item, entry);
+
+free:
+	if (ctx->ht)
+		qdf_ptr_rhash_destroy(ctx->ht);
+	if (items)
+		qdf_mem_free(items);
+	qdf_mem_free(ctx);
+
+	return 0;
+}
+
 uint32_t qdf_ptr_hash_unit_test(void)
 {
 	uint32_t errors = 0;
@@ -190,6 +427,9 @@ uint32_t qdf_ptr_hash_unit_test(void)
 	errors += qdf_ptr_hash_test_add_remove();
 	errors += qdf_ptr_hash_test_for_each();
 	errors += qdf_ptr_hash_test_create_destroy();
+	errors += qdf_ptr_hash_test_stats();
+	errors += qdf_ptr_rhash_test_resize();
+	errors += qdf_ptr_rhash_test_concurrent();
 
 	return errors;
 }
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all
+ * copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ * TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ * PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <queue.h>
+#include "qdf_atomic.h"
+#include "qdf_lock.h"
+#include "qdf_mem.h"
+#include "qdf_rcu.h"
+#include "qdf_rcu_test.h"
+#include "qdf_threads.h"
+#include "qdf_time.h"
+#include "qdf_trace.h"
+
+#define qdf_rcu_test_reader_count 2
+#define qdf_rcu_test_bin_count 4
+#define qdf_rcu_test_key_count 16
+#define qdf_rcu_test_iterations 2000
+#define qdf_rcu_test_live 0x4c495645
+#define qdf_rcu_test_dead 0x44454144
+
+struct qdf_rcu_test_hash;
+
+/*
+ * Hash element modelled after a DP peer: the table holds one reference,
+ * lookups take their own, and the last reference hands the element to
+ * qdf_call_rcu().
+ */
+struct qdf_rcu_test_item {
+	TAILQ_ENTRY(qdf_rcu_test_item) hash_list_elem;
+	uint32_t key;
+	uint32_t magic;
+	qdf_atomic_t ref_cnt;
+	qdf_rcu_head_t rcu;
+	struct qdf_rcu_test_hash *hash;
+	struct qdf_rcu_test_item *quarantine_next;
+};
+
+/*
+ * Reclaimed items are poisoned and parked on the quarantine list instead
+ * of being freed, so a reader that reaches one after its grace period
+ * reads the poison rather than freed memory.
+ */
+struct qdf_rcu_test_hash {
+	TAILQ_HEAD(, qdf_rcu_test_item) bins[qdf_rcu_test_bin_count];
+	qdf_spinlock_t lock;
+	qdf_spinlock_t quarantine_lock;
+	struct qdf_rcu_test_item *quarantine;
+	qdf_atomic_t allocated;
+	qdf_atomic_t reclaimed;
+	qdf_atomic_t lookups;
+	qdf_atomic_t errors;
+};
+
+static void qdf_rcu_test_reclaim(qdf_rcu_head_t *head)
+{
+	struct qdf_rcu_test_item *item =
+		qdf_container_of(head, struct qdf_rcu_test_item, rcu);
+	struct qdf_rcu_test_hash *hash = item->hash;
+
+	item->magic = qdf_rcu_test_dead;
+
+	qdf_spin_lock_bh(&hash->quarantine_lock);
+	item->quarantine_next = hash->quarantine;
+	hash->quarantine = item;
+	qdf_spin_unlock_bh(&hash->quarantine_lock);
+
+	qdf_atomic_inc(&hash->reclaimed);
+}
+
+static void qdf_rcu_test_unref(struct qdf_rcu_test_item *item)
+{
+	if (qdf_atomic_dec_and_test(&item->ref_cnt))
+		qdf_call_rcu(&item->rcu, qdf_rcu_test_reclaim);
+}
+
+static struct qdf_rcu_test_item *
+qdf_rcu_test_item_alloc(struct qdf_rcu_test_hash *hash, uint32_t key)
+{
+	struct qdf_rcu_test_item *item = qdf_mem_malloc(sizeof(*item));
+
+	if (!item)
+		return NULL;
+
+	item->key = key;
+	item->magic = qdf_rcu_test_live;
+	item->hash = hash;
+	/* reference held by the table */
+	qdf_atomic_init(&item->ref_cnt);
+	qdf_atomic_inc(&item->ref_cnt);
+	qdf_atomic_inc(&hash->allocated);
+
+	return item;
+}
+
+/* same steps as dp_peer_find_hash_add() */
+static void qdf_rcu_test_add(struct qdf_rcu_test_hash *hash,
+			     struct qdf_rcu_test_item *item)
+{
+	uint32_t index = item->key % qdf_rcu_test_bin_count;
+
+	qdf_spin_lock_bh(&hash->lock);
+	qdf_tailq_insert_tail_rcu(&hash->bins[index], item, hash_list_elem);
+	qdf_spin_unlock_bh(&hash->lock);
+}
+
+/* same steps as dp_peer_find_hash_remove(), for the oldest copy of @key */
+static bool qdf_rcu_test_remove(struct qdf_rcu_test_hash *hash,
+				uint32_t key)
+{
+	uint32_t index = key % qdf_rcu_test_bin_count;
+	struct qdf_rcu_test_item *item;
+
+	qdf_spin_lock_bh(&hash->lock);
+	TAILQ_FOREACH(item, &hash->bins[index], hash_list_elem) {
+		if (item->key == key)
+			break;
+	}
+	if (item) {
+		qdf_tailq_remove_rcu(&hash->bins[index], item, hash_list_elem);
+		qdf_rcu_test_unref(item);
+	}
+	qdf_spin_unlock_bh(&hash->lock);
+
+	return !!item;
+}
+
+/* same steps as dp_peer_find_hash_find() */
+static struct qdf_rcu_test_item *
+qdf_rcu_test_find(struct qdf_rcu_test_hash *hash, uint32_t key)
+{
+	uint32_t index = key % qdf_rcu_test_bin_count;
+	struct qdf_rcu_test_item *item;
+
+	qdf_rcu_read_lock();
+	qdf_tailq_foreach_rcu(item, &hash->bins[index], hash_list_elem) {
+		/*
+		 * Linger on each item so that writers remove and reclaim
+		 * items while readers sit on them.
+		 */
+		qdf_udelay(1);
+
+		/* a reader must never reach an item after its grace period */
+		if (item->magic != qdf_rcu_test_live)
+			qdf_atomic_inc(&hash->errors);
+
+		if (item->key != key)
+			continue;
+
+		/* items whose last reference is gone are skipped */
+		if (!qdf_atomic_inc_not_zero(&item->ref_cnt))
+			continue;
+
+		qdf_rcu_read_unlock();
+		return item;
+	}
+	qdf_rcu_read_unlock();
+
+	return NULL;
+}
+
+static QDF_STATUS qdf_rcu_test_reader(void *context)
+{
+	struct qdf_rcu_test_hash *hash = context;
+	struct qdf_rcu_test_item *item;
+	uint32_t key = 0;
+
+	while (!qdf_thread_should_stop()) {
+		/*
+		 * The writer adds the new copy of a key before it removes the
+		 * old one, so a lookup only misses if a removal cut the walk
+		 * short.
+		 */
+		item = qdf_rcu_test_find(hash, key % qdf_rcu_test_key_count);
+		if (!item) {
+			qdf_atomic_inc(&hash->errors);
+		} else {
+			/* the reference outlives the removal */
+			if (item->magic != qdf_rcu_test_live)
+				qdf_atomic_inc(&hash->errors);
+			qdf_rcu_test_unref(item);
+		}
+
+		qdf_atomic_inc(&hash->lookups);
+		key++;
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
+static uint32_t qdf_rcu_test_stress(void)
+{
+	struct qdf_rcu_test_hash hash;
+	qdf_thread_t *readers[qdf_rcu_test_reader_count];
+	struct qdf_rcu_test_item *item;
+	uint32_t key;
+	int i;
+
+	qdf_mem_zero(&hash, sizeof(hash));
+	for (i = 0; i < qdf_rcu_test_bin_count; i++)
+		TAILQ_INIT(&hash.bins[i]);
+	qdf_spinlock_create(&hash.lock);
+	qdf_spinlock_create(&hash.quarantine_lock);
+
+	for (key = 0; key < qdf_rcu_test_key_count; key++) {
+		item = qdf_rcu_test_item_alloc(&hash, key);
+		QDF_BUG(item);
+		if (!item)
+			goto free_hash;
+		qdf_rcu_test_add(&hash, item);
+	}
+
+	for (i = 0; i < qdf_rcu_test_reader_count; i++) {
+		readers[i] = qdf_thread_run(qdf_rcu_test_reader, &hash);
+		QDF_BUG(readers[i]);
+	}
+
+	/* replace every key over and over while the readers look them up */
+	for (i = 0; i < qdf_rcu_test_iterations; i++) {
+		key = i % qdf_rcu_test_key_count;
+
+		item = qdf_rcu_test_item_alloc(&hash, key);
+		if (!item)
+			continue;
+
+		qdf_rcu_test_add(&hash, item);
+		QDF_BUG(qdf_rcu_test_remove(&hash, key));
+
+		if (!(i % 64))
+			qdf_sleep(1);
+	}
+
+	for (i = 0; i < qdf_rcu_test_reader_count; i++) {
+		if (readers[i])
+			qdf_thread_join(readers[i]);
+	}
+
+	QDF_BUG(qdf_atomic_read(&hash.lookups) > 0);
+	QDF_BUG(!qdf_atomic_read(&hash.errors));
+
+free_hash:
+	for (key = 0; key < qdf_rcu_test_key_count; key++)
+		while (qdf_rcu_test_remove(&hash, key))
+			;
+	qdf_rcu_barrier();
+
+	/* every item was handed to qdf_call_rcu() exactly once */
+	QDF_BUG(qdf_atomic_read(&hash.reclaimed) ==
+		qdf_atomic_read(&hash.allocated));
+
+	while (hash.quarantine) {
+		item = hash.quarantine;
+		hash.quarantine = item->quarantine_next;
+		QDF_BUG(item->magic == qdf_rcu_test_dead);
+		qdf_mem_free(item);
+	}
+	qdf_spinlock_destroy(&hash.quarantine_lock);
+	qdf_spinlock_destroy(&hash.lock);
+
+	return 0;
+}
+
+uint32_t qdf_rcu_unit_test(void)
+{
+	uint32_t errors = 0;
+
+	errors += qdf_rcu_test_stress();
+
+	return errors;
+}
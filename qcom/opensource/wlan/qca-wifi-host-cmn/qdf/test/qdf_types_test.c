@@ -135,7 +135,7 @@ __ut_int64(const char *str, QDF_STATUS exp_status, int64_t exp_value)
 
 	if (value != exp_value) {
 		qdf_nofl_alert("FAIL: qdf_int64_parse(\"%s\") -> %lld; expected %lld",
-			       str, value, exp_value);
+			       str, (long long)value, (long long)exp_value);
 		return 1;
 	}
 
@@ -372,7 +372,8 @@ __ut_uint64(const char *str, QDF_STATUS exp_status, uint64_t exp_value)
 
 	if (value != exp_value) {
 		qdf_nofl_alert("FAIL: qdf_uint64_parse(\"%s\") -> %llu; expected %llu",
-			       str, value, exp_value);
+			       str, (unsigned long long)value,
+			       (unsigned long long)exp_value);
 		return 1;
 	}
 
@@ -23,6 +23,7 @@
 #include <qdf_timer.h>
 #include <scheduler_api.h>
 #include <qdf_list.h>
+#include <qdf_atomic.h>
 
 #ifndef SCHEDULER_CORE_MAX_MESSAGES
 #define SCHEDULER_CORE_MAX_MESSAGES 4000
@@ -31,6 +32,10 @@
 #define WLAN_SCHED_REDUCTION_LIMIT 32
 #endif
 #define SCHEDULER_NUMBER_OF_MSG_QUEUE 6
+/* messages drained from a queue before higher priority queues are checked */
+#ifndef SCHEDULER_MSG_BATCH
+#define SCHEDULER_MSG_BATCH 8
+#endif
 #define SCHEDULER_WRAPPER_MAX_FAIL_COUNT (SCHEDULER_CORE_MAX_MESSAGES * 3)
 #define SCHEDULER_WATCHDOG_TIMEOUT (10 * 1000) /* 10s */
 
@@ -67,13 +72,21 @@
 
 /**
  * struct scheduler_mq_type -  scheduler message queue
- * @mq_lock: message queue lock
- * @mq_list: message queue list
+ * @mq_front: messages put in the front of the queue, newest first
+ * @mq_back: messages put in the back of the queue, newest first
+ * @mq_pending: messages the scheduler thread took from @mq_back, oldest
+ *	first; only accessed by the scheduler thread
+ * @mq_depth: number of messages in the queue
  * @qid: queue id
+ *
+ * Messages are posted from any context without a lock, and only the
+ * scheduler thread, or the flush once it stopped, takes them out.
  */
 struct scheduler_mq_type {
-	qdf_spinlock_t mq_lock;
-	qdf_list_t mq_list;
+	qdf_llist_head_t mq_front;
+	qdf_llist_head_t mq_back;
+	qdf_llist_node_t *mq_pending;
+	qdf_atomic_t mq_depth;
 	QDF_MODULE_ID qid;
 };
 
@@ -108,6 +121,9 @@ struct scheduler_mq_ctx {
  * @timeout: timeout value for scheduler watchdog timer
  * @watchdog_timer: timer for triggering a scheduler watchdog bite
  * @watchdog_callback: the callback of the current msg being processed
+ * @watchdog_start: ticks when the processing of the current msg started
+ * @watchdog_running: a msg is being processed
+ * @watchdog_armed: @watchdog_timer is pending
  */
 struct scheduler_ctx {
 	struct scheduler_mq_ctx queue_ctx;
@@ -126,6 +142,9 @@ struct scheduler_ctx {
 	uint32_t timeout;
 	qdf_timer_t watchdog_timer;
 	void *watchdog_callback;
+	qdf_time_t watchdog_start;
+	qdf_atomic_t watchdog_running;
+	qdf_atomic_t watchdog_armed;
 };
 
 /**
@@ -210,9 +229,12 @@ void scheduler_mq_put_front(struct scheduler_mq_type *msg_q,
  * scheduler_mq_get() - to get message from message queue
  * @msg_q: Pointer to the message queue
  *
- * This function is used to get message from given message queue
+ * This function is used to get message from given message queue. Messages
+ * put in the front come first, the most recent one first, then the ones
+ * put in the back in order. It must only be called by the scheduler
+ * thread, or once the thread stopped.
  *
- *  Return: none
+ *  Return: the message, NULL if the queue is empty
  */
 struct scheduler_msg *scheduler_mq_get(struct scheduler_mq_type *msg_q);
 
@@ -75,6 +75,29 @@ static inline void scheduler_watchdog_notify(struct scheduler_ctx *sched)
 static void scheduler_watchdog_timeout(void *arg)
 {
 	struct scheduler_ctx *sched = arg;
+	uint32_t elapsed_ms;
+
+	if (!qdf_atomic_read(&sched->watchdog_running)) {
+		qdf_atomic_set(&sched->watchdog_armed, 0);
+		/* pairs with the barrier in scheduler_watchdog_start() */
+		qdf_mb();
+		if (qdf_atomic_read(&sched->watchdog_running) &&
+		    !qdf_atomic_cmpxchg(&sched->watchdog_armed, 0, 1))
+			qdf_timer_mod(&sched->watchdog_timer, sched->timeout);
+		return;
+	}
+
+	qdf_rmb();
+	elapsed_ms = qdf_system_ticks_to_msecs(qdf_system_ticks() -
+					       sched->watchdog_start);
+	if (elapsed_ms < sched->timeout) {
+		/* a later msg is running, check it when it is due */
+		qdf_timer_mod(&sched->watchdog_timer,
+			      sched->timeout - elapsed_ms);
+		return;
+	}
+
+	qdf_atomic_set(&sched->watchdog_armed, 0);
 
 	if (qdf_is_recovering()) {
 		sched_debug("Recovery is in progress ignore timeout");
@@ -177,6 +200,8 @@ QDF_STATUS scheduler_init(void)
 	qdf_init_waitqueue_head(&sched_ctx->sch_wait_queue);
 	sched_ctx->sch_event_flag = 0;
 	sched_ctx->timeout = SCHEDULER_WATCHDOG_TIMEOUT;
+	qdf_atomic_init(&sched_ctx->watchdog_running);
+	qdf_atomic_init(&sched_ctx->watchdog_armed);
 	qdf_timer_init(NULL,
 		       &sched_ctx->watchdog_timer,
 		       &scheduler_watchdog_timeout,
@@ -764,7 +789,7 @@ QDF_STATUS scheduler_get_queue_size(QDF_MODULE_ID qid, uint32_t *size)
 
 	target_mq = &(sched_ctx->queue_ctx.sch_msg_q[qidx]);
 
-	*size = qdf_list_size(&target_mq->mq_list);
+	*size = qdf_atomic_read(&target_mq->mq_depth);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -38,6 +38,16 @@ DEFINE_QDF_FLEX_MEM_POOL(sched_pool, sizeof(struct scheduler_msg),
 			       "--------------------------------------" \
 			       "--------------------------------------"
 
+/*
+ * Queue latency histogram buckets, each 10 times wider than the previous
+ * one: <10us, <100us, <1ms, <10ms, <100ms, <1s, 1s+
+ */
+#define SCHED_LATENCY_BUCKETS 7
+#define SCHED_LATENCY_BUCKET0_US 10
+
+#define SCHEDULER_LATENCY_HEADER "|Queue|<10us  |<100us |<1ms   |<10ms  "\
+				 "|<100ms |<1s    |1s+    |"
+
 /**
  * struct sched_history_item - metrics for a scheduler message
  * @callback: the message's execution callback
@@ -62,16 +72,35 @@ struct sched_history_item {
 
 static struct sched_history_item sched_history[WLAN_SCHED_HISTORY_SIZE];
 static uint32_t sched_history_index;
+static uint32_t
+sched_latency_hist[SCHEDULER_NUMBER_OF_MSG_QUEUE][SCHED_LATENCY_BUCKETS];
+static QDF_MODULE_ID sched_latency_qid[SCHEDULER_NUMBER_OF_MSG_QUEUE];
 
 static void sched_history_queue(struct scheduler_mq_type *queue,
 				struct scheduler_msg *msg)
 {
 	msg->queue_id = queue->qid;
-	msg->queue_depth = qdf_list_size(&queue->mq_list);
+	msg->queue_depth = qdf_atomic_read(&queue->mq_depth);
 	msg->queued_at_us = qdf_get_log_timestamp_usecs();
 }
 
-static void sched_history_start(struct scheduler_msg *msg)
+static void sched_latency_hist_update(uint8_t qidx, QDF_MODULE_ID qid,
+				      uint32_t queue_duration_us)
+{
+	uint32_t limit = SCHED_LATENCY_BUCKET0_US;
+	int bucket = 0;
+
+	while (bucket < SCHED_LATENCY_BUCKETS - 1 &&
+	       queue_duration_us >= limit) {
+		limit *= 10;
+		bucket++;
+	}
+
+	sched_latency_qid[qidx] = qid;
+	sched_latency_hist[qidx][bucket]++;
+}
+
+static void sched_history_start(uint8_t qidx, struct scheduler_msg *msg)
 {
 	uint64_t started_at_us = qdf_get_log_timestamp_usecs();
 	struct sched_history_item hist = {
@@ -84,6 +113,7 @@ static void sched_history_start(struct scheduler_msg *msg)
 	};
 
 	sched_history[sched_history_index] = hist;
+	sched_latency_hist_update(qidx, msg->queue_id, hist.queue_duration_us);
 }
 
 static void sched_history_stop(void)
@@ -135,12 +165,31 @@ void sched_history_print(void)
 	sched_nofl_fatal(SCHEDULER_HISTORY_LINE);
 
 	qdf_mem_free(history);
+
+	sched_nofl_fatal(SCHEDULER_LATENCY_HEADER);
+	for (idx = 0; idx < SCHEDULER_NUMBER_OF_MSG_QUEUE; idx++) {
+		uint32_t *hist = sched_latency_hist[idx];
+		uint32_t samples = 0;
+		int bucket;
+
+		for (bucket = 0; bucket < SCHED_LATENCY_BUCKETS; bucket++)
+			samples += hist[bucket];
+
+		if (!samples)
+			continue;
+
+		sched_nofl_fatal("|%5d|%7u|%7u|%7u|%7u|%7u|%7u|%7u|",
+				 sched_latency_qid[idx], hist[0], hist[1],
+				 hist[2], hist[3], hist[4], hist[5], hist[6]);
+	}
+	sched_nofl_fatal(SCHEDULER_HISTORY_LINE);
 }
 #else /* WLAN_SCHED_HISTORY_SIZE */
 
 static inline void sched_history_queue(struct scheduler_mq_type *queue,
 				       struct scheduler_msg *msg) { }
-static inline void sched_history_start(struct scheduler_msg *msg) { }
+static inline void sched_history_start(uint8_t qidx,
+				       struct scheduler_msg *msg) { }
 static inline void sched_history_stop(void) { }
 void sched_history_print(void) { }
 
@@ -173,8 +222,10 @@ static QDF_STATUS scheduler_mq_init(struct scheduler_mq_type *msg_q)
 {
 	sched_enter();
 
-	qdf_spinlock_create(&msg_q->mq_lock);
-	qdf_list_create(&msg_q->mq_list, SCHEDULER_CORE_MAX_MESSAGES);
+	qdf_init_llist_head(&msg_q->mq_front);
+	qdf_init_llist_head(&msg_q->mq_back);
+	msg_q->mq_pending = NULL;
+	qdf_atomic_init(&msg_q->mq_depth);
 
 	sched_exit();
 
@@ -185,8 +236,9 @@ static void scheduler_mq_deinit(struct scheduler_mq_type *msg_q)
 {
 	sched_enter();
 
-	qdf_list_destroy(&msg_q->mq_list);
-	qdf_spinlock_destroy(&msg_q->mq_lock);
+	if (qdf_atomic_read(&msg_q->mq_depth))
+		sched_err("Qid[%d] destroyed with %d messages", msg_q->qid,
+			  qdf_atomic_read(&msg_q->mq_depth));
 
 	sched_exit();
 }
@@ -251,32 +303,38 @@ static QDF_STATUS scheduler_all_queues_deinit(struct scheduler_ctx *sched_ctx)
 void scheduler_mq_put(struct scheduler_mq_type *msg_q,
 		      struct scheduler_msg *msg)
 {
-	qdf_spin_lock_irqsave(&msg_q->mq_lock);
 	sched_history_queue(msg_q, msg);
-	qdf_list_insert_back(&msg_q->mq_list, &msg->node);
-	qdf_spin_unlock_irqrestore(&msg_q->mq_lock);
+	qdf_atomic_inc(&msg_q->mq_depth);
+	qdf_llist_add(&msg->node, &msg_q->mq_back);
 }
 
 void scheduler_mq_put_front(struct scheduler_mq_type *msg_q,
 			    struct scheduler_msg *msg)
 {
-	qdf_spin_lock_irqsave(&msg_q->mq_lock);
 	sched_history_queue(msg_q, msg);
-	qdf_list_insert_front(&msg_q->mq_list, &msg->node);
-	qdf_spin_unlock_irqrestore(&msg_q->mq_lock);
+	qdf_atomic_inc(&msg_q->mq_depth);
+	qdf_llist_add(&msg->node, &msg_q->mq_front);
 }
 
 struct scheduler_msg *scheduler_mq_get(struct scheduler_mq_type *msg_q)
 {
-	QDF_STATUS status;
-	qdf_list_node_t *node;
+	qdf_llist_node_t *node;
+
+	node = qdf_llist_del_first(&msg_q->mq_front);
+	if (!node) {
+		/* take all the messages put in the back at once */
+		if (!msg_q->mq_pending)
+			msg_q->mq_pending = qdf_llist_reverse_order(
+					qdf_llist_del_all(&msg_q->mq_back));
 
-	qdf_spin_lock_irqsave(&msg_q->mq_lock);
-	status = qdf_list_remove_front(&msg_q->mq_list, &node);
-	qdf_spin_unlock_irqrestore(&msg_q->mq_lock);
+		node = msg_q->mq_pending;
+		if (!node)
+			return NULL;
 
-	if (QDF_IS_STATUS_ERROR(status))
-		return NULL;
+		msg_q->mq_pending = qdf_llist_next(node);
+	}
+
+	qdf_atomic_dec(&msg_q->mq_depth);
 
 	return qdf_container_of(node, struct scheduler_msg, node);
 }
@@ -348,12 +406,99 @@ void scheduler_core_msg_free(struct scheduler_msg *msg)
 	qdf_atomic_dec(&__sched_queue_depth);
 }
 
+/**
+ * scheduler_watchdog_start() - start watching the processing of a message
+ * @sch_ctx: scheduler context
+ *
+ * Rather than being started and stopped around every message, the watchdog
+ * timer is only armed if it is not pending already, and on expiry checks
+ * how long the current message has been running, see
+ * scheduler_watchdog_timeout().
+ *
+ * Return: none
+ */
+static void scheduler_watchdog_start(struct scheduler_ctx *sch_ctx)
+{
+	sch_ctx->watchdog_start = qdf_system_ticks();
+	/* the start time must be visible before the running flag */
+	qdf_wmb();
+	qdf_atomic_set(&sch_ctx->watchdog_running, 1);
+	/* pairs with the barrier in scheduler_watchdog_timeout() */
+	qdf_mb();
+
+	if (!qdf_atomic_read(&sch_ctx->watchdog_armed) &&
+	    !qdf_atomic_cmpxchg(&sch_ctx->watchdog_armed, 0, 1))
+		qdf_timer_mod(&sch_ctx->watchdog_timer, sch_ctx->timeout);
+}
+
+/**
+ * scheduler_watchdog_stop() - stop watching the processing of a message
+ * @sch_ctx: scheduler context
+ *
+ * Return: none
+ */
+static inline void scheduler_watchdog_stop(struct scheduler_ctx *sch_ctx)
+{
+	qdf_atomic_set(&sch_ctx->watchdog_running, 0);
+}
+
+/**
+ * scheduler_thread_process_batch() - process a batch of messages of a queue
+ * @sch_ctx: scheduler context
+ * @qidx: index of the queue
+ *
+ * Up to SCHEDULER_MSG_BATCH messages are processed back to back, so a busy
+ * queue is drained without going back to the higher priority queues after
+ * every message. The batch ends early once the queue is empty or the
+ * thread is asked to shut down.
+ *
+ * Return: number of messages taken from the queue
+ */
+static uint32_t scheduler_thread_process_batch(struct scheduler_ctx *sch_ctx,
+					       int qidx)
+{
+	struct scheduler_mq_type *msg_q = &sch_ctx->queue_ctx.sch_msg_q[qidx];
+	scheduler_msg_process_fn_t process_fn =
+			sch_ctx->queue_ctx.scheduler_msg_process_fn[qidx];
+	struct scheduler_msg *msg;
+	QDF_STATUS status;
+	uint32_t count;
+
+	for (count = 0; count < SCHEDULER_MSG_BATCH; count++) {
+		if (count && qdf_atomic_test_bit(MC_SHUTDOWN_EVENT_MASK,
+						 &sch_ctx->sch_event_flag))
+			break;
+
+		msg = scheduler_mq_get(msg_q);
+		if (!msg)
+			break;
+
+		if (!process_fn)
+			continue;
+
+		sch_ctx->watchdog_msg_type = msg->type;
+		sch_ctx->watchdog_callback = msg->callback;
+
+		sched_history_start(qidx, msg);
+		scheduler_watchdog_start(sch_ctx);
+		status = process_fn(msg);
+		scheduler_watchdog_stop(sch_ctx);
+		sched_history_stop();
+
+		if (QDF_IS_STATUS_ERROR(status))
+			sched_err("Failed processing Qid[%d] message",
+				  msg_q->qid);
+
+		scheduler_core_msg_free(msg);
+	}
+
+	return count;
+}
+
 static void scheduler_thread_process_queues(struct scheduler_ctx *sch_ctx,
 					    bool *shutdown)
 {
 	int i;
-	QDF_STATUS status;
-	struct scheduler_msg *msg;
 
 	if (!sch_ctx) {
 		QDF_DEBUG_PANIC("sch_ctx is null");
@@ -380,32 +525,12 @@ static void scheduler_thread_process_queues(struct scheduler_ctx *sch_ctx,
 			break;
 		}
 
-		msg = scheduler_mq_get(&sch_ctx->queue_ctx.sch_msg_q[i]);
-		if (!msg) {
+		if (!scheduler_thread_process_batch(sch_ctx, i)) {
 			/* check next queue */
 			i++;
 			continue;
 		}
 
-		if (sch_ctx->queue_ctx.scheduler_msg_process_fn[i]) {
-			sch_ctx->watchdog_msg_type = msg->type;
-			sch_ctx->watchdog_callback = msg->callback;
-
-			sched_history_start(msg);
-			qdf_timer_start(&sch_ctx->watchdog_timer,
-					sch_ctx->timeout);
-			status = sch_ctx->queue_ctx.
-					scheduler_msg_process_fn[i](msg);
-			qdf_timer_stop(&sch_ctx->watchdog_timer);
-			sched_history_stop();
-
-			if (QDF_IS_STATUS_ERROR(status))
-				sched_err("Failed processing Qid[%d] message",
-					  sch_ctx->queue_ctx.sch_msg_q[i].qid);
-
-			scheduler_core_msg_free(msg);
-		}
-
 		/* start again with highest priority queue at index 0 */
 		i = 0;
 	}
@@ -25,6 +25,10 @@
 #define _I_WBUFF_H
 
 #include <qdf_nbuf.h>
+#include <qdf_atomic.h>
+#include <qdf_debugfs.h>
+#include <qdf_periodic_work.h>
+#include <qdf_util.h>
 
 /* Number of modules supported by wbuff */
 #define WBUFF_MAX_MODULES 4
@@ -51,6 +55,18 @@
 /* Allocation of size 2048 bytes */
 #define WBUFF_POOL_3_MAX 32
 
+/* Number of per-CPU caches of a module, CPUs beyond share them */
+#define WBUFF_MAX_CPUS 8
+
+/* Max buffers of a pool held by one per-CPU cache */
+#define WBUFF_PCPU_CACHE_SIZE 8
+
+/* Buffers moved at once between a per-CPU cache and its pool */
+#define WBUFF_PCPU_BATCH 4
+
+/* Interval at which the pools and caches are checked for idle buffers */
+#define WBUFF_RESIZE_INTERVAL_MS 1000
+
 #define WBUFF_MSLOT_SHIFT 4
 #define WBUFF_MSLOT_BITMASK 0xF0
 
@@ -71,6 +87,49 @@ struct wbuff_handle {
 	uint8_t id;
 };
 
+/**
+ * struct wbuff_pool - buffers of one pool slot of a module
+ * @head: free buffers not held by a per-CPU cache
+ * @free: number of buffers in @head
+ * @total: number of buffers owned by the pool, free, cached or in use
+ * @min: number of buffers requested at registration, the pool never
+ * shrinks below it
+ * @low_mark: lowest @free seen in the current resize interval
+ * @misses: gets not served by the per-CPU cache
+ * @fallbacks: gets which found the pool exhausted, the caller falls back to
+ * its own allocation
+ * @grows: buffers added to the pool on demand
+ * @shrinks: idle buffers released from the pool
+ */
+struct wbuff_pool {
+	qdf_nbuf_t head;
+	uint16_t free;
+	uint16_t total;
+	uint16_t min;
+	uint16_t low_mark;
+	uint32_t misses;
+	uint32_t fallbacks;
+	uint32_t grows;
+	uint32_t shrinks;
+};
+
+/**
+ * struct wbuff_pcpu_cache - per-CPU cache of buffers of a module
+ * @lock: lock for the cache, only contended when buffers are stolen
+ * @buf: cached buffers, per pool slot
+ * @count: number of buffers in @buf, per pool slot
+ * @active: pool slot had a get or put on this CPU in the current resize
+ * interval
+ * @hits: gets served by the cache, per pool slot
+ */
+struct wbuff_pcpu_cache {
+	qdf_spinlock_t lock;
+	qdf_nbuf_t buf[WBUFF_MAX_POOLS][WBUFF_PCPU_CACHE_SIZE];
+	uint8_t count[WBUFF_MAX_POOLS];
+	bool active[WBUFF_MAX_POOLS];
+	uint32_t hits[WBUFF_MAX_POOLS];
+};
+
 /**
  * struct wbuff_module - allocation holder for wbuff registered module
  * @registered: To identify whether module is registered
@@ -80,24 +139,33 @@ struct wbuff_handle {
  * @handle: wbuff handle for the registered module
  * @reserve: nbuf headroom to start with
  * @align: alignment for the nbuf
- * @pool[]: pools for all available buffers for the module
+ * @pool: pools for all available buffers for the module
+ * @cache: per-CPU caches in front of @pool
+ *
+ * Lock order is @cache lock, then @lock.
  */
 struct wbuff_module {
 	bool registered;
-	uint16_t pending_returns;
+	qdf_atomic_t pending_returns;
 	qdf_spinlock_t lock;
 	struct wbuff_handle handle;
 	int reserve;
 	int align;
-	qdf_nbuf_t pool[WBUFF_MAX_POOLS];
+	struct wbuff_pool pool[WBUFF_MAX_POOLS];
+	struct wbuff_pcpu_cache cache[WBUFF_MAX_CPUS];
 };
 
 /**
  * struct wbuff_holder - allocation holder for wbuff
  * @initialized: to identified whether module is initialized
+ * @mod: registered modules
+ * @dentry: debugfs directory
+ * @resize_work: periodic release of idle buffers of all modules
  */
 struct wbuff_holder {
 	bool initialized;
 	struct wbuff_module mod[WBUFF_MAX_MODULES];
+	qdf_dentry_t dentry;
+	struct qdf_periodic_work resize_work;
 };
 #endif /* _WBUFF_H */
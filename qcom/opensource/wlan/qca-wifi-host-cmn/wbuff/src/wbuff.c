@@ -170,24 +170,406 @@ static bool wbuff_is_valid_handle(struct wbuff_handle *handle)
 	return false;
 }
 
+/**
+ * wbuff_get_cache() - get the per-CPU cache of a module for this CPU
+ * @mod: module
+ *
+ * Return: per-CPU cache
+ */
+static inline struct wbuff_pcpu_cache *
+wbuff_get_cache(struct wbuff_module *mod)
+{
+	return &mod->cache[qdf_get_cpu() % WBUFF_MAX_CPUS];
+}
+
+/**
+ * wbuff_pool_pop() - take a free buffer from a pool
+ * @pool: pool, module lock held
+ *
+ * Return: buffer, NULL if the pool is empty
+ */
+static qdf_nbuf_t wbuff_pool_pop(struct wbuff_pool *pool)
+{
+	qdf_nbuf_t buf = pool->head;
+
+	if (!buf)
+		return NULL;
+
+	pool->head = qdf_nbuf_next(buf);
+	pool->free--;
+	if (pool->free < pool->low_mark)
+		pool->low_mark = pool->free;
+
+	return buf;
+}
+
+/**
+ * wbuff_pool_push() - give a free buffer back to a pool
+ * @pool: pool, module lock held
+ * @buf: buffer
+ *
+ * Return: none
+ */
+static void wbuff_pool_push(struct wbuff_pool *pool, qdf_nbuf_t buf)
+{
+	qdf_nbuf_set_next(buf, pool->head);
+	pool->head = buf;
+	pool->free++;
+}
+
+/**
+ * wbuff_pool_resize() - release the idle buffers of the pools of a module
+ * @mod: module, module lock held
+ *
+ * Buffers which stayed free in a pool for a whole resize interval are not
+ * needed by the current load, so half of them are released, never going
+ * below the size requested at registration. Pools which run dry grow back
+ * on demand, see wbuff_pool_grow().
+ *
+ * Return: none
+ */
+static void wbuff_pool_resize(struct wbuff_module *mod)
+{
+	struct wbuff_pool *pool;
+	uint16_t excess;
+	uint8_t pslot;
+
+	for (pslot = 0; pslot < WBUFF_MAX_POOLS; pslot++) {
+		pool = &mod->pool[pslot];
+		excess = 0;
+		if (pool->total > pool->min)
+			excess = qdf_min(pool->low_mark / 2,
+					 pool->total - pool->min);
+
+		for (; excess; excess--) {
+			qdf_nbuf_free(wbuff_pool_pop(pool));
+			pool->total--;
+			pool->shrinks++;
+		}
+
+		pool->low_mark = pool->free;
+	}
+}
+
+/**
+ * wbuff_pool_grow() - allocate a new buffer for an exhausted pool
+ * @mod: module
+ * @mslot: module slot
+ * @pslot: pool slot
+ *
+ * The buffer is owned by the pool from then on and comes back to it when
+ * freed, up to wbuff_alloc_max buffers per pool.
+ *
+ * Return: buffer, NULL if the pool is at its max size or allocation failed
+ */
+static qdf_nbuf_t wbuff_pool_grow(struct wbuff_module *mod, uint8_t mslot,
+				  uint8_t pslot)
+{
+	struct wbuff_pool *pool = &mod->pool[pslot];
+	qdf_nbuf_t buf;
+	bool grow;
+
+	qdf_spin_lock_bh(&mod->lock);
+	grow = pool->total < wbuff_alloc_max[pslot];
+	if (grow)
+		pool->total++;
+	else
+		pool->fallbacks++;
+	qdf_spin_unlock_bh(&mod->lock);
+
+	if (!grow)
+		return NULL;
+
+	buf = wbuff_prepare_nbuf(mslot, pslot,
+				 wbuff_get_len_from_pool_slot(pslot),
+				 mod->reserve, mod->align);
+
+	qdf_spin_lock_bh(&mod->lock);
+	if (buf) {
+		pool->grows++;
+	} else {
+		pool->total--;
+		pool->fallbacks++;
+	}
+	qdf_spin_unlock_bh(&mod->lock);
+
+	return buf;
+}
+
+/**
+ * wbuff_cache_refill() - get a buffer from the pool on a per-CPU cache miss
+ * @mod: module
+ * @cache: empty per-CPU cache of the caller, locked
+ * @pslot: pool slot
+ *
+ * Along with the buffer returned, up to WBUFF_PCPU_BATCH - 1 more are moved
+ * to @cache so that the next gets on this CPU do not take the module lock.
+ *
+ * Return: buffer, NULL if the pool is empty
+ */
+static qdf_nbuf_t wbuff_cache_refill(struct wbuff_module *mod,
+				     struct wbuff_pcpu_cache *cache,
+				     uint8_t pslot)
+{
+	struct wbuff_pool *pool = &mod->pool[pslot];
+	qdf_nbuf_t buf;
+	int i;
+
+	qdf_spin_lock_bh(&mod->lock);
+	pool->misses++;
+	buf = wbuff_pool_pop(pool);
+	for (i = 1; buf && pool->head && i < WBUFF_PCPU_BATCH; i++)
+		cache->buf[pslot][cache->count[pslot]++] =
+						wbuff_pool_pop(pool);
+	qdf_spin_unlock_bh(&mod->lock);
+
+	return buf;
+}
+
+/**
+ * wbuff_cache_flush() - move buffers from a full per-CPU cache to the pool
+ * @mod: module
+ * @cache: full per-CPU cache of the caller, locked
+ * @pslot: pool slot
+ *
+ * Return: none
+ */
+static void wbuff_cache_flush(struct wbuff_module *mod,
+			      struct wbuff_pcpu_cache *cache, uint8_t pslot)
+{
+	struct wbuff_pool *pool = &mod->pool[pslot];
+	int i;
+
+	qdf_spin_lock_bh(&mod->lock);
+	for (i = 0; i < WBUFF_PCPU_BATCH; i++)
+		wbuff_pool_push(pool, cache->buf[pslot][--cache->count[pslot]]);
+	qdf_spin_unlock_bh(&mod->lock);
+}
+
+/**
+ * wbuff_cache_steal() - take a buffer from the per-CPU cache of another CPU
+ * @mod: module
+ * @own: per-CPU cache of the caller, not locked
+ * @pslot: pool slot
+ *
+ * Used when the pool is empty, so that buffers sitting in the caches of
+ * other CPUs are not stranded there.
+ *
+ * Return: buffer, NULL if all the caches are empty
+ */
+static qdf_nbuf_t wbuff_cache_steal(struct wbuff_module *mod,
+				    struct wbuff_pcpu_cache *own,
+				    uint8_t pslot)
+{
+	struct wbuff_pcpu_cache *cache;
+	qdf_nbuf_t buf = NULL;
+	int cpu;
+
+	for (cpu = 0; cpu < WBUFF_MAX_CPUS && !buf; cpu++) {
+		cache = &mod->cache[cpu];
+		if (cache == own)
+			continue;
+
+		qdf_spin_lock_bh(&cache->lock);
+		if (cache->count[pslot])
+			buf = cache->buf[pslot][--cache->count[pslot]];
+		qdf_spin_unlock_bh(&cache->lock);
+	}
+
+	return buf;
+}
+
+/**
+ * wbuff_cache_reclaim() - give the buffers of idle per-CPU caches back
+ * @mod: module
+ *
+ * A cache whose pool slot saw no get or put on its CPU during the resize
+ * interval returns its buffers to the pool. They idled for the whole
+ * interval, so they also count towards the pool's low mark and can be
+ * released by wbuff_pool_resize().
+ *
+ * Return: none
+ */
+static void wbuff_cache_reclaim(struct wbuff_module *mod)
+{
+	struct wbuff_pcpu_cache *cache;
+	struct wbuff_pool *pool;
+	uint8_t pslot;
+	int cpu;
+
+	for (cpu = 0; cpu < WBUFF_MAX_CPUS; cpu++) {
+		cache = &mod->cache[cpu];
+		qdf_spin_lock_bh(&cache->lock);
+		for (pslot = 0; pslot < WBUFF_MAX_POOLS; pslot++) {
+			if (cache->active[pslot] || !cache->count[pslot]) {
+				cache->active[pslot] = false;
+				continue;
+			}
+
+			pool = &mod->pool[pslot];
+			qdf_spin_lock_bh(&mod->lock);
+			while (cache->count[pslot]) {
+				wbuff_pool_push(pool, cache->buf[pslot]
+						[--cache->count[pslot]]);
+				pool->low_mark++;
+			}
+			qdf_spin_unlock_bh(&mod->lock);
+		}
+		qdf_spin_unlock_bh(&cache->lock);
+	}
+}
+
+/**
+ * wbuff_resize_work() - release idle buffers of all registered modules
+ * @context: unused
+ *
+ * Runs every WBUFF_RESIZE_INTERVAL_MS, so pools shrink while the modules
+ * are idle as well.
+ *
+ * Return: none
+ */
+static void wbuff_resize_work(void *context)
+{
+	struct wbuff_module *mod;
+	uint8_t mslot;
+
+	for (mslot = 0; mslot < WBUFF_MAX_MODULES; mslot++) {
+		mod = &wbuff.mod[mslot];
+		if (!mod->registered)
+			continue;
+
+		wbuff_cache_reclaim(mod);
+
+		qdf_spin_lock_bh(&mod->lock);
+		wbuff_pool_resize(mod);
+		qdf_spin_unlock_bh(&mod->lock);
+	}
+}
+
+/**
+ * wbuff_stats_show() - debugfs show of the pool counters of all modules
+ * @file: debugfs file
+ * @arg: unused
+ *
+ * Return: QDF_STATUS_SUCCESS
+ */
+static QDF_STATUS wbuff_stats_show(qdf_debugfs_file_t file, void *arg)
+{
+	struct wbuff_module *mod;
+	struct wbuff_pool pool;
+	uint32_t hits, cached;
+	uint8_t mslot, pslot;
+	int cpu;
+
+	for (mslot = 0; mslot < WBUFF_MAX_MODULES; mslot++) {
+		mod = &wbuff.mod[mslot];
+		if (!mod->registered)
+			continue;
+
+		qdf_debugfs_printf(file, "module %u pending returns %d\n",
+				   mslot,
+				   qdf_atomic_read(&mod->pending_returns));
+		qdf_debugfs_printf(file,
+				   "%4s %5s %5s %5s %5s %5s %6s %10s %10s %10s %8s %8s\n",
+				   "pool", "len", "min", "max", "total",
+				   "free", "cached", "hits", "misses",
+				   "fallbacks", "grows", "shrinks");
+
+		for (pslot = 0; pslot < WBUFF_MAX_POOLS; pslot++) {
+			hits = 0;
+			cached = 0;
+			for (cpu = 0; cpu < WBUFF_MAX_CPUS; cpu++) {
+				hits += mod->cache[cpu].hits[pslot];
+				cached += mod->cache[cpu].count[pslot];
+			}
+
+			qdf_spin_lock_bh(&mod->lock);
+			pool = mod->pool[pslot];
+			qdf_spin_unlock_bh(&mod->lock);
+
+			qdf_debugfs_printf(file,
+					   "%4u %5u %5u %5u %5u %5u %6u %10u %10u %10u %8u %8u\n",
+					   pslot,
+					   wbuff_get_len_from_pool_slot(pslot),
+					   pool.min, wbuff_alloc_max[pslot],
+					   pool.total, pool.free, cached, hits,
+					   pool.misses, pool.fallbacks,
+					   pool.grows, pool.shrinks);
+		}
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
+static struct qdf_debugfs_fops wbuff_stats_fops = {
+	.show = wbuff_stats_show,
+};
+
+/**
+ * wbuff_debugfs_init() - create the wbuff debugfs entries
+ *
+ * Return: none
+ */
+static void wbuff_debugfs_init(void)
+{
+	wbuff.dentry = qdf_debugfs_create_dir("wbuff", NULL);
+	if (!wbuff.dentry)
+		return;
+
+	if (!qdf_debugfs_create_file("stats", QDF_FILE_USR_READ |
+				     QDF_FILE_GRP_READ | QDF_FILE_OTH_READ,
+				     wbuff.dentry, &wbuff_stats_fops)) {
+		qdf_debugfs_remove_dir(wbuff.dentry);
+		wbuff.dentry = NULL;
+	}
+}
+
+/**
+ * wbuff_debugfs_deinit() - remove the wbuff debugfs entries
+ *
+ * Return: none
+ */
+static void wbuff_debugfs_deinit(void)
+{
+	if (!wbuff.dentry)
+		return;
+
+	qdf_debugfs_remove_dir_recursive(wbuff.dentry);
+	wbuff.dentry = NULL;
+}
+
 QDF_STATUS wbuff_module_init(void)
 {
 	struct wbuff_module *mod = NULL;
-	uint8_t mslot = 0, pslot = 0;
+	uint8_t mslot = 0;
+	int cpu;
+
+	QDF_STATUS status;
 
 	if (!qdf_nbuf_is_dev_scratch_supported()) {
 		wbuff.initialized = false;
 		return QDF_STATUS_E_NOSUPPORT;
 	}
 
+	status = qdf_periodic_work_create(&wbuff.resize_work,
+					  wbuff_resize_work, NULL);
+	if (QDF_IS_STATUS_ERROR(status)) {
+		wbuff.initialized = false;
+		return status;
+	}
+
 	for (mslot = 0; mslot < WBUFF_MAX_MODULES; mslot++) {
 		mod = &wbuff.mod[mslot];
 		qdf_spinlock_create(&mod->lock);
-		for (pslot = 0; pslot < WBUFF_MAX_POOLS; pslot++)
-			mod->pool[pslot] = NULL;
+		for (cpu = 0; cpu < WBUFF_MAX_CPUS; cpu++)
+			qdf_spinlock_create(&mod->cache[cpu].lock);
+		qdf_mem_zero(mod->pool, sizeof(mod->pool));
+		qdf_atomic_init(&mod->pending_returns);
 		mod->registered = false;
 	}
+	wbuff_debugfs_init();
 	wbuff.initialized = true;
+	qdf_periodic_work_start(&wbuff.resize_work, WBUFF_RESIZE_INTERVAL_MS);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -196,16 +578,22 @@ QDF_STATUS wbuff_module_deinit(void)
 {
 	struct wbuff_module *mod = NULL;
 	uint8_t mslot = 0;
+	int cpu;
 
 	if (!wbuff.initialized)
 		return QDF_STATUS_E_INVAL;
 
 	wbuff.initialized = false;
+	qdf_periodic_work_stop_sync(&wbuff.resize_work);
+	qdf_periodic_work_destroy(&wbuff.resize_work);
+	wbuff_debugfs_deinit();
 	for (mslot = 0; mslot < WBUFF_MAX_MODULES; mslot++) {
 		mod = &wbuff.mod[mslot];
 		if (mod->registered)
 			wbuff_module_deregister((struct wbuff_mod_handle *)
 						&mod->handle);
+		for (cpu = 0; cpu < WBUFF_MAX_CPUS; cpu++)
+			qdf_spinlock_destroy(&mod->cache[cpu].lock);
 		qdf_spinlock_destroy(&mod->lock);
 	}
 
@@ -217,10 +605,12 @@ wbuff_module_register(struct wbuff_alloc_request *req, uint8_t num,
 		      int reserve, int align)
 {
 	struct wbuff_module *mod = NULL;
+	struct wbuff_pool *pool;
 	qdf_nbuf_t buf = NULL;
 	uint32_t len = 0;
 	uint16_t idx = 0, psize = 0;
 	uint8_t alloc = 0, mslot = 0, pslot = 0;
+	int cpu;
 
 	if (!wbuff.initialized)
 		return NULL;
@@ -238,11 +628,18 @@ wbuff_module_register(struct wbuff_alloc_request *req, uint8_t num,
 	mod = &wbuff.mod[mslot];
 
 	mod->handle.id = mslot;
+	mod->reserve = reserve;
+	mod->align = align;
+	for (cpu = 0; cpu < WBUFF_MAX_CPUS; cpu++)
+		qdf_mem_zero(mod->cache[cpu].hits,
+			     sizeof(mod->cache[cpu].hits));
 
 	for (alloc = 0; alloc < num; alloc++) {
 		pslot = req[alloc].slot;
 		psize = req[alloc].size;
 		len = wbuff_get_len_from_pool_slot(pslot);
+		pool = &mod->pool[pslot];
+		pool->min = psize;
 		/**
 		 * Allocate pool_cnt number of buffers for
 		 * the pool given by pslot
@@ -252,17 +649,11 @@ wbuff_module_register(struct wbuff_alloc_request *req, uint8_t num,
 						 align);
 			if (!buf)
 				continue;
-			if (!mod->pool[pslot]) {
-				qdf_nbuf_set_next(buf, NULL);
-				mod->pool[pslot] = buf;
-			} else {
-				qdf_nbuf_set_next(buf, mod->pool[pslot]);
-				mod->pool[pslot] = buf;
-			}
+			wbuff_pool_push(pool, buf);
+			pool->total++;
 		}
+		pool->low_mark = pool->free;
 	}
-	mod->reserve = reserve;
-	mod->align = align;
 
 	return (struct wbuff_mod_handle *)&mod->handle;
 }
@@ -271,8 +662,10 @@ QDF_STATUS wbuff_module_deregister(struct wbuff_mod_handle *hdl)
 {
 	struct wbuff_handle *handle;
 	struct wbuff_module *mod = NULL;
+	struct wbuff_pcpu_cache *cache;
 	uint8_t mslot = 0, pslot = 0;
 	qdf_nbuf_t first = NULL, buf = NULL;
+	int cpu;
 
 	handle = (struct wbuff_handle *)hdl;
 
@@ -282,16 +675,32 @@ QDF_STATUS wbuff_module_deregister(struct wbuff_mod_handle *hdl)
 	mslot = handle->id;
 	mod = &wbuff.mod[mslot];
 
+	qdf_spin_lock_bh(&mod->lock);
+	mod->registered = false;
+	qdf_spin_unlock_bh(&mod->lock);
+
+	/* buffers put from now on are not cached anymore */
+	for (cpu = 0; cpu < WBUFF_MAX_CPUS; cpu++) {
+		cache = &mod->cache[cpu];
+		qdf_spin_lock_bh(&cache->lock);
+		for (pslot = 0; pslot < WBUFF_MAX_POOLS; pslot++) {
+			while (cache->count[pslot])
+				qdf_nbuf_free(cache->buf[pslot]
+						[--cache->count[pslot]]);
+		}
+		qdf_spin_unlock_bh(&cache->lock);
+	}
+
 	qdf_spin_lock_bh(&mod->lock);
 	for (pslot = 0; pslot < WBUFF_MAX_POOLS; pslot++) {
-		first = mod->pool[pslot];
+		first = mod->pool[pslot].head;
 		while (first) {
 			buf = first;
 			first = qdf_nbuf_next(buf);
 			qdf_nbuf_free(buf);
 		}
 	}
-	mod->registered = false;
+	qdf_mem_zero(mod->pool, sizeof(mod->pool));
 	qdf_spin_unlock_bh(&mod->lock);
 
 	return QDF_STATUS_SUCCESS;
@@ -302,6 +711,7 @@ qdf_nbuf_t wbuff_buff_get(struct wbuff_mod_handle *hdl, uint32_t len,
 {
 	struct wbuff_handle *handle;
 	struct wbuff_module *mod = NULL;
+	struct wbuff_pcpu_cache *cache;
 	uint8_t mslot = 0;
 	uint8_t pslot = 0;
 	qdf_nbuf_t buf = NULL;
@@ -315,18 +725,28 @@ qdf_nbuf_t wbuff_buff_get(struct wbuff_mod_handle *hdl, uint32_t len,
 	mslot = handle->id;
 	pslot = wbuff_get_pool_slot_from_len(len);
 	mod = &wbuff.mod[mslot];
-
-	qdf_spin_lock_bh(&mod->lock);
-	if (mod->pool[pslot]) {
-		buf = mod->pool[pslot];
-		mod->pool[pslot] = qdf_nbuf_next(buf);
-		mod->pending_returns++;
-	}
-	qdf_spin_unlock_bh(&mod->lock);
-	if (buf) {
-		qdf_nbuf_set_next(buf, NULL);
-		qdf_net_buf_debug_update_node(buf, func_name, line_num);
+	cache = wbuff_get_cache(mod);
+
+	qdf_spin_lock_bh(&cache->lock);
+	cache->active[pslot] = true;
+	if (cache->count[pslot]) {
+		buf = cache->buf[pslot][--cache->count[pslot]];
+		cache->hits[pslot]++;
+	} else {
+		buf = wbuff_cache_refill(mod, cache, pslot);
 	}
+	qdf_spin_unlock_bh(&cache->lock);
+
+	if (!buf)
+		buf = wbuff_cache_steal(mod, cache, pslot);
+	if (!buf)
+		buf = wbuff_pool_grow(mod, mslot, pslot);
+	if (!buf)
+		return NULL;
+
+	qdf_atomic_inc(&mod->pending_returns);
+	qdf_nbuf_set_next(buf, NULL);
+	qdf_net_buf_debug_update_node(buf, func_name, line_num);
 
 	return buf;
 }
@@ -334,6 +754,8 @@ qdf_nbuf_t wbuff_buff_get(struct wbuff_mod_handle *hdl, uint32_t len,
 qdf_nbuf_t wbuff_buff_put(qdf_nbuf_t buf)
 {
 	qdf_nbuf_t buffer = buf;
+	struct wbuff_module *mod;
+	struct wbuff_pcpu_cache *cache;
 	unsigned long slot_info = 0;
 	uint8_t mslot = 0, pslot = 0;
 
@@ -350,16 +772,20 @@ qdf_nbuf_t wbuff_buff_put(qdf_nbuf_t buf)
 	if (mslot >= WBUFF_MAX_MODULES || pslot >= WBUFF_MAX_POOLS)
 		return NULL;
 
-	qdf_nbuf_reset(buffer, wbuff.mod[mslot].reserve, wbuff.mod[mslot].
-		       align);
-	qdf_spin_lock_bh(&wbuff.mod[mslot].lock);
-	if (wbuff.mod[mslot].registered) {
-		qdf_nbuf_set_next(buffer, wbuff.mod[mslot].pool[pslot]);
-		wbuff.mod[mslot].pool[pslot] = buffer;
-		wbuff.mod[mslot].pending_returns--;
+	mod = &wbuff.mod[mslot];
+	qdf_nbuf_reset(buffer, mod->reserve, mod->align);
+	cache = wbuff_get_cache(mod);
+
+	qdf_spin_lock_bh(&cache->lock);
+	if (mod->registered) {
+		if (cache->count[pslot] == WBUFF_PCPU_CACHE_SIZE)
+			wbuff_cache_flush(mod, cache, pslot);
+		cache->buf[pslot][cache->count[pslot]++] = buffer;
+		cache->active[pslot] = true;
+		qdf_atomic_dec(&mod->pending_returns);
 		buffer = NULL;
 	}
-	qdf_spin_unlock_bh(&wbuff.mod[mslot].lock);
+	qdf_spin_unlock_bh(&cache->lock);
 
 	return buffer;
 }
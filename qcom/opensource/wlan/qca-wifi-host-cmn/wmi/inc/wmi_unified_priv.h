@@ -112,6 +112,9 @@
 #endif
 
 #define WMI_UNIFIED_MAX_EVENT 0x100
+/* Slots of the event handler index, at least twice WMI_UNIFIED_MAX_EVENT */
+#define WMI_EVENT_IDX_HASH_BITS 9
+#define WMI_EVENT_IDX_HASH_SIZE (1 << WMI_EVENT_IDX_HASH_BITS)
 
 #ifdef WMI_EXT_DBG
 
@@ -258,12 +261,15 @@ struct wmi_command_cmp_debug {
  * @ command - Store WMI Event id
  * @ data - Stores WMI Event data
  * @ time - Time of WMI Event handling
+ * @ dispatch_us - Time from the start of the event processing to the return
+ *		   of its handler, 0 if not measured
  */
 struct wmi_event_debug {
 	uint32_t event;
 	/* WMI event data excluding TLV header */
 	uint32_t data[WMI_DEBUG_ENTRY_MAX_LENGTH / sizeof(uint32_t)];
 	uint64_t time;
+	uint32_t dispatch_us;
 };
 
 /**
@@ -2980,11 +2986,35 @@ struct wmi_host_abi_version {
 /* number of debugfs entries used */
 #ifdef WMI_INTERFACE_FILTERED_EVENT_LOGGING
 /* filtered logging added 4 more entries */
-#define NUM_DEBUG_INFOS 13
+#define NUM_DEBUG_INFOS 14
 #else
-#define NUM_DEBUG_INFOS 9
+#define NUM_DEBUG_INFOS 10
 #endif
 
+/**
+ * struct wmitlv_parse_stats - WMI TLV parsing counters
+ * @zero_copy_tlvs: TLVs handed to the handler in place
+ * @padded_tlvs: TLVs copied to a padded buffer, their size differing from
+ *	the host structure
+ * @param_cache_hits: cmd/events whose TLV parameter structure came from the
+ *	cache
+ * @param_allocs: cmd/events whose TLV parameter structure was allocated
+ */
+struct wmitlv_parse_stats {
+	uint32_t zero_copy_tlvs;
+	uint32_t padded_tlvs;
+	uint32_t param_cache_hits;
+	uint32_t param_allocs;
+};
+
+/**
+ * wmitlv_get_parse_stats() - get the WMI TLV parsing counters
+ * @stats: filled with the counters
+ *
+ * Return: none
+ */
+void wmitlv_get_parse_stats(struct wmitlv_parse_stats *stats);
+
 struct wmi_unified {
 	void *scn_handle;    /* handle to device */
 	osdev_t  osdev; /* handle to use OS-independent services */
@@ -3075,6 +3105,8 @@ struct wmi_soc {
 	uint32_t event_id[WMI_UNIFIED_MAX_EVENT];
 	wmi_unified_event_handler event_handler[WMI_UNIFIED_MAX_EVENT];
 	uint32_t max_event_idx;
+	/* event handler index + 1 by hash of the event id, 0 for a free slot */
+	uint16_t event_idx_hash[WMI_EVENT_IDX_HASH_SIZE];
 	struct wmi_unified_exec_ctx ctx[WMI_UNIFIED_MAX_EVENT];
 	qdf_spinlock_t ctx_lock;
 	struct wmi_unified *wmi_pdev[WMI_MAX_RADIOS];
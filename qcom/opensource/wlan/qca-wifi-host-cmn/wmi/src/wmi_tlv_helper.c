@@ -21,6 +21,8 @@
 #include "wmi_tlv_defs.h"
 #include "wmi_version.h"
 #include "qdf_module.h"
+#include "qdf_atomic.h"
+#include "wmi_unified_priv.h"
 
 #define WMITLV_GET_ATTRIB_NUM_TLVS  0xFFFFFFFF
 
@@ -54,9 +56,259 @@ uint32_t evt_attr_list[] = {
 	WMITLV_ALL_EVT_LIST(WMITLV_GET_CMD_EVT_ATTRB_LIST)
 };
 
+/*
+ * Index of the attribute lists: open addressing hash table mapping a
+ * command/event ID to the position of its first attribute word in
+ * cmd_attr_list/evt_attr_list. The number of IDs is known at compile time,
+ * the tables are sized to keep them at most half full so that a lookup
+ * is O(1), instead of walking the attribute list for every TLV.
+ */
+#define WMITLV_CNT_CMD(id) WMITLV_CNT_CMD_##id,
+#define WMITLV_CNT_EVT(id) WMITLV_CNT_EVT_##id,
+
+enum {
+	WMITLV_ALL_CMD_LIST(WMITLV_CNT_CMD)
+	WMITLV_NUM_CMDS
+};
+
+enum {
+	WMITLV_ALL_EVT_LIST(WMITLV_CNT_EVT)
+	WMITLV_NUM_EVTS
+};
+
+#define WMITLV_CMD_IDX_BITS 11
+#define WMITLV_EVT_IDX_BITS 10
+
+QDF_COMPILE_TIME_ASSERT(wmitlv_cmd_idx_size,
+			(1 << WMITLV_CMD_IDX_BITS) >= 2 * WMITLV_NUM_CMDS);
+QDF_COMPILE_TIME_ASSERT(wmitlv_evt_idx_size,
+			(1 << WMITLV_EVT_IDX_BITS) >= 2 * WMITLV_NUM_EVTS);
+
+/**
+ * struct wmitlv_attr_idx_entry - attribute index entry
+ * @id: command/event ID
+ * @pos: position of the ID in the attribute list plus one, 0 if unused
+ */
+struct wmitlv_attr_idx_entry {
+	uint32_t id;
+	uint32_t pos;
+};
+
+enum wmitlv_attr_idx_state {
+	WMITLV_ATTR_IDX_NONE,
+	WMITLV_ATTR_IDX_BUILDING,
+	WMITLV_ATTR_IDX_READY,
+};
+
+static struct wmitlv_attr_idx_entry cmd_attr_idx[1 << WMITLV_CMD_IDX_BITS];
+static struct wmitlv_attr_idx_entry evt_attr_idx[1 << WMITLV_EVT_IDX_BITS];
+static qdf_atomic_t wmitlv_attr_idx_state;
+
+/**
+ * wmitlv_attr_idx_slot() - first slot to probe for an ID
+ * @id: command/event ID
+ * @bits: log2 of the index size
+ *
+ * Return: slot
+ */
+static inline uint32_t wmitlv_attr_idx_slot(uint32_t id, uint32_t bits)
+{
+	return (id * 0x9E3779B1) >> (32 - bits);
+}
+
+/**
+ * wmitlv_attr_idx_fill() - index one attribute list
+ * @attr_list: attribute list
+ * @num_entries: number of words in @attr_list
+ * @idx: index to fill
+ * @bits: log2 of the number of slots of @idx
+ *
+ * Return: none
+ */
+static void wmitlv_attr_idx_fill(uint32_t *attr_list, uint32_t num_entries,
+				 struct wmitlv_attr_idx_entry *idx,
+				 uint32_t bits)
+{
+	uint32_t mask = (1 << bits) - 1;
+	uint32_t i, id, slot;
+
+	for (i = 0; i < num_entries;
+	     i += WMITLV_GET_NUM_TLVS(attr_list[i]) + 1) {
+		id = WMITLV_GET_CMDID(attr_list[i]);
+		slot = wmitlv_attr_idx_slot(id, bits);
+		while (idx[slot].pos && idx[slot].id != id)
+			slot = (slot + 1) & mask;
+
+		/* keep the first definition, as the list walk did */
+		if (idx[slot].pos)
+			continue;
+
+		idx[slot].id = id;
+		idx[slot].pos = i + 1;
+	}
+}
+
+/**
+ * wmitlv_attr_idx_ready() - check the attribute index, building it if needed
+ *
+ * The index is built once, by the first caller. Callers racing with the
+ * build fall back to walking the attribute lists.
+ *
+ * Return: true if the index can be used
+ */
+static bool wmitlv_attr_idx_ready(void)
+{
+	if (qdf_likely(qdf_atomic_read(&wmitlv_attr_idx_state) ==
+		       WMITLV_ATTR_IDX_READY)) {
+		/* pairs with the barrier before the state is set to ready */
+		qdf_rmb();
+		return true;
+	}
+
+	if (qdf_atomic_cmpxchg(&wmitlv_attr_idx_state, WMITLV_ATTR_IDX_NONE,
+			       WMITLV_ATTR_IDX_BUILDING) !=
+	    WMITLV_ATTR_IDX_NONE)
+		return false;
+
+	wmitlv_attr_idx_fill(cmd_attr_list, QDF_ARRAY_SIZE(cmd_attr_list),
+			     cmd_attr_idx, WMITLV_CMD_IDX_BITS);
+	wmitlv_attr_idx_fill(evt_attr_list, QDF_ARRAY_SIZE(evt_attr_list),
+			     evt_attr_idx, WMITLV_EVT_IDX_BITS);
+
+	qdf_wmb();
+	qdf_atomic_set(&wmitlv_attr_idx_state, WMITLV_ATTR_IDX_READY);
+
+	return true;
+}
+
+/**
+ * wmitlv_attr_idx_find() - find the attributes of an ID
+ * @is_cmd_id: boolean for command attribute
+ * @cmd_event_id: command event id
+ * @pos: set to the position of the ID in the attribute list
+ *
+ * Return: 0 if found, 1 if the ID has no attributes, -1 if the index is not
+ * built yet
+ */
+static int wmitlv_attr_idx_find(uint32_t is_cmd_id, uint32_t cmd_event_id,
+				uint32_t *pos)
+{
+	struct wmitlv_attr_idx_entry *idx;
+	uint32_t id = WMITLV_GET_CMDID(cmd_event_id);
+	uint32_t bits, mask, slot;
+
+	if (!wmitlv_attr_idx_ready())
+		return -1;
+
+	if (is_cmd_id) {
+		idx = cmd_attr_idx;
+		bits = WMITLV_CMD_IDX_BITS;
+	} else {
+		idx = evt_attr_idx;
+		bits = WMITLV_EVT_IDX_BITS;
+	}
+
+	mask = (1 << bits) - 1;
+	slot = wmitlv_attr_idx_slot(id, bits);
+	while (idx[slot].pos) {
+		if (idx[slot].id == id) {
+			*pos = idx[slot].pos - 1;
+			return 0;
+		}
+		slot = (slot + 1) & mask;
+	}
+
+	return 1;
+}
+
 #ifdef NO_DYNAMIC_MEM_ALLOC
 static wmitlv_cmd_param_info *g_wmi_static_cmd_param_info_buf;
 uint32_t g_wmi_static_max_cmd_param_tlvs;
+#else
+/*
+ * TLVs whose size matches the host structure are handed to the handler in
+ * place, only the ones of a different size are copied to a padded buffer.
+ * The per event structure describing the TLVs is taken from a few cached
+ * buffers, so that an event without padding does not allocate at all.
+ */
+#define WMITLV_PARAM_CACHE_SLOTS 4
+#define WMITLV_PARAM_CACHE_TLVS 32
+
+static wmitlv_cmd_param_info
+wmitlv_param_cache[WMITLV_PARAM_CACHE_SLOTS][WMITLV_PARAM_CACHE_TLVS];
+static unsigned long wmitlv_param_cache_busy;
+#endif
+
+static struct {
+	qdf_atomic_t zero_copy_tlvs;
+	qdf_atomic_t padded_tlvs;
+	qdf_atomic_t param_cache_hits;
+	qdf_atomic_t param_allocs;
+} wmitlv_stats;
+
+void wmitlv_get_parse_stats(struct wmitlv_parse_stats *stats)
+{
+	stats->zero_copy_tlvs = qdf_atomic_read(&wmitlv_stats.zero_copy_tlvs);
+	stats->padded_tlvs = qdf_atomic_read(&wmitlv_stats.padded_tlvs);
+	stats->param_cache_hits =
+		qdf_atomic_read(&wmitlv_stats.param_cache_hits);
+	stats->param_allocs = qdf_atomic_read(&wmitlv_stats.param_allocs);
+}
+
+qdf_export_symbol(wmitlv_get_parse_stats);
+
+#ifndef NO_DYNAMIC_MEM_ALLOC
+/**
+ * wmitlv_param_alloc() - get the TLV parameter structure of a cmd/event
+ * @os_handle: os context handle
+ * @num_tlvs: number of TLVs of the cmd/event
+ *
+ * Return: zeroed structure or NULL
+ */
+static wmitlv_cmd_param_info *wmitlv_param_alloc(void *os_handle,
+						  uint32_t num_tlvs)
+{
+	wmitlv_cmd_param_info *param = NULL;
+	uint32_t len = num_tlvs * sizeof(wmitlv_cmd_param_info);
+	int i;
+
+	if (num_tlvs <= WMITLV_PARAM_CACHE_TLVS) {
+		for (i = 0; i < WMITLV_PARAM_CACHE_SLOTS; i++) {
+			if (qdf_atomic_test_and_set_bit(i,
+						&wmitlv_param_cache_busy))
+				continue;
+
+			qdf_atomic_inc(&wmitlv_stats.param_cache_hits);
+			param = wmitlv_param_cache[i];
+			wmi_tlv_OS_MEMZERO(param, len);
+			return param;
+		}
+	}
+
+	qdf_atomic_inc(&wmitlv_stats.param_allocs);
+	wmi_tlv_os_mem_alloc(os_handle, param, len);
+
+	return param;
+}
+
+/**
+ * wmitlv_param_free() - release a TLV parameter structure
+ * @param: structure from wmitlv_param_alloc()
+ *
+ * Return: none
+ */
+static void wmitlv_param_free(void *param)
+{
+	uintptr_t offset = (uintptr_t)param - (uintptr_t)wmitlv_param_cache;
+
+	if (offset < sizeof(wmitlv_param_cache)) {
+		qdf_atomic_clear_bit(offset / sizeof(wmitlv_param_cache[0]),
+				     &wmitlv_param_cache_busy);
+		return;
+	}
+
+	wmi_tlv_os_mem_free(param);
+}
 #endif
 
 
@@ -108,6 +360,7 @@ uint32_t wmitlv_get_attributes(uint32_t is_cmd_id, uint32_t cmd_event_id,
 {
 	uint32_t i, base_index, num_tlvs, num_entries;
 	uint32_t *pAttrArrayList;
+	int ret;
 
 	if (is_cmd_id) {
 		pAttrArrayList = &cmd_attr_list[0];
@@ -117,7 +370,14 @@ uint32_t wmitlv_get_attributes(uint32_t is_cmd_id, uint32_t cmd_event_id,
 		num_entries = QDF_ARRAY_SIZE(evt_attr_list);
 	}
 
-	for (i = 0; i < num_entries; i++) {
+	i = 0;
+	ret = wmitlv_attr_idx_find(is_cmd_id, cmd_event_id, &i);
+	if (ret > 0)
+		num_entries = 0;
+	else if (!ret)
+		num_entries = i + 1;
+
+	for (; i < num_entries; i++) {
 		num_tlvs = WMITLV_GET_NUM_TLVS(pAttrArrayList[i]);
 		if (WMITLV_GET_CMDID(cmd_event_id) ==
 		    WMITLV_GET_CMDID(pAttrArrayList[i])) {
@@ -500,6 +760,8 @@ wmitlv_check_and_pad_tlvs(void *os_handle, void *param_struc_ptr,
 	uint32_t remaining_expected_tlvs = 0xFFFFFFFF;
 	uint32_t len_wmi_cmd_struct_buf;
 	uint32_t free_buf_len;
+	uint32_t num_zero_copy = 0;
+	uint32_t num_padded = 0;
 	int32_t error = -1;
 
 	/* Get the number of TLVs for this command/event */
@@ -525,8 +787,8 @@ wmitlv_check_and_pad_tlvs(void *os_handle, void *param_struc_ptr,
 		attr_struct_ptr.cmd_num_tlv * sizeof(wmitlv_cmd_param_info);
 #ifndef NO_DYNAMIC_MEM_ALLOC
 	/* Dynamic memory allocation supported */
-	wmi_tlv_os_mem_alloc(os_handle, *wmi_cmd_struct_ptr,
-			     len_wmi_cmd_struct_buf);
+	*wmi_cmd_struct_ptr = wmitlv_param_alloc(os_handle,
+						 attr_struct_ptr.cmd_num_tlv);
 #else
 	/* Dynamic memory allocation is not supported. Use the buffer
 	 * g_wmi_static_cmd_param_info_buf, which should be set using
@@ -551,7 +813,9 @@ wmitlv_check_and_pad_tlvs(void *os_handle, void *param_struc_ptr,
 	}
 
 	cmd_param_tlvs_ptr = (wmitlv_cmd_param_info *) *wmi_cmd_struct_ptr;
+#ifdef NO_DYNAMIC_MEM_ALLOC
 	wmi_tlv_OS_MEMZERO(cmd_param_tlvs_ptr, len_wmi_cmd_struct_buf);
+#endif
 	remaining_expected_tlvs = attr_struct_ptr.cmd_num_tlv;
 
 	while (((buf_idx + WMI_TLV_HDR_SIZE) <= param_buf_len)
@@ -887,6 +1151,7 @@ wmitlv_check_and_pad_tlvs(void *os_handle, void *param_struc_ptr,
 			cmd_param_tlvs_ptr[tlv_index].num_elements =
 				num_of_elems;
 			cmd_param_tlvs_ptr[tlv_index].buf_is_allocated = 1;     /* Indicates that buffer is allocated */
+			num_padded++;
 
 		} else if (tlv_size_diff >= 0) {
 			/* Warning: some parameter truncation */
@@ -902,6 +1167,7 @@ wmitlv_check_and_pad_tlvs(void *os_handle, void *param_struc_ptr,
 			cmd_param_tlvs_ptr[tlv_index].num_elements =
 				num_of_elems;
 			cmd_param_tlvs_ptr[tlv_index].buf_is_allocated = 0;     /* Indicates that buffer is not allocated */
+			num_zero_copy++;
 		} else {
 			void *new_tlv_buf = NULL;
 
@@ -957,6 +1223,7 @@ wmitlv_check_and_pad_tlvs(void *os_handle, void *param_struc_ptr,
 			cmd_param_tlvs_ptr[tlv_index].num_elements =
 				num_of_elems;
 			cmd_param_tlvs_ptr[tlv_index].buf_is_allocated = 1;     /* Indicates that buffer is allocated */
+			num_padded++;
 		}
 
 		tlv_index++;
@@ -965,6 +1232,9 @@ wmitlv_check_and_pad_tlvs(void *os_handle, void *param_struc_ptr,
 		buf_idx += curr_tlv_len + num_padding_bytes;
 	}
 
+	qdf_atomic_add(num_zero_copy, &wmitlv_stats.zero_copy_tlvs);
+	qdf_atomic_add(num_padded, &wmitlv_stats.padded_tlvs);
+
 	return 0;
 Error_wmitlv_check_and_pad_tlvs:
 	if (is_cmd_id) {
@@ -1086,7 +1356,7 @@ break;
 		}
 	}
 
-	wmi_tlv_os_mem_free(*wmi_cmd_struct_ptr);
+	wmitlv_param_free(*wmi_cmd_struct_ptr);
 	*wmi_cmd_struct_ptr = NULL;
 #endif
 
@@ -233,6 +233,9 @@ static void wmi_minidump_attach(struct wmi_unified *wmi_handle)
 	((struct wmi_event_debug *)h->log_info.wmi_event_log_buf_info.buf)\
 		[*(h->log_info.wmi_event_log_buf_info.p_buf_tail_idx)].time =\
 		qdf_get_log_timestamp();				\
+	((struct wmi_event_debug *)h->log_info.wmi_event_log_buf_info.buf)\
+		[*(h->log_info.wmi_event_log_buf_info.p_buf_tail_idx)].	\
+		dispatch_us = 0;					\
 	(*(h->log_info.wmi_event_log_buf_info.p_buf_tail_idx))++;	\
 	h->log_info.wmi_event_log_buf_info.length++;			\
 }
@@ -987,6 +990,10 @@ wmi_print_mgmt_event_log(wmi_unified_t wmi, uint32_t count,
 			outlen +=					\
 			wmi_bp_seq_printf(m, "Event TIME = [%llu.%06llu]\n",\
 				secs, usecs);				\
+			if (wmi_record->dispatch_us)			\
+				outlen += wmi_bp_seq_printf(m,		\
+					"Event DISPATCH = %u us\n",	\
+					wmi_record->dispatch_us);	\
 			outlen += wmi_bp_seq_printf(m, "CMD = ");	\
 			for (i = 0; i < (wmi_record_max_length/		\
 					sizeof(uint32_t)); i++)		\
@@ -1058,6 +1065,26 @@ static int debug_wmi_log_size_show(struct seq_file *m, void *v)
 				 wmi_diag_log_max_entry);
 }
 
+/**
+ * debug_wmi_tlv_stats_show() - debugfs functions to display the WMI TLV
+ * parsing counters.
+ *
+ * @m: debugfs handler to access wmi_handle
+ * @v: Variable arguments (not used)
+ *
+ * Return: Length of characters printed
+ */
+static int debug_wmi_tlv_stats_show(struct seq_file *m, void *v)
+{
+	struct wmitlv_parse_stats stats;
+
+	wmitlv_get_parse_stats(&stats);
+	wmi_bp_seq_printf(m, "WMI TLVs zero copy/padded:%u/%u\n",
+			  stats.zero_copy_tlvs, stats.padded_tlvs);
+	return wmi_bp_seq_printf(m, "WMI TLV params cached/allocated:%u/%u\n",
+				 stats.param_cache_hits, stats.param_allocs);
+}
+
 /**
  * debug_wmi_##func_base##_write() - debugfs functions to clear
  * wmi logging command/event buffer and management command/event buffer.
@@ -1167,6 +1194,24 @@ static ssize_t debug_wmi_log_size_write(struct file *file,
 	return -EINVAL;
 }
 
+/**
+ * debug_wmi_tlv_stats_write() - reserved.
+ *
+ * @file: file handler to access wmi_handle
+ * @buf: received data buffer
+ * @count: length of received buffer
+ * @ppos: Not used
+ *
+ * The TLV parse counters are read-only, so writes are rejected.
+ *
+ * Return: -EINVAL
+ */
+static ssize_t debug_wmi_tlv_stats_write(struct file *file,
+		const char __user *buf, size_t count, loff_t *ppos)
+{
+	return -EINVAL;
+}
+
 /* Structure to maintain debug information */
 struct wmi_debugfs_info {
 	const char *name;
@@ -1211,6 +1256,7 @@ GENERATE_DEBUG_STRUCTS(wmi_mgmt_command_tx_cmp_log);
 GENERATE_DEBUG_STRUCTS(wmi_mgmt_event_log);
 GENERATE_DEBUG_STRUCTS(wmi_enable);
 GENERATE_DEBUG_STRUCTS(wmi_log_size);
+GENERATE_DEBUG_STRUCTS(wmi_tlv_stats);
 #ifdef WMI_INTERFACE_FILTERED_EVENT_LOGGING
 GENERATE_DEBUG_STRUCTS(filtered_wmi_cmds);
 GENERATE_DEBUG_STRUCTS(filtered_wmi_evts);
@@ -1228,6 +1274,7 @@ struct wmi_debugfs_info wmi_debugfs_infos[NUM_DEBUG_INFOS] = {
 	DEBUG_FOO(wmi_mgmt_event_log),
 	DEBUG_FOO(wmi_enable),
 	DEBUG_FOO(wmi_log_size),
+	DEBUG_FOO(wmi_tlv_stats),
 #ifdef WMI_INTERFACE_FILTERED_EVENT_LOGGING
 	DEBUG_FOO(filtered_wmi_cmds),
 	DEBUG_FOO(filtered_wmi_evts),
@@ -2113,6 +2160,82 @@ QDF_STATUS wmi_unified_cmd_send_fl(wmi_unified_t wmi_handle, wmi_buf_t buf,
 }
 qdf_export_symbol(wmi_unified_cmd_send_fl);
 
+/*
+ * The registered event handlers are indexed by an open addressing hash
+ * table of the event id, so that dispatching an event does not scan the
+ * handler table. Slots hold the handler index + 1; removed entries leave
+ * a tombstone so that the probe sequence of the other ids stays intact
+ * for the event handling running concurrently.
+ */
+#define WMI_EVENT_IDX_HASH_TOMBSTONE 0xFFFF
+
+QDF_COMPILE_TIME_ASSERT(wmi_event_idx_hash_size,
+			WMI_EVENT_IDX_HASH_SIZE >= 2 * WMI_UNIFIED_MAX_EVENT &&
+			WMI_EVENT_IDX_HASH_SIZE < WMI_EVENT_IDX_HASH_TOMBSTONE);
+
+/**
+ * wmi_event_idx_hash() - first slot of an event id in the handler index
+ * @event_id: wmi event id
+ *
+ * Return: slot
+ */
+static inline uint32_t wmi_event_idx_hash(uint32_t event_id)
+{
+	return (event_id * 0x9E3779B1) >> (32 - WMI_EVENT_IDX_HASH_BITS);
+}
+
+/**
+ * wmi_event_idx_hash_find() - find the slot of an event id
+ * @soc: wmi soc
+ * @event_id: wmi event id
+ *
+ * Return: slot of the registered handler of @event_id, -1 if none
+ */
+static int wmi_event_idx_hash_find(struct wmi_soc *soc, uint32_t event_id)
+{
+	uint32_t slot = wmi_event_idx_hash(event_id);
+	uint32_t n;
+	uint16_t pos;
+
+	for (n = 0; n < WMI_EVENT_IDX_HASH_SIZE; n++) {
+		pos = soc->event_idx_hash[slot];
+		if (!pos)
+			break;
+
+		if (pos != WMI_EVENT_IDX_HASH_TOMBSTONE &&
+		    soc->event_id[pos - 1] == event_id &&
+		    soc->event_handler[pos - 1])
+			return slot;
+
+		slot = (slot + 1) & (WMI_EVENT_IDX_HASH_SIZE - 1);
+	}
+
+	return -1;
+}
+
+/**
+ * wmi_event_idx_hash_add() - add a registered handler to the index
+ * @soc: wmi soc
+ * @idx: handler index, its event id and handler must be set
+ *
+ * The index has twice the slots of the handler table, a free slot or a
+ * tombstone is always found.
+ *
+ * Return: none
+ */
+static void wmi_event_idx_hash_add(struct wmi_soc *soc, uint32_t idx)
+{
+	uint32_t slot = wmi_event_idx_hash(soc->event_id[idx]);
+
+	while (soc->event_idx_hash[slot] &&
+	       soc->event_idx_hash[slot] != WMI_EVENT_IDX_HASH_TOMBSTONE)
+		slot = (slot + 1) & (WMI_EVENT_IDX_HASH_SIZE - 1);
+
+	/* publish the handler before its slot */
+	qdf_wmb();
+	soc->event_idx_hash[slot] = idx + 1;
+}
+
 /**
  * wmi_unified_get_event_handler_ix() - gives event handler's index
  * @wmi_handle: handle to wmi
@@ -2123,19 +2246,60 @@ qdf_export_symbol(wmi_unified_cmd_send_fl);
 static int wmi_unified_get_event_handler_ix(wmi_unified_t wmi_handle,
 					    uint32_t event_id)
 {
-	uint32_t idx = 0;
-	int32_t invalid_idx = -1;
+	int slot;
+
+	slot = wmi_event_idx_hash_find(wmi_handle->soc, event_id);
+	if (slot < 0)
+		return -1;
+
+	return wmi_handle->soc->event_idx_hash[slot] - 1;
+}
+
+/**
+ * wmi_unified_remove_event_handler_ix() - remove a registered event handler
+ * @wmi_handle: handle to wmi
+ * @idx: index of the handler
+ *
+ * The last handler of the table is moved to @idx.
+ *
+ * Return: none
+ */
+static void wmi_unified_remove_event_handler_ix(wmi_unified_t wmi_handle,
+						uint32_t idx)
+{
 	struct wmi_soc *soc = wmi_handle->soc;
+	int slot, last_slot = -1;
+	uint32_t last = soc->max_event_idx - 1;
 
-	for (idx = 0; (idx < soc->max_event_idx &&
-		       idx < WMI_UNIFIED_MAX_EVENT); ++idx) {
-		if (wmi_handle->event_id[idx] == event_id &&
-		    wmi_handle->event_handler[idx]) {
-			return idx;
-		}
+	slot = wmi_event_idx_hash_find(soc, wmi_handle->event_id[idx]);
+	if (idx != last && wmi_handle->event_handler[last])
+		last_slot = wmi_event_idx_hash_find(soc,
+						    wmi_handle->event_id[last]);
+	if (slot >= 0)
+		soc->event_idx_hash[slot] = WMI_EVENT_IDX_HASH_TOMBSTONE;
+
+	wmi_handle->event_handler[idx] = NULL;
+	wmi_handle->event_id[idx] = 0;
+	--soc->max_event_idx;
+	wmi_handle->event_handler[idx] =
+		wmi_handle->event_handler[soc->max_event_idx];
+	wmi_handle->event_id[idx] =
+		wmi_handle->event_id[soc->max_event_idx];
+
+	/* the last entry is left in place, its slot can move at any time */
+	if (last_slot >= 0) {
+		qdf_wmb();
+		soc->event_idx_hash[last_slot] = idx + 1;
 	}
 
-	return invalid_idx;
+	qdf_spin_lock_bh(&soc->ctx_lock);
+
+	wmi_handle->ctx[idx].exec_ctx =
+		wmi_handle->ctx[soc->max_event_idx].exec_ctx;
+	wmi_handle->ctx[idx].buff_type =
+		wmi_handle->ctx[soc->max_event_idx].buff_type;
+
+	qdf_spin_unlock_bh(&soc->ctx_lock);
 }
 
 /**
@@ -2196,6 +2360,7 @@ wmi_register_event_handler_with_ctx(wmi_unified_t wmi_handle,
 	wmi_handle->ctx[idx].buff_type = rx_buf_type;
 	qdf_spin_unlock_bh(&soc->ctx_lock);
 	soc->max_event_idx++;
+	wmi_event_idx_hash_add(soc, idx);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -2265,22 +2430,7 @@ QDF_STATUS wmi_unified_unregister_event(wmi_unified_t wmi_handle,
 			 evt_id);
 		return QDF_STATUS_E_FAILURE;
 	}
-	wmi_handle->event_handler[idx] = NULL;
-	wmi_handle->event_id[idx] = 0;
-	--soc->max_event_idx;
-	wmi_handle->event_handler[idx] =
-		wmi_handle->event_handler[soc->max_event_idx];
-	wmi_handle->event_id[idx] =
-		wmi_handle->event_id[soc->max_event_idx];
-
-	qdf_spin_lock_bh(&soc->ctx_lock);
-
-	wmi_handle->ctx[idx].exec_ctx =
-		wmi_handle->ctx[soc->max_event_idx].exec_ctx;
-	wmi_handle->ctx[idx].buff_type =
-		wmi_handle->ctx[soc->max_event_idx].buff_type;
-
-	qdf_spin_unlock_bh(&soc->ctx_lock);
+	wmi_unified_remove_event_handler_ix(wmi_handle, idx);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -2312,22 +2462,7 @@ QDF_STATUS wmi_unified_unregister_event_handler(wmi_unified_t wmi_handle,
 			 evt_id);
 		return QDF_STATUS_E_FAILURE;
 	}
-	wmi_handle->event_handler[idx] = NULL;
-	wmi_handle->event_id[idx] = 0;
-	--soc->max_event_idx;
-	wmi_handle->event_handler[idx] =
-		wmi_handle->event_handler[soc->max_event_idx];
-	wmi_handle->event_id[idx] =
-		wmi_handle->event_id[soc->max_event_idx];
-
-	qdf_spin_lock_bh(&soc->ctx_lock);
-
-	wmi_handle->ctx[idx].exec_ctx =
-		wmi_handle->ctx[soc->max_event_idx].exec_ctx;
-	wmi_handle->ctx[idx].buff_type =
-		wmi_handle->ctx[soc->max_event_idx].buff_type;
-
-	qdf_spin_unlock_bh(&soc->ctx_lock);
+	wmi_unified_remove_event_handler_ix(wmi_handle, idx);
 
 	return QDF_STATUS_SUCCESS;
 }
@@ -2749,6 +2884,45 @@ void wmi_process_fw_event(struct wmi_unified *wmi_handle, wmi_buf_t evt_buf)
 	__wmi_control_rx(wmi_handle, evt_buf);
 }
 
+#ifdef WMI_INTERFACE_EVENT_LOGGING
+/**
+ * wmi_event_record_dispatch() - record the dispatch time of an event
+ * @wmi_handle: wmi handle
+ * @log_idx: event log entry of the event, -1 if it was not logged
+ * @id: wmi event id
+ * @start_ts: log timestamp taken when the event processing started
+ *
+ * Return: none
+ */
+static void wmi_event_record_dispatch(struct wmi_unified *wmi_handle,
+				      int32_t log_idx, uint32_t id,
+				      uint64_t start_ts)
+{
+	struct wmi_event_debug *wmi_record;
+	uint64_t dispatch_us;
+
+	if (log_idx < 0)
+		return;
+
+	dispatch_us = qdf_log_timestamp_to_usecs(qdf_get_log_timestamp() -
+						 start_ts);
+
+	qdf_spin_lock_bh(&wmi_handle->log_info.wmi_record_lock);
+	wmi_record = &((struct wmi_event_debug *)
+		       wmi_handle->log_info.wmi_event_log_buf_info.buf)[log_idx];
+	/* the entry may have been reused while the handler ran */
+	if (wmi_record->event == id && !wmi_record->dispatch_us)
+		wmi_record->dispatch_us = dispatch_us ? dispatch_us : 1;
+	qdf_spin_unlock_bh(&wmi_handle->log_info.wmi_record_lock);
+}
+#else
+static inline void wmi_event_record_dispatch(struct wmi_unified *wmi_handle,
+					     int32_t log_idx, uint32_t id,
+					     uint64_t start_ts)
+{
+}
+#endif
+
 /**
  * __wmi_control_rx() - process serialize wmi event callback
  * @wmi_handle: wmi handle
@@ -2768,6 +2942,8 @@ void __wmi_control_rx(struct wmi_unified *wmi_handle, wmi_buf_t evt_buf)
 	uint32_t idx = 0;
 	struct wmi_raw_event_buffer ev_buf;
 	enum wmi_rx_buff_type ev_buff_type;
+	uint64_t start_ts = qdf_get_log_timestamp();
+	int32_t log_idx = -1;
 
 	id = WMI_GET_FIELD(qdf_nbuf_data(evt_buf), WMI_CMD_HDR, COMMANDID);
 
@@ -2822,6 +2998,8 @@ void __wmi_control_rx(struct wmi_unified *wmi_handle, wmi_buf_t evt_buf)
 					wmi_handle->soc->buf_offset_event;
 
 			WMI_EVENT_RECORD(wmi_handle, id, tmpbuf);
+			log_idx = *wmi_handle->log_info.wmi_event_log_buf_info.
+				  p_buf_tail_idx - 1;
 			wmi_specific_evt_record(wmi_handle, id, tmpbuf);
 		}
 		qdf_spin_unlock_bh(&wmi_handle->log_info.wmi_record_lock);
@@ -2844,6 +3022,8 @@ void __wmi_control_rx(struct wmi_unified *wmi_handle, wmi_buf_t evt_buf)
 		wmi_handle->event_handler[idx] (wmi_handle->scn_handle,
 			data, len);
 
+	wmi_event_record_dispatch(wmi_handle, log_idx, id, start_ts);
+
 end:
 	/* Free event buffer and allocated event tlv */
 #ifndef WMI_NON_TLV_SUPPORT
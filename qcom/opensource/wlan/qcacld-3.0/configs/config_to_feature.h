@@ -81,6 +81,10 @@
 #define WLAN_TALLOC_DEBUG (1)
 #endif
 
+#ifdef CONFIG_QDF_TEST
+#define WLAN_BENCH_TEST (1)
+#endif
+
 #ifdef CONFIG_QDF_TEST
 #define WLAN_DELAYED_WORK_TEST (1)
 #endif
@@ -89,6 +93,10 @@
 #define WLAN_HASHTABLE_TEST (1)
 #endif
 
+#ifdef CONFIG_QDF_TEST
+#define WLAN_MEMPOOL_TEST (1)
+#endif
+
 #ifdef CONFIG_QDF_TEST
 #define WLAN_PERIODIC_WORK_TEST (1)
 #endif
@@ -97,6 +105,10 @@
 #define WLAN_PTR_HASH_TEST (1)
 #endif
 
+#ifdef CONFIG_QDF_TEST
+#define WLAN_RCU_TEST (1)
+#endif
+
 #ifdef CONFIG_QDF_TEST
 #define WLAN_SLIST_TEST (1)
 #endif
@@ -453,6 +465,10 @@
 #define FEATURE_WLAN_DP_RX_THREADS (1)
 #endif
 
+#ifdef CONFIG_DP_RX_TM_FLOW_STEERING
+#define DP_RX_TM_FLOW_STEERING (1)
+#endif
+
 #ifdef CONFIG_WLAN_FEATURE_RX_SOFTIRQ_TIME_LIMIT
 #define WLAN_FEATURE_RX_SOFTIRQ_TIME_LIMIT (1)
 #endif
@@ -2200,6 +2216,10 @@
 #define QDF_NBUF_HISTORY_SIZE (CONFIG_QDF_NBUF_HISTORY_SIZE)
 #endif
 
+#ifdef CONFIG_NBUF_MEMORY_DEBUG_SAMPLE_SHIFT
+#define NBUF_MEMORY_DEBUG_SAMPLE_SHIFT (CONFIG_NBUF_MEMORY_DEBUG_SAMPLE_SHIFT)
+#endif
+
 #ifdef CONFIG_WLAN_DP_PER_RING_TYPE_CONFIG
 #define WLAN_DP_PER_RING_TYPE_CONFIG (1)
 #endif
@@ -2729,6 +2749,18 @@
 #define DP_TX_TRACKING (1)
 #endif
 
+#ifdef CONFIG_DP_TX_DESC_PCPU_CACHE
+#define DP_TX_DESC_PCPU_CACHE (1)
+#endif
+
+#ifdef CONFIG_HAL_SRNG_SIM
+#define HAL_SRNG_SIM (1)
+#endif
+
+#ifdef CONFIG_DP_RX_HW_SW_NBUF_DESC_PREFETCH
+#define QCA_DP_RX_HW_SW_NBUF_DESC_PREFETCH (1)
+#endif
+
 #ifdef CONFIG_CHIP_VERSION
 #define CHIP_VERSION (CONFIG_CHIP_VERSION)
 #endif
@@ -22,6 +22,9 @@
 #include "dp_internal.h"
 #include <enet.h>
 #include <linux/skbuff.h>
+#include <linux/ipv6.h>
+#include <net/ip6_checksum.h>
+#include <net/tcp.h>
 #include "hif.h"
 
 static void dp_rx_fisa_flush_flow_wrap(struct dp_fisa_rx_sw_ft *sw_ft);
@@ -199,6 +202,9 @@ dp_fisa_is_ipsec_connection(struct cdp_rx_flow_tuple_info *flow_tuple_info)
  * @nbuf: msdu from which flow tuple is extracted.
  * @rx_tlv_hdr: Pointer to msdu TLVs
  *
+ * IPv4 addresses are stored as IPv4 compatible IPv6 addresses, the way
+ * the FSE expects them.
+ *
  * Return: None
  */
 static void
@@ -207,6 +213,7 @@ get_flow_tuple_from_nbuf(struct dp_soc *soc,
 			 qdf_nbuf_t nbuf, uint8_t *rx_tlv_hdr)
 {
 	struct iphdr *iph;
+	struct ipv6hdr *ip6h;
 	struct tcphdr *tcph;
 	uint32_t ip_hdr_offset;
 	uint32_t tcp_hdr_offset;
@@ -224,17 +231,43 @@ get_flow_tuple_from_nbuf(struct dp_soc *soc,
 	tcph = (struct tcphdr *)(qdf_nbuf_data(nbuf) + ip_hdr_offset +
 						tcp_hdr_offset);
 
-	flow_tuple_info->dest_ip_31_0 = qdf_ntohl(iph->daddr);
-	flow_tuple_info->dest_ip_63_32 = 0;
-	flow_tuple_info->dest_ip_95_64 = 0;
-	flow_tuple_info->dest_ip_127_96 =
-		HAL_IP_DA_SA_PREFIX_IPV4_COMPATIBLE_IPV6;
-
-	flow_tuple_info->src_ip_31_0 = qdf_ntohl(iph->saddr);
-	flow_tuple_info->src_ip_63_32 = 0;
-	flow_tuple_info->src_ip_95_64 = 0;
-	flow_tuple_info->src_ip_127_96 =
-		HAL_IP_DA_SA_PREFIX_IPV4_COMPATIBLE_IPV6;
+	if (iph->version == 6) {
+		ip6h = (struct ipv6hdr *)iph;
+
+		flow_tuple_info->dest_ip_31_0 =
+			qdf_ntohl(ip6h->daddr.s6_addr32[3]);
+		flow_tuple_info->dest_ip_63_32 =
+			qdf_ntohl(ip6h->daddr.s6_addr32[2]);
+		flow_tuple_info->dest_ip_95_64 =
+			qdf_ntohl(ip6h->daddr.s6_addr32[1]);
+		flow_tuple_info->dest_ip_127_96 =
+			qdf_ntohl(ip6h->daddr.s6_addr32[0]);
+
+		flow_tuple_info->src_ip_31_0 =
+			qdf_ntohl(ip6h->saddr.s6_addr32[3]);
+		flow_tuple_info->src_ip_63_32 =
+			qdf_ntohl(ip6h->saddr.s6_addr32[2]);
+		flow_tuple_info->src_ip_95_64 =
+			qdf_ntohl(ip6h->saddr.s6_addr32[1]);
+		flow_tuple_info->src_ip_127_96 =
+			qdf_ntohl(ip6h->saddr.s6_addr32[0]);
+
+		flow_tuple_info->l4_protocol = ip6h->nexthdr;
+	} else {
+		flow_tuple_info->dest_ip_31_0 = qdf_ntohl(iph->daddr);
+		flow_tuple_info->dest_ip_63_32 = 0;
+		flow_tuple_info->dest_ip_95_64 = 0;
+		flow_tuple_info->dest_ip_127_96 =
+			HAL_IP_DA_SA_PREFIX_IPV4_COMPATIBLE_IPV6;
+
+		flow_tuple_info->src_ip_31_0 = qdf_ntohl(iph->saddr);
+		flow_tuple_info->src_ip_63_32 = 0;
+		flow_tuple_info->src_ip_95_64 = 0;
+		flow_tuple_info->src_ip_127_96 =
+			HAL_IP_DA_SA_PREFIX_IPV4_COMPATIBLE_IPV6;
+
+		flow_tuple_info->l4_protocol = iph->protocol;
+	}
 
 	flow_tuple_info->dest_port = qdf_ntohs(tcph->dest);
 	flow_tuple_info->src_port = qdf_ntohs(tcph->source);
@@ -243,7 +276,6 @@ get_flow_tuple_from_nbuf(struct dp_soc *soc,
 	else
 		flow_tuple_info->is_exception = 0;
 
-	flow_tuple_info->l4_protocol = iph->protocol;
 	dp_fisa_debug("l4_protocol %d", flow_tuple_info->l4_protocol);
 
 	qdf_nbuf_push_head(nbuf, soc->rx_pkt_tlv_size + l2_hdr_offset);
@@ -518,9 +550,8 @@ dp_rx_fisa_add_ft_entry(struct dp_vdev *vdev,
 				    &proto_params))
 		return NULL;
 
-	if (proto_params.ipv6_proto ||
-	    !(proto_params.tcp_proto || proto_params.udp_proto)) {
-		dp_fisa_debug("Not UDP or TCP IPV4 flow");
+	if (!(proto_params.tcp_proto || proto_params.udp_proto)) {
+		dp_fisa_debug("Not UDP or TCP flow");
 		return NULL;
 	}
 
@@ -981,9 +1012,8 @@ dp_fisa_rx_queue_fst_update_work(struct dp_rx_fst *fisa_hdl, uint32_t flow_idx,
 				    &proto_params))
 		return NULL;
 
-	if (proto_params.ipv6_proto ||
-	    !(proto_params.tcp_proto || proto_params.udp_proto)) {
-		dp_fisa_debug("Not UDP or TCP IPV4 flow");
+	if (!(proto_params.tcp_proto || proto_params.udp_proto)) {
+		dp_fisa_debug("Not UDP or TCP flow");
 		return NULL;
 	}
 
@@ -1142,9 +1172,6 @@ dp_rx_get_fisa_flow(struct dp_rx_fst *fisa_hdl, struct dp_vdev *vdev,
 	hal_soc_handle_t hal_soc_hdl = fisa_hdl->soc_hdl->hal_soc;
 	QDF_STATUS status;
 
-	if (QDF_NBUF_CB_RX_TCP_PROTO(nbuf))
-		return sw_ft_entry;
-
 	rx_tlv_hdr = qdf_nbuf_data(nbuf);
 	hal_rx_msdu_get_reo_destination_indication(hal_soc_hdl, rx_tlv_hdr,
 						   &tlv_reo_dest_ind);
@@ -1183,57 +1210,222 @@ print_and_return:
 	return sw_ft_entry;
 }
 
-#ifdef NOT_YET
+/* TCP option words of a segment carrying only an aligned timestamp */
+#define FISA_TCP_TS_OPT_WORD \
+	((TCPOPT_NOP << 24) | (TCPOPT_NOP << 16) | \
+	 (TCPOPT_TIMESTAMP << 8) | TCPOLEN_TIMESTAMP)
+#define FISA_TCP_TS_HDR_LEN (sizeof(struct tcphdr) + TCPOLEN_TSTAMP_ALIGNED)
+/* Max IP total length (IPv4) or payload length (IPv6) of an aggregate */
+#define FISA_TCP_MAX_AGGR_IP_LEN 0xffff
+
 /**
- * dp_rx_fisa_aggr_tcp() - Aggregate incoming to TCP nbuf
+ * dp_rx_fisa_tcp_seg_len() - Check if a TCP segment can be aggregated
+ * @nbuf: segment, data pointing to the ethernet header
+ * @iph: IP header of the segment
+ * @l4_hdr_offset: offset of the TCP header from the IP header
+ * @tcph: TCP header of the segment
+ *
+ * A segment is eligible when HW validated its checksum, it carries data,
+ * has no IP options or IPv6 extension headers, only the ACK and PSH flags
+ * are set and its only TCP option is an aligned timestamp.
+ *
+ * Return: TCP payload length, 0 if the segment is not eligible
+ */
+static uint32_t dp_rx_fisa_tcp_seg_len(qdf_nbuf_t nbuf, struct iphdr *iph,
+				       uint32_t l4_hdr_offset,
+				       struct tcphdr *tcph)
+{
+	uint32_t tcp_hdr_len = tcph->doff * 4;
+	uint32_t ip_len;
+
+	if (nbuf->ip_summed != CHECKSUM_UNNECESSARY)
+		return 0;
+
+	if (iph->version == 6) {
+		if (l4_hdr_offset != sizeof(struct ipv6hdr) ||
+		    ((struct ipv6hdr *)iph)->nexthdr != IPPROTO_TCP)
+			return 0;
+		ip_len = qdf_ntohs(((struct ipv6hdr *)iph)->payload_len) +
+			 sizeof(struct ipv6hdr);
+	} else {
+		if (l4_hdr_offset != sizeof(struct iphdr) || iph->ihl != 5 ||
+		    (iph->frag_off & qdf_htons(IP_MF | IP_OFFSET)))
+			return 0;
+		ip_len = qdf_ntohs(iph->tot_len);
+	}
+
+	if ((tcp_flag_word(tcph) & (TCP_FLAG_SYN | TCP_FLAG_FIN |
+				    TCP_FLAG_RST | TCP_FLAG_URG |
+				    TCP_FLAG_CWR | TCP_FLAG_ECE)) ||
+	    !tcph->ack)
+		return 0;
+
+	if (tcp_hdr_len != sizeof(struct tcphdr) &&
+	    (tcp_hdr_len != FISA_TCP_TS_HDR_LEN ||
+	     *(__be32 *)(tcph + 1) != qdf_htonl(FISA_TCP_TS_OPT_WORD)))
+		return 0;
+
+	if (ip_len <= l4_hdr_offset + tcp_hdr_len ||
+	    qdf_nbuf_len(nbuf) < ((uint8_t *)iph - qdf_nbuf_data(nbuf)) +
+				 ip_len)
+		return 0;
+
+	return ip_len - l4_hdr_offset - tcp_hdr_len;
+}
+
+/**
+ * dp_rx_fisa_tcp_seg_match() - Check if a TCP segment continues the
+ *				ongoing aggregate of the flow
+ * @fisa_flow: Handle to SW flow entry, which holds the aggregated nbuf
+ * @iph: IP header of the segment
+ * @tcph: TCP header of the segment
+ * @payload_len: TCP payload length of the segment
+ *
+ * The segment has to be the next in order, carry the same IP header
+ * fields, ack number and TCP header length as the head skb, not be larger
+ * than the head skb payload (used as gso_size) and must not carry a
+ * timestamp older than the one of the last segment aggregated.
+ *
+ * Return: true if the segment can be appended to the aggregate
+ */
+static bool dp_rx_fisa_tcp_seg_match(struct dp_fisa_rx_sw_ft *fisa_flow,
+				     struct iphdr *iph, struct tcphdr *tcph,
+				     uint32_t payload_len)
+{
+	struct iphdr *head_iph =
+		(struct iphdr *)(qdf_nbuf_data(fisa_flow->head_skb) +
+				 fisa_flow->head_skb_ip_hdr_offset);
+	struct tcphdr *head_tcph = fisa_flow->head_skb_tcp_hdr;
+	struct tcphdr *last_tcph = fisa_flow->last_skb_tcp_hdr;
+	uint32_t aggr_len;
+
+	if (qdf_ntohl(tcph->seq) != fisa_flow->tcp_next_seq ||
+	    tcph->ack_seq != head_tcph->ack_seq ||
+	    tcph->doff != head_tcph->doff ||
+	    payload_len > fisa_flow->cur_aggr_gso_size)
+		return false;
+
+	if (iph->version != head_iph->version)
+		return false;
+
+	if (iph->version == 6) {
+		/* version, traffic class and flow label */
+		if (*(__be32 *)iph != *(__be32 *)head_iph ||
+		    ((struct ipv6hdr *)iph)->hop_limit !=
+		    ((struct ipv6hdr *)head_iph)->hop_limit)
+			return false;
+	} else if (iph->tos != head_iph->tos || iph->ttl != head_iph->ttl) {
+		return false;
+	}
+
+	if (tcph->doff * 4 == FISA_TCP_TS_HDR_LEN &&
+	    (int32_t)(qdf_ntohl(*((__be32 *)(tcph + 1) + 1)) -
+		      qdf_ntohl(*((__be32 *)(last_tcph + 1) + 1))) < 0)
+		return false;
+
+	aggr_len = fisa_flow->head_skb_l4_hdr_offset + head_tcph->doff * 4 +
+		   fisa_flow->cur_aggr_gso_size +
+		   fisa_flow->frags_cumulative_len + payload_len;
+	if (aggr_len > FISA_TCP_MAX_AGGR_IP_LEN ||
+	    fisa_flow->cur_aggr >= FISA_FLOW_MAX_AGGR_COUNT - 1)
+		return false;
+
+	return true;
+}
+
+/**
+ * dp_rx_fisa_aggr_tcp() - Aggregate incoming TCP nbuf
+ * @fisa_hdl: Handle to FISA context
  * @fisa_flow: Handle to SW flow entry, which holds the aggregated nbuf
  * @nbuf: Incoming nbuf
  *
- * Return: FISA_AGGR_DONE on successful aggregation
+ * In-order data segments of the flow are stitched to the frag_list of the
+ * head skb, with their headers stripped, the way GRO does. The aggregate
+ * is flushed when a segment carries PSH or is shorter than the head skb
+ * payload, and before any segment which cannot be appended to it, so the
+ * stack always sees the segments of the flow in order.
+ *
+ * Return: FISA_AGGR_DONE on successful aggregation,
+ *	   FISA_AGGR_NOT_ELIGIBLE if nbuf has to be delivered as is
  */
 static enum fisa_aggr_ret
-dp_rx_fisa_aggr_tcp(struct dp_fisa_rx_sw_ft *fisa_flow,	qdf_nbuf_t nbuf)
+dp_rx_fisa_aggr_tcp(struct dp_rx_fst *fisa_hdl,
+		    struct dp_fisa_rx_sw_ft *fisa_flow, qdf_nbuf_t nbuf)
 {
-	qdf_nbuf_t head_skb = fisa_flow->head_skb;
+	uint8_t *rx_tlv_hdr = qdf_nbuf_data(nbuf);
+	uint32_t l2_hdr_offset =
+		hal_rx_msdu_end_l3_hdr_padding_get(fisa_hdl->soc_hdl->hal_soc,
+						   rx_tlv_hdr);
+	uint32_t l3_hdr_offset, l4_hdr_offset;
+	uint32_t payload_len, hdr_len;
+	struct tcphdr *tcph;
 	struct iphdr *iph;
-	uint32_t tcp_data_len;
 
-	fisa_flow->bytes_aggregated += qdf_nbuf_len(nbuf);
-	if (!head_skb) {
-		/* First nbuf for the flow */
-		dp_fisa_debug("first head skb");
+	hal_rx_get_l3_l4_offsets(fisa_hdl->soc_hdl->hal_soc, rx_tlv_hdr,
+				 &l3_hdr_offset, &l4_hdr_offset);
+	qdf_nbuf_pull_head(nbuf,
+			   fisa_hdl->soc_hdl->rx_pkt_tlv_size + l2_hdr_offset);
+
+	iph = (struct iphdr *)(qdf_nbuf_data(nbuf) + l3_hdr_offset);
+	tcph = (struct tcphdr *)((uint8_t *)iph + l4_hdr_offset);
+	hdr_len = l3_hdr_offset + l4_hdr_offset + tcph->doff * 4;
+
+	payload_len = dp_rx_fisa_tcp_seg_len(nbuf, iph, l4_hdr_offset, tcph);
+	if (!payload_len) {
+		dp_rx_fisa_flush_flow_wrap(fisa_flow);
+		qdf_nbuf_push_head(nbuf, fisa_hdl->soc_hdl->rx_pkt_tlv_size +
+				   l2_hdr_offset);
+		return FISA_AGGR_NOT_ELIGIBLE;
+	}
+
+	/* drop the ethernet padding of short frames */
+	qdf_nbuf_trim_tail(nbuf, qdf_nbuf_len(nbuf) - hdr_len - payload_len);
+
+	if (fisa_flow->head_skb &&
+	    !dp_rx_fisa_tcp_seg_match(fisa_flow, iph, tcph, payload_len))
+		dp_rx_fisa_flush_flow_wrap(fisa_flow);
+
+	fisa_flow->tcp_next_seq = qdf_ntohl(tcph->seq) + payload_len;
+	fisa_flow->last_skb_tcp_hdr = tcph;
+	fisa_flow->aggr_count++;
+
+	if (!fisa_flow->head_skb) {
+		dp_fisa_debug("first head skb nbuf %pK", nbuf);
 		fisa_flow->head_skb = nbuf;
+		fisa_flow->head_skb_tcp_hdr = tcph;
+		fisa_flow->head_skb_ip_hdr_offset = l3_hdr_offset;
+		fisa_flow->head_skb_l4_hdr_offset = l4_hdr_offset;
+		fisa_flow->cur_aggr_gso_size = payload_len;
+		fisa_flow->frags_cumulative_len = 0;
+		fisa_flow->cur_aggr = 0;
+
+		if (tcph->psh)
+			dp_rx_fisa_flush_flow_wrap(fisa_flow);
+
 		return FISA_AGGR_DONE;
 	}
 
-	tcp_data_len = (ntohs(iph->tot_len) - sizeof(struct iphdr) -
-			sizeof(struct tcphdr));
-	qdf_nbuf_pull_head(nbuf, (nbuf->len - tcp_data_len));
+	qdf_nbuf_pull_head(nbuf, hdr_len);
 
-	if (qdf_nbuf_get_ext_list(head_skb)) {
-		/* this is 3rd skb after head skb, 2nd skb */
-		fisa_flow->last_skb->next = nbuf;
+	if (qdf_nbuf_get_ext_list(fisa_flow->head_skb)) {
+		qdf_nbuf_set_next(fisa_flow->last_skb, nbuf);
 	} else {
-		/* 1st skb after head skb */
-		qdf_nbuf_append_ext_list(head_skb, nbuf,
-					 fisa_flow->cumulative_ip_length);
-		qdf_nbuf_set_is_frag(head, 1);
+		skb_shinfo(fisa_flow->head_skb)->frag_list = nbuf;
+		qdf_nbuf_set_is_frag(nbuf, 1);
 	}
+	/* charge the chained segment to the socket like GRO does */
+	fisa_flow->head_skb->truesize += nbuf->truesize;
 
 	fisa_flow->last_skb = nbuf;
-	fisa_flow->aggr_count++;
+	fisa_flow->frags_cumulative_len += payload_len;
+	fisa_flow->bytes_aggregated += payload_len;
+	fisa_flow->cur_aggr++;
+
+	if (tcph->psh || payload_len < fisa_flow->cur_aggr_gso_size)
+		dp_rx_fisa_flush_flow_wrap(fisa_flow);
 
-	/* move it to while flushing the flow, that is update before flushing */
-	return FISA_AGGR_DONE;
-}
-#else
-static enum fisa_aggr_ret
-dp_rx_fisa_aggr_tcp(struct dp_rx_fst *fisa_hdl,
-		    struct dp_fisa_rx_sw_ft *fisa_flow,	qdf_nbuf_t nbuf)
-{
 	return FISA_AGGR_DONE;
 }
-#endif
 
 /**
  * get_transport_payload_offset() - Get offset to payload
@@ -1360,6 +1552,8 @@ dp_rx_fisa_aggr_udp(struct dp_rx_fst *fisa_hdl,
 		skb_shinfo(head_skb)->frag_list = nbuf;
 		qdf_nbuf_set_is_frag(nbuf, 1);
 	}
+	/* charge the chained segment to the socket like GRO does */
+	head_skb->truesize += nbuf->truesize;
 
 	fisa_flow->last_skb = nbuf;
 	fisa_flow->aggr_count++;
@@ -1444,6 +1638,7 @@ dp_rx_fisa_flush_udp_flow(struct dp_vdev *vdev,
 {
 	qdf_nbuf_t head_skb = fisa_flow->head_skb;
 	struct iphdr *head_skb_iph;
+	struct ipv6hdr *head_skb_ip6h;
 	struct udphdr *head_skb_udp_hdr;
 	struct skb_shared_info *shinfo;
 	qdf_nbuf_t linear_skb;
@@ -1485,22 +1680,34 @@ dp_rx_fisa_flush_udp_flow(struct dp_vdev *vdev,
 
 		head_skb->len += head_skb->data_len;
 
-		head_skb_iph->tot_len =
-			qdf_htons((fisa_flow->adjusted_cumulative_ip_length)
-			+ /* IP hdr len */
-			fisa_flow->head_skb_l4_hdr_offset);
-		pseudo = ~csum_tcpudp_magic(head_skb_iph->saddr,
+		if (head_skb_iph->version == 6) {
+			head_skb_ip6h = (struct ipv6hdr *)head_skb_iph;
+			/* IPv6 payload includes the extension headers */
+			head_skb_ip6h->payload_len =
+				qdf_htons(fisa_flow->adjusted_cumulative_ip_length
+					  + fisa_flow->head_skb_l4_hdr_offset -
+					  sizeof(struct ipv6hdr));
+			pseudo = ~csum_ipv6_magic(&head_skb_ip6h->saddr,
+				&head_skb_ip6h->daddr,
+				fisa_flow->adjusted_cumulative_ip_length,
+				IPPROTO_UDP, 0);
+		} else {
+			head_skb_iph->tot_len =
+				qdf_htons((fisa_flow->adjusted_cumulative_ip_length)
+				+ /* IP hdr len */
+				fisa_flow->head_skb_l4_hdr_offset);
+			pseudo = ~csum_tcpudp_magic(head_skb_iph->saddr,
 				head_skb_iph->daddr,
 				fisa_flow->adjusted_cumulative_ip_length,
 				head_skb_iph->protocol, 0);
 
-		head_skb_iph->check = 0;
-		head_skb_iph->check = ip_fast_csum((u8 *)head_skb_iph,
-						   head_skb_iph->ihl);
+			head_skb_iph->check = 0;
+			head_skb_iph->check = ip_fast_csum((u8 *)head_skb_iph,
+							   head_skb_iph->ihl);
+		}
 
 		head_skb_udp_hdr->len =
-			qdf_htons(qdf_ntohs(head_skb_iph->tot_len) -
-				  fisa_flow->head_skb_l4_hdr_offset);
+			qdf_htons(fisa_flow->adjusted_cumulative_ip_length);
 		head_skb_udp_hdr->check = pseudo;
 		head_skb->csum_start = (u8 *)head_skb_udp_hdr - head_skb->head;
 		head_skb->csum_offset = offsetof(struct udphdr, check);
@@ -1566,6 +1773,69 @@ out:
 	fisa_flow->flush_count++;
 }
 
+/**
+ * dp_rx_fisa_tcp_update_head() - Turn the head skb of a TCP aggregate into
+ *				  a GSO skb covering all its segments
+ * @fisa_flow: Flow for which aggregates to be flushed
+ *
+ * The IP and TCP headers of the head skb are updated the way GRO completes
+ * an aggregate: lengths cover the whole aggregate, the window, PSH flag and
+ * timestamps are taken from the last segment and the TCP checksum is set
+ * up for CHECKSUM_PARTIAL.
+ *
+ * Return: None
+ */
+static void dp_rx_fisa_tcp_update_head(struct dp_fisa_rx_sw_ft *fisa_flow)
+{
+	qdf_nbuf_t head_skb = fisa_flow->head_skb;
+	struct skb_shared_info *shinfo = skb_shinfo(head_skb);
+	struct tcphdr *tcph = fisa_flow->head_skb_tcp_hdr;
+	struct tcphdr *last_tcph = fisa_flow->last_skb_tcp_hdr;
+	struct ipv6hdr *ip6h;
+	struct iphdr *iph;
+	uint32_t l4_len;
+
+	head_skb->data_len = fisa_flow->frags_cumulative_len;
+	head_skb->len += head_skb->data_len;
+
+	l4_len = tcph->doff * 4 + fisa_flow->cur_aggr_gso_size +
+		 fisa_flow->frags_cumulative_len;
+
+	tcph->window = last_tcph->window;
+	tcp_flag_word(tcph) |= tcp_flag_word(last_tcph) & TCP_FLAG_PSH;
+	if (tcph->doff * 4 == FISA_TCP_TS_HDR_LEN)
+		qdf_mem_copy((__be32 *)(tcph + 1) + 1,
+			     (__be32 *)(last_tcph + 1) + 1,
+			     TCPOLEN_TSTAMP_ALIGNED - sizeof(__be32));
+
+	iph = (struct iphdr *)(qdf_nbuf_data(head_skb) +
+			       fisa_flow->head_skb_ip_hdr_offset);
+	if (iph->version == 6) {
+		ip6h = (struct ipv6hdr *)iph;
+		ip6h->payload_len = qdf_htons(l4_len);
+		tcph->check = ~csum_ipv6_magic(&ip6h->saddr, &ip6h->daddr,
+					       l4_len, IPPROTO_TCP, 0);
+		shinfo->gso_type = SKB_GSO_TCPV6;
+	} else {
+		iph->tot_len = qdf_htons(fisa_flow->head_skb_l4_hdr_offset +
+					 l4_len);
+		iph->check = 0;
+		iph->check = ip_fast_csum((u8 *)iph, iph->ihl);
+		tcph->check = ~csum_tcpudp_magic(iph->saddr, iph->daddr,
+						 l4_len, IPPROTO_TCP, 0);
+		shinfo->gso_type = SKB_GSO_TCPV4;
+	}
+
+	head_skb->csum_start = (u8 *)tcph - head_skb->head;
+	head_skb->csum_offset = offsetof(struct tcphdr, check);
+	head_skb->ip_summed = CHECKSUM_PARTIAL;
+	shinfo->gso_size = fisa_flow->cur_aggr_gso_size;
+	shinfo->gso_segs = fisa_flow->cur_aggr + 1;
+
+	/* Already aggregated, do not hand it to GRO again */
+	QDF_NBUF_CB_RX_TCP_PROTO(head_skb) = 0;
+}
+
 /**
  * dp_rx_fisa_flush_tcp_flow() - Flush all aggregated nbuf of the TCP flow
  * @vdev: handle to dp_vdev
@@ -1578,34 +1848,44 @@ dp_rx_fisa_flush_tcp_flow(struct dp_vdev *vdev,
 			  struct dp_fisa_rx_sw_ft *fisa_flow)
 {
 	qdf_nbuf_t head_skb = fisa_flow->head_skb;
-	struct iphdr *head_skb_iph;
-	struct skb_shared_info *shinfo;
+	struct dp_vdev *fisa_flow_vdev;
 
 	if (!head_skb) {
 		dp_fisa_debug("Already flushed");
 		return;
 	}
 
-	shinfo = skb_shinfo(head_skb);
-
-	/* Update the head_skb before flush */
-	head_skb->hash = fisa_flow->flow_hash;
+	head_skb->hash = QDF_NBUF_CB_RX_FLOW_ID(head_skb);
 	head_skb->sw_hash = 1;
-	shinfo->gso_type = SKB_GSO_UDP_L4;
-
-	head_skb_iph = (struct iphdr *)(qdf_nbuf_data(head_skb) +
-					fisa_flow->head_skb_ip_hdr_offset);
-
-	head_skb_iph->tot_len = fisa_flow->adjusted_cumulative_ip_length;
-	head_skb_iph->check = ip_fast_csum((u8 *)head_skb_iph,
-					   head_skb_iph->ihl);
+	if (qdf_nbuf_get_ext_list(head_skb))
+		dp_rx_fisa_tcp_update_head(fisa_flow);
 
-	qdf_nbuf_set_next(fisa_flow->head_skb, NULL);
+	qdf_nbuf_set_next(head_skb, NULL);
+	QDF_NBUF_CB_RX_NUM_ELEMENTS_IN_LIST(head_skb) = 1;
 	if (fisa_flow->last_skb)
 		qdf_nbuf_set_next(fisa_flow->last_skb, NULL);
-	vdev->osif_rx(vdev->osif_vdev, fisa_flow->head_skb);
 
+	fisa_flow_vdev = dp_vdev_get_ref_by_id(
+				fisa_flow->soc_hdl,
+				QDF_NBUF_CB_RX_VDEV_ID(head_skb),
+				DP_MOD_ID_RX);
+	if (qdf_unlikely(!fisa_flow_vdev ||
+			 (fisa_flow_vdev != fisa_flow->vdev))) {
+		qdf_nbuf_free(head_skb);
+		goto out;
+	}
+
+	if (!vdev->osif_rx || QDF_STATUS_SUCCESS !=
+	    vdev->osif_rx(vdev->osif_vdev, head_skb))
+		qdf_nbuf_free(head_skb);
+
+out:
+	if (fisa_flow_vdev)
+		dp_vdev_unref_delete(fisa_flow->soc_hdl,
+				     fisa_flow_vdev,
+				     DP_MOD_ID_RX);
 	fisa_flow->head_skb = NULL;
+	fisa_flow->last_skb = NULL;
 
 	fisa_flow->flush_count++;
 }
@@ -1695,6 +1975,7 @@ static int dp_add_nbuf_to_fisa_flow(struct dp_rx_fst *fisa_hdl,
 	uint8_t napi_id = QDF_NBUF_CB_RX_CTX_ID(nbuf);
 	uint32_t fse_metadata;
 	bool cce_match;
+	enum fisa_aggr_ret ret;
 
 	dump_tlvs(hal_soc_hdl, rx_tlv_hdr, QDF_TRACE_LEVEL_INFO_HIGH);
 	dp_fisa_debug("nbuf: %pK nbuf->next:%pK nbuf->data:%pK len %d data_len %d",
@@ -1723,6 +2004,18 @@ static int dp_add_nbuf_to_fisa_flow(struct dp_rx_fst *fisa_hdl,
 		return FISA_AGGR_NOT_ELIGIBLE;
 	}
 
+	/* TCP segments are checked for continuity from their own headers */
+	if (fisa_flow->is_flow_tcp) {
+		dp_fisa_record_pkt(fisa_flow, nbuf, rx_tlv_hdr,
+				   fisa_hdl->soc_hdl->rx_pkt_tlv_size);
+		ret = dp_rx_fisa_aggr_tcp(fisa_hdl, fisa_flow, nbuf);
+		dp_rx_fisa_release_ft_lock(fisa_hdl, napi_id);
+		if (ret == FISA_AGGR_DONE)
+			fisa_flow->last_accessed_ts = qdf_get_log_timestamp();
+
+		return ret;
+	}
+
 	hal_cumulative_ip_len = hal_rx_get_fisa_cumulative_ip_length(
 								hal_soc_hdl,
 								rx_tlv_hdr);
@@ -1829,12 +2122,7 @@ static int dp_add_nbuf_to_fisa_flow(struct dp_rx_fst *fisa_hdl,
 	dp_fisa_record_pkt(fisa_flow, nbuf, rx_tlv_hdr,
 			   fisa_hdl->soc_hdl->rx_pkt_tlv_size);
 
-	if (fisa_flow->is_flow_udp) {
-		dp_rx_fisa_aggr_udp(fisa_hdl, fisa_flow, nbuf);
-	} else if (fisa_flow->is_flow_tcp) {
-		qdf_assert(0);
-		dp_rx_fisa_aggr_tcp(fisa_hdl, fisa_flow, nbuf);
-	}
+	dp_rx_fisa_aggr_udp(fisa_hdl, fisa_flow, nbuf);
 
 	dp_rx_fisa_release_ft_lock(fisa_hdl, napi_id);
 	fisa_flow->last_accessed_ts = qdf_get_log_timestamp();
@@ -1856,9 +2144,9 @@ invalid_fisa_assist:
 static bool dp_is_nbuf_bypass_fisa(qdf_nbuf_t nbuf)
 {
 	/* RX frame from non-regular path or DHCP packet */
-	if (QDF_NBUF_CB_RX_TCP_PROTO(nbuf) ||
-	    qdf_nbuf_is_exc_frame(nbuf) ||
+	if (qdf_nbuf_is_exc_frame(nbuf) ||
 	    qdf_nbuf_is_ipv4_dhcp_pkt(nbuf) ||
+	    qdf_nbuf_is_ipv6_dhcp_pkt(nbuf) ||
 	    qdf_nbuf_is_da_mcbc(nbuf))
 		return true;
 
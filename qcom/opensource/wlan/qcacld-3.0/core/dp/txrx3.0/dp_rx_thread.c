@@ -24,6 +24,7 @@
 #include <cdp_txrx_cmn_struct.h>
 #include <cdp_txrx_peer_ops.h>
 #include <cds_sched.h>
+#include <qdf_dev.h>
 #include "dp_rx.h"
 
 /* Timeout in ms to wait for a DP rx thread */
@@ -128,8 +129,10 @@ static void dp_rx_tm_thread_dump_stats(struct dp_rx_thread *rx_thread)
 	uint8_t reo_ring_num;
 	uint32_t off = 0;
 	char nbuf_queued_string[100];
+	char nbufq_depth_string[100];
 	uint32_t total_queued = 0;
 	uint32_t temp = 0;
+	int i;
 
 	qdf_mem_zero(nbuf_queued_string, sizeof(nbuf_queued_string));
 
@@ -165,6 +168,23 @@ static void dp_rx_tm_thread_dump_stats(struct dp_rx_thread *rx_thread)
 		rx_thread->stats.dropped_invalid_os_rx_handles,
 		rx_thread->stats.dropped_others,
 		rx_thread->stats.dropped_enq_fail);
+
+	off = 0;
+	qdf_mem_zero(nbufq_depth_string, sizeof(nbufq_depth_string));
+	for (i = 0; i < DP_RX_TM_QDEPTH_HIST_MAX; i++)
+		off += qdf_scnprintf(&nbufq_depth_string[off],
+				     sizeof(nbufq_depth_string) - off,
+				     "%u ", rx_thread->stats.nbufq_depth_hist[i]);
+
+	dp_info("thread:%u - flush decisions(none:%u normal:%u low_tput:%u) qdepth hist(%s) steer(in:%u out:%u deferred:%u)",
+		rx_thread->id,
+		rx_thread->stats.flush_none,
+		rx_thread->stats.flush_normal,
+		rx_thread->stats.flush_low_tput,
+		nbufq_depth_string,
+		rx_thread->stats.steer_in,
+		rx_thread->stats.steer_out,
+		rx_thread->stats.steer_deferred);
 }
 
 QDF_STATUS dp_rx_tm_dump_stats(struct dp_rx_tm_handle *rx_tm_hdl)
@@ -256,6 +276,105 @@ QDF_STATUS dp_check_and_update_pending(struct dp_rx_tm_handle_cmn
 }
 #endif
 
+#ifdef DP_RX_TM_FLOW_STEERING
+/**
+ * dp_rx_tm_steer_done() - mark packets of a REO ring done by a rx_thread
+ * @rx_thread: rx_thread the packets were queued to
+ * @reo_ring_num: REO ring the packets were received on
+ * @num: number of packets
+ *
+ * Return: None
+ */
+static inline void dp_rx_tm_steer_done(struct dp_rx_thread *rx_thread,
+				       uint8_t reo_ring_num, uint32_t num)
+{
+	if (qdf_likely(reo_ring_num < DP_RX_TM_MAX_REO_RINGS))
+		qdf_atomic_add(num, &rx_thread->steer.done_seq[reo_ring_num]);
+}
+
+/**
+ * dp_rx_tm_steer_dequeued() - account packets dequeued by a rx_thread
+ * @rx_thread: rx_thread which dequeued the packets
+ * @reo_ring_num: REO ring the packets were received on
+ * @num: number of packets
+ *
+ * Return: None
+ */
+static inline void dp_rx_tm_steer_dequeued(struct dp_rx_thread *rx_thread,
+					   uint8_t reo_ring_num, uint32_t num)
+{
+	if (qdf_likely(reo_ring_num < DP_RX_TM_MAX_REO_RINGS))
+		rx_thread->steer.unflushed[reo_ring_num] += num;
+}
+
+/**
+ * dp_rx_tm_steer_thread_pass() - update steering state after a thread pass
+ * @rx_thread: rx_thread which processed its queue
+ * @gro_flush_code: GRO flush done at the end of the pass
+ *
+ * Packets handed to the thread NAPI may be held in its GRO lists until a
+ * normal flush, so they only count as done after one. Without GRO the
+ * stack consumes them on delivery.
+ *
+ * Return: None
+ */
+static void dp_rx_tm_steer_thread_pass(struct dp_rx_thread *rx_thread,
+				       enum dp_rx_gro_flush_code gro_flush_code)
+{
+	uint8_t reo_ring_num;
+
+	rx_thread->steer.cpu = qdf_get_cpu();
+
+	if (rx_thread->napi.poll && gro_flush_code != DP_RX_GRO_NORMAL_FLUSH)
+		return;
+
+	for (reo_ring_num = 0; reo_ring_num < DP_RX_TM_MAX_REO_RINGS;
+	     reo_ring_num++) {
+		if (!rx_thread->steer.unflushed[reo_ring_num])
+			continue;
+		dp_rx_tm_steer_done(rx_thread, reo_ring_num,
+				    rx_thread->steer.unflushed[reo_ring_num]);
+		rx_thread->steer.unflushed[reo_ring_num] = 0;
+	}
+}
+
+/**
+ * dp_rx_tm_steer_thread_init() - initialize steering state of a rx_thread
+ * @rx_thread: rx_thread
+ *
+ * Return: None
+ */
+static inline void dp_rx_tm_steer_thread_init(struct dp_rx_thread *rx_thread)
+{
+	uint8_t reo_ring_num;
+
+	for (reo_ring_num = 0; reo_ring_num < DP_RX_TM_MAX_REO_RINGS;
+	     reo_ring_num++)
+		qdf_atomic_init(&rx_thread->steer.done_seq[reo_ring_num]);
+	rx_thread->steer.cpu = -1;
+}
+#else
+static inline void dp_rx_tm_steer_done(struct dp_rx_thread *rx_thread,
+				       uint8_t reo_ring_num, uint32_t num)
+{
+}
+
+static inline void dp_rx_tm_steer_dequeued(struct dp_rx_thread *rx_thread,
+					   uint8_t reo_ring_num, uint32_t num)
+{
+}
+
+static inline void
+dp_rx_tm_steer_thread_pass(struct dp_rx_thread *rx_thread,
+			   enum dp_rx_gro_flush_code gro_flush_code)
+{
+}
+
+static inline void dp_rx_tm_steer_thread_init(struct dp_rx_thread *rx_thread)
+{
+}
+#endif /* DP_RX_TM_FLOW_STEERING */
+
 /**
  * dp_rx_tm_thread_enqueue() - enqueue nbuf list into rx_thread
  * @rx_thread - rx_thread in which the nbuf needs to be queued
@@ -306,6 +425,8 @@ static QDF_STATUS dp_rx_tm_thread_enqueue(struct dp_rx_thread *rx_thread,
 	if (unlikely(allow_dropping)) {
 		qdf_nbuf_list_free(nbuf_list);
 		rx_thread->stats.dropped_enq_fail += num_elements_in_nbuf;
+		dp_rx_tm_steer_done(rx_thread, reo_ring_num,
+				    num_elements_in_nbuf);
 		nbuf_queued = 0;
 		goto enq_done;
 	}
@@ -356,6 +477,13 @@ enq_done:
 	if (temp_qlen > rx_thread->stats.nbufq_max_len)
 		rx_thread->stats.nbufq_max_len = temp_qlen;
 
+	if (temp_qlen) {
+		temp_qlen = qdf_fls(temp_qlen) - 1;
+		if (temp_qlen >= DP_RX_TM_QDEPTH_HIST_MAX)
+			temp_qlen = DP_RX_TM_QDEPTH_HIST_MAX - 1;
+		rx_thread->stats.nbufq_depth_hist[temp_qlen]++;
+	}
+
 	dp_debug("enqueue packet thread %pK wait queue %pK qlen %u",
 		 rx_thread, wait_q_ptr,
 		 qdf_nbuf_queue_head_qlen(&rx_thread->nbuf_queue));
@@ -488,6 +616,9 @@ static int dp_rx_thread_process_nbufq(struct dp_rx_thread *rx_thread)
 	while (nbuf_list) {
 		num_list_elements =
 			QDF_NBUF_CB_RX_NUM_ELEMENTS_IN_LIST(nbuf_list);
+		dp_rx_tm_steer_dequeued(rx_thread,
+					QDF_NBUF_CB_RX_CTX_ID(nbuf_list),
+					num_list_elements);
 		/* count aggregated RX frame into stats */
 		num_list_elements += qdf_nbuf_get_gso_segs(nbuf_list);
 		rx_thread->stats.nbuf_dequeued += num_list_elements;
@@ -555,6 +686,18 @@ dp_rx_should_flush(struct dp_rx_thread *rx_thread)
 	if (qdf_atomic_test_bit(RX_VDEV_DEL_EVENT, &rx_thread->event_flag))
 		gro_flush_code = DP_RX_GRO_NORMAL_FLUSH;
 
+	switch (gro_flush_code) {
+	case DP_RX_GRO_NORMAL_FLUSH:
+		rx_thread->stats.flush_normal++;
+		break;
+	case DP_RX_GRO_LOW_TPUT_FLUSH:
+		rx_thread->stats.flush_low_tput++;
+		break;
+	default:
+		rx_thread->stats.flush_none++;
+		break;
+	}
+
 	return gro_flush_code;
 }
 
@@ -598,6 +741,7 @@ static int dp_rx_thread_sub_loop(struct dp_rx_thread *rx_thread, bool *shutdown)
 			dp_rx_thread_gro_flush(rx_thread, gro_flush_code);
 			qdf_atomic_set(&rx_thread->gro_flush_ind, 0);
 		}
+		dp_rx_tm_steer_thread_pass(rx_thread, gro_flush_code);
 
 		if (qdf_atomic_test_and_clear_bit(RX_VDEV_DEL_EVENT,
 						  &rx_thread->event_flag)) {
@@ -831,6 +975,7 @@ static QDF_STATUS dp_rx_tm_thread_init(struct dp_rx_thread *rx_thread,
 	qdf_event_create(&rx_thread->vdev_del_event);
 	qdf_atomic_init(&rx_thread->gro_flush_ind);
 	qdf_init_waitqueue_head(&rx_thread->wait_q);
+	dp_rx_tm_steer_thread_init(rx_thread);
 	qdf_scnprintf(thread_name, sizeof(thread_name), "dp_rx_thread_%u", id);
 	dp_info("%s %u", thread_name, id);
 
@@ -933,6 +1078,414 @@ QDF_STATUS dp_rx_refill_thread_deinit(struct dp_rx_refill_thread *refill_thread)
 	return QDF_STATUS_SUCCESS;
 }
 
+#ifdef DP_RX_TM_FLOW_STEERING
+/* Length of a steering window in ms */
+#define DP_RX_TM_STEER_WINDOW_MS 100
+/* Packets queued to all threads in a window below which load is ignored */
+#define DP_RX_TM_STEER_MIN_PKTS 1000
+/* Busiest to least busy thread load ratio, in percent, deemed imbalanced */
+#define DP_RX_TM_STEER_IMBALANCE_PCT 150
+/* Consecutive imbalanced windows before a flow bucket is moved */
+#define DP_RX_TM_STEER_IMBALANCE_WINDOWS 3
+/* Multiplier spreading all bits of the flow hash into the bucket index */
+#define DP_RX_TM_FLOW_HASH_MULT 0x9e3779b9
+
+/**
+ * dp_rx_tm_steer_enabled() - check if packets of a REO ring are flow steered
+ * @rx_tm_hdl: dp_rx_tm_handle containing the overall thread infrastructure
+ * @reo_ring_num: REO ring number
+ *
+ * Return: true if flow steering is used for @reo_ring_num
+ */
+static inline bool dp_rx_tm_steer_enabled(struct dp_rx_tm_handle *rx_tm_hdl,
+					  uint8_t reo_ring_num)
+{
+	return rx_tm_hdl->ring_steer && reo_ring_num < DP_RX_TM_MAX_REO_RINGS;
+}
+
+/**
+ * dp_rx_tm_steer_bucket() - get the flow bucket of a nbuf
+ * @ring_steer: steering state of the REO ring the nbuf was received on
+ * @nbuf: nbuf
+ *
+ * The REO ring of a flow is picked from the low bits of its toeplitz hash,
+ * so all bits of the hash are folded into the bucket index.
+ *
+ * Return: flow bucket
+ */
+static inline struct dp_rx_tm_flow_bucket *
+dp_rx_tm_steer_bucket(struct dp_rx_tm_ring_steer *ring_steer, qdf_nbuf_t nbuf)
+{
+	uint32_t hash = QDF_NBUF_CB_RX_FLOW_ID(nbuf) * DP_RX_TM_FLOW_HASH_MULT;
+
+	return &ring_steer->bucket[hash >> (32 - DP_RX_TM_FLOW_BUCKET_SHIFT)];
+}
+
+/**
+ * dp_rx_tm_steer_capacity() - get the compute capacity of a rx_thread
+ * @rx_thread: rx_thread
+ *
+ * Return: capacity of the CPU the thread last ran on
+ */
+static unsigned long dp_rx_tm_steer_capacity(struct dp_rx_thread *rx_thread)
+{
+	int cpu = rx_thread->steer.cpu;
+	unsigned long capacity;
+
+	if (cpu < 0)
+		return QDF_CPU_CAPACITY_SCALE;
+
+	capacity = qdf_topology_cpu_capacity(cpu);
+
+	return capacity ? capacity : QDF_CPU_CAPACITY_SCALE;
+}
+
+/**
+ * dp_rx_tm_steer_try_move() - complete a pending move of a flow bucket
+ * @rx_tm_hdl: dp_rx_tm_handle containing the overall thread infrastructure
+ * @reo_ring_num: REO ring of the bucket
+ * @bucket: flow bucket with a pending move
+ *
+ * The bucket only moves once its current rx_thread is done with all the
+ * packets of the bucket, so that packets of a flow never reach the stack
+ * out of order.
+ *
+ * Return: true if the bucket moved
+ */
+static bool dp_rx_tm_steer_try_move(struct dp_rx_tm_handle *rx_tm_hdl,
+				    uint8_t reo_ring_num,
+				    struct dp_rx_tm_flow_bucket *bucket)
+{
+	struct dp_rx_thread *rx_thread = rx_tm_hdl->rx_thread[bucket->thread_id];
+	uint32_t done;
+
+	done = qdf_atomic_read(&rx_thread->steer.done_seq[reo_ring_num]);
+	if ((int32_t)(done - bucket->last_seq) < 0)
+		return false;
+
+	rx_thread->stats.steer_out++;
+	rx_tm_hdl->rx_thread[bucket->next_thread_id]->stats.steer_in++;
+	bucket->thread_id = bucket->next_thread_id;
+
+	return true;
+}
+
+/**
+ * dp_rx_tm_steer_rebalance() - rebalance the flow buckets of a REO ring
+ * @rx_tm_hdl: dp_rx_tm_handle containing the overall thread infrastructure
+ * @reo_ring_num: REO ring number
+ *
+ * Once per steering window the packets queued to each rx_thread during the
+ * window are scaled by the capacity of the CPU the thread runs on, so a
+ * thread on a little core is deemed busier than one on a big core for the
+ * same traffic. If the busiest thread stays DP_RX_TM_STEER_IMBALANCE_PCT
+ * above the least busy one for DP_RX_TM_STEER_IMBALANCE_WINDOWS windows, the
+ * biggest bucket of the ring whose move narrows the gap is steered to the
+ * least busy thread.
+ *
+ * Return: None
+ */
+static void dp_rx_tm_steer_rebalance(struct dp_rx_tm_handle *rx_tm_hdl,
+				     uint8_t reo_ring_num)
+{
+	struct dp_rx_tm_ring_steer *ring_steer;
+	struct dp_rx_tm_flow_bucket *bucket, *move = NULL;
+	struct dp_rx_thread *rx_thread;
+	unsigned long capacity[DP_MAX_RX_THREADS];
+	uint32_t load[DP_MAX_RX_THREADS];
+	uint32_t queued, total = 0;
+	uint8_t max = 0, min = 0;
+	uint64_t now;
+	int i;
+
+	ring_steer = &rx_tm_hdl->ring_steer[reo_ring_num];
+	now = qdf_get_system_timestamp();
+	if (now - ring_steer->window_start < DP_RX_TM_STEER_WINDOW_MS)
+		return;
+
+	for (i = 0; i < rx_tm_hdl->num_dp_rx_threads; i++) {
+		rx_thread = rx_tm_hdl->rx_thread[i];
+		queued = rx_thread->stats.nbuf_queued_total -
+			 ring_steer->thread_queued[i];
+		ring_steer->thread_queued[i] =
+			rx_thread->stats.nbuf_queued_total;
+		total += queued;
+
+		capacity[i] = dp_rx_tm_steer_capacity(rx_thread);
+		load[i] = queued * QDF_CPU_CAPACITY_SCALE / capacity[i];
+		if (load[i] > load[max])
+			max = i;
+		if (load[i] < load[min])
+			min = i;
+	}
+
+	if (total < DP_RX_TM_STEER_MIN_PKTS ||
+	    load[max] * 100 <= load[min] * DP_RX_TM_STEER_IMBALANCE_PCT) {
+		ring_steer->imbalance_cnt = 0;
+		goto window_reset;
+	}
+
+	if (++ring_steer->imbalance_cnt < DP_RX_TM_STEER_IMBALANCE_WINDOWS)
+		goto window_reset;
+
+	for (i = 0; i < DP_RX_TM_FLOW_BUCKETS; i++) {
+		bucket = &ring_steer->bucket[i];
+		if (bucket->thread_id != max || !bucket->pkts ||
+		    bucket->next_thread_id != bucket->thread_id)
+			continue;
+
+		/* moving must not make the least busy thread the busiest */
+		if (load[min] + bucket->pkts * QDF_CPU_CAPACITY_SCALE /
+		    capacity[min] >= load[max] - bucket->pkts *
+		    QDF_CPU_CAPACITY_SCALE / capacity[max])
+			continue;
+
+		if (!move || bucket->pkts > move->pkts)
+			move = bucket;
+	}
+
+	if (!move)
+		goto window_reset;
+
+	dp_debug("ring %u: steering bucket %ld (%u pkts) from thread %u to %u",
+		 reo_ring_num, (long)(move - ring_steer->bucket), move->pkts,
+		 max, min);
+
+	ring_steer->imbalance_cnt = 0;
+	move->next_thread_id = min;
+	if (!dp_rx_tm_steer_try_move(rx_tm_hdl, reo_ring_num, move))
+		rx_tm_hdl->rx_thread[max]->stats.steer_deferred++;
+
+window_reset:
+	for (i = 0; i < DP_RX_TM_FLOW_BUCKETS; i++)
+		ring_steer->bucket[i].pkts = 0;
+	ring_steer->window_start = now;
+}
+
+/**
+ * dp_rx_tm_steer_enqueue() - enqueue RX packets into RXTI by flow
+ * @rx_tm_hdl: dp_rx_tm_handle containing the overall thread infrastructure
+ * @nbuf_list: single or a list of nbufs received on one REO ring
+ *
+ * The list is split by the flow bucket of each nbuf and every sub list is
+ * queued to the rx_thread its buckets are steered to. Relative order of the
+ * nbufs within a sub list is kept. Callers may race on a ring, so the ring
+ * steering state is locked until all sub lists are queued.
+ *
+ * Return: QDF_STATUS_SUCCESS
+ */
+static QDF_STATUS dp_rx_tm_steer_enqueue(struct dp_rx_tm_handle *rx_tm_hdl,
+					 qdf_nbuf_t nbuf_list)
+{
+	uint8_t reo_ring_num = QDF_NBUF_CB_RX_CTX_ID(nbuf_list);
+	qdf_nbuf_t head[DP_MAX_RX_THREADS] = { NULL };
+	qdf_nbuf_t tail[DP_MAX_RX_THREADS] = { NULL };
+	uint32_t num[DP_MAX_RX_THREADS] = { 0 };
+	struct dp_rx_tm_ring_steer *ring_steer;
+	struct dp_rx_tm_flow_bucket *bucket;
+	struct dp_rx_thread *rx_thread;
+	qdf_nbuf_t nbuf, next;
+	QDF_STATUS status;
+	uint8_t thread_id;
+
+	ring_steer = &rx_tm_hdl->ring_steer[reo_ring_num];
+	qdf_spin_lock_bh(&ring_steer->lock);
+	dp_rx_tm_steer_rebalance(rx_tm_hdl, reo_ring_num);
+
+	nbuf = nbuf_list;
+	while (nbuf) {
+		next = qdf_nbuf_next(nbuf);
+
+		bucket = dp_rx_tm_steer_bucket(ring_steer, nbuf);
+		if (qdf_unlikely(bucket->next_thread_id != bucket->thread_id))
+			dp_rx_tm_steer_try_move(rx_tm_hdl, reo_ring_num, bucket);
+
+		thread_id = bucket->thread_id;
+		num[thread_id]++;
+		bucket->pkts++;
+		bucket->last_seq = ring_steer->enq_seq[thread_id] +
+				   num[thread_id];
+		DP_RX_LIST_APPEND(head[thread_id], tail[thread_id], nbuf);
+
+		nbuf = next;
+	}
+
+	for (thread_id = 0; thread_id < rx_tm_hdl->num_dp_rx_threads;
+	     thread_id++) {
+		if (!head[thread_id])
+			continue;
+
+		rx_thread = rx_tm_hdl->rx_thread[thread_id];
+		ring_steer->enq_seq[thread_id] += num[thread_id];
+		qdf_atomic_set_bit(thread_id, &ring_steer->flush_pending);
+		status = dp_rx_tm_thread_enqueue(rx_thread, head[thread_id]);
+		/*
+		 * The buckets already wait for these sequence numbers, so
+		 * packets which were not queued are marked done instead.
+		 */
+		if (QDF_IS_STATUS_ERROR(status))
+			dp_rx_tm_steer_done(rx_thread, reo_ring_num,
+					    num[thread_id]);
+	}
+	qdf_spin_unlock_bh(&ring_steer->lock);
+
+	return QDF_STATUS_SUCCESS;
+}
+
+/**
+ * dp_rx_tm_steer_gro_flush_ind() - flush GRO packets of a REO ring
+ * @rx_tm_hdl: dp_rx_tm_handle containing the overall thread infrastructure
+ * @reo_ring_num: REO ring number
+ * @flush_code: flush code to differentiate low TPUT flush
+ *
+ * The indication goes to every rx_thread which got packets of the ring
+ * since the last normal flush indication. A low TPUT flush leaves packets
+ * in the GRO lists, so the threads stay pending for the next one.
+ *
+ * Return: QDF_STATUS_SUCCESS
+ */
+static QDF_STATUS
+dp_rx_tm_steer_gro_flush_ind(struct dp_rx_tm_handle *rx_tm_hdl,
+			     uint8_t reo_ring_num,
+			     enum dp_rx_gro_flush_code flush_code)
+{
+	unsigned long *flush_pending =
+			&rx_tm_hdl->ring_steer[reo_ring_num].flush_pending;
+	int i;
+
+	for (i = 0; i < rx_tm_hdl->num_dp_rx_threads; i++) {
+		if (flush_code == DP_RX_GRO_NORMAL_FLUSH) {
+			if (!qdf_atomic_test_and_clear_bit(i, flush_pending))
+				continue;
+		} else if (!qdf_atomic_test_bit(i, flush_pending)) {
+			continue;
+		}
+
+		dp_rx_tm_thread_gro_flush_ind(rx_tm_hdl->rx_thread[i],
+					      flush_code);
+	}
+
+	return QDF_STATUS_SUCCESS;
+}
+
+/**
+ * dp_rx_tm_steer_current_thread() - get the rx_thread running the caller
+ * @rx_tm_hdl: dp_rx_tm_handle containing the overall thread infrastructure
+ *
+ * Return: rx_thread of the current task, NULL if not called from one
+ */
+static struct dp_rx_thread *
+dp_rx_tm_steer_current_thread(struct dp_rx_tm_handle *rx_tm_hdl)
+{
+	qdf_thread_t *task = qdf_get_current_task();
+	int i;
+
+	for (i = 0; i < rx_tm_hdl->num_dp_rx_threads; i++) {
+		if (rx_tm_hdl->rx_thread[i]->task == task)
+			return rx_tm_hdl->rx_thread[i];
+	}
+
+	return NULL;
+}
+
+/**
+ * dp_rx_tm_steer_init() - initialize flow steering of the RX threads
+ * @rx_tm_hdl: dp_rx_tm_handle containing the overall thread infrastructure
+ *
+ * Flow buckets of each REO ring are spread over the rx_threads, starting
+ * from the thread the ring would have been mapped to without steering.
+ * Threads keep being selected by REO ring if steering can not be set up.
+ *
+ * Return: None
+ */
+static void dp_rx_tm_steer_init(struct dp_rx_tm_handle *rx_tm_hdl)
+{
+	struct dp_rx_tm_ring_steer *ring_steer;
+	uint8_t reo_ring_num;
+	int i;
+
+	if (rx_tm_hdl->num_dp_rx_threads < 2)
+		return;
+
+	rx_tm_hdl->ring_steer = qdf_mem_malloc(DP_RX_TM_MAX_REO_RINGS *
+					       sizeof(*rx_tm_hdl->ring_steer));
+	if (!rx_tm_hdl->ring_steer) {
+		dp_err("flow steering disabled, no memory");
+		return;
+	}
+
+	for (reo_ring_num = 0; reo_ring_num < DP_RX_TM_MAX_REO_RINGS;
+	     reo_ring_num++) {
+		ring_steer = &rx_tm_hdl->ring_steer[reo_ring_num];
+		qdf_spinlock_create(&ring_steer->lock);
+		for (i = 0; i < DP_RX_TM_FLOW_BUCKETS; i++) {
+			ring_steer->bucket[i].thread_id =
+				(reo_ring_num + i) % rx_tm_hdl->num_dp_rx_threads;
+			ring_steer->bucket[i].next_thread_id =
+				ring_steer->bucket[i].thread_id;
+		}
+		ring_steer->window_start = qdf_get_system_timestamp();
+	}
+
+	dp_info("flow steering over %u threads", rx_tm_hdl->num_dp_rx_threads);
+}
+
+/**
+ * dp_rx_tm_steer_deinit() - de-initialize flow steering of the RX threads
+ * @rx_tm_hdl: dp_rx_tm_handle containing the overall thread infrastructure
+ *
+ * Return: None
+ */
+static void dp_rx_tm_steer_deinit(struct dp_rx_tm_handle *rx_tm_hdl)
+{
+	uint8_t reo_ring_num;
+
+	if (!rx_tm_hdl->ring_steer)
+		return;
+
+	for (reo_ring_num = 0; reo_ring_num < DP_RX_TM_MAX_REO_RINGS;
+	     reo_ring_num++)
+		qdf_spinlock_destroy(&rx_tm_hdl->ring_steer[reo_ring_num].lock);
+
+	qdf_mem_free(rx_tm_hdl->ring_steer);
+	rx_tm_hdl->ring_steer = NULL;
+}
+#else
+static inline bool dp_rx_tm_steer_enabled(struct dp_rx_tm_handle *rx_tm_hdl,
+					  uint8_t reo_ring_num)
+{
+	return false;
+}
+
+static inline QDF_STATUS
+dp_rx_tm_steer_enqueue(struct dp_rx_tm_handle *rx_tm_hdl, qdf_nbuf_t nbuf_list)
+{
+	return QDF_STATUS_E_NOSUPPORT;
+}
+
+static inline QDF_STATUS
+dp_rx_tm_steer_gro_flush_ind(struct dp_rx_tm_handle *rx_tm_hdl,
+			     uint8_t reo_ring_num,
+			     enum dp_rx_gro_flush_code flush_code)
+{
+	return QDF_STATUS_E_NOSUPPORT;
+}
+
+static inline struct dp_rx_thread *
+dp_rx_tm_steer_current_thread(struct dp_rx_tm_handle *rx_tm_hdl)
+{
+	return NULL;
+}
+
+static inline void dp_rx_tm_steer_init(struct dp_rx_tm_handle *rx_tm_hdl)
+{
+}
+
+static inline void dp_rx_tm_steer_deinit(struct dp_rx_tm_handle *rx_tm_hdl)
+{
+}
+#endif /* DP_RX_TM_FLOW_STEERING */
+
 QDF_STATUS dp_rx_tm_init(struct dp_rx_tm_handle *rx_tm_hdl,
 			 uint8_t num_dp_rx_threads)
 {
@@ -976,10 +1529,12 @@ QDF_STATUS dp_rx_tm_init(struct dp_rx_tm_handle *rx_tm_hdl,
 			break;
 	}
 ret:
-	if (!QDF_IS_STATUS_SUCCESS(qdf_status))
+	if (!QDF_IS_STATUS_SUCCESS(qdf_status)) {
 		dp_rx_tm_deinit(rx_tm_hdl);
-	else
+	} else {
+		dp_rx_tm_steer_init(rx_tm_hdl);
 		rx_tm_hdl->state = DP_RX_THREADS_RUNNING;
+	}
 
 	return qdf_status;
 }
@@ -1131,6 +1686,9 @@ QDF_STATUS dp_rx_thread_flush_by_vdev_id(struct dp_rx_thread *rx_thread,
 		num_list_elements =
 			QDF_NBUF_CB_RX_NUM_ELEMENTS_IN_LIST(nbuf_list_head);
 		rx_thread->stats.rx_flushed += num_list_elements;
+		dp_rx_tm_steer_done(rx_thread,
+				    QDF_NBUF_CB_RX_CTX_ID(nbuf_list_head),
+				    num_list_elements);
 		qdf_nbuf_list_free(nbuf_list_head);
 		nbuf_list_head = nbuf_list_next;
 	}
@@ -1343,6 +1901,8 @@ QDF_STATUS dp_rx_tm_deinit(struct dp_rx_tm_handle *rx_tm_hdl)
 	qdf_mem_free(rx_tm_hdl->rx_thread);
 	rx_tm_hdl->rx_thread = NULL;
 
+	dp_rx_tm_steer_deinit(rx_tm_hdl);
+
 	return QDF_STATUS_SUCCESS;
 }
 
@@ -1376,6 +1936,10 @@ QDF_STATUS dp_rx_tm_enqueue_pkt(struct dp_rx_tm_handle *rx_tm_hdl,
 {
 	uint8_t selected_thread_id;
 
+	if (dp_rx_tm_steer_enabled(rx_tm_hdl,
+				   QDF_NBUF_CB_RX_CTX_ID(nbuf_list)))
+		return dp_rx_tm_steer_enqueue(rx_tm_hdl, nbuf_list);
+
 	selected_thread_id =
 		dp_rx_tm_select_thread(rx_tm_hdl,
 				       QDF_NBUF_CB_RX_CTX_ID(nbuf_list));
@@ -1390,6 +1954,10 @@ dp_rx_tm_gro_flush_ind(struct dp_rx_tm_handle *rx_tm_hdl, int rx_ctx_id,
 {
 	uint8_t selected_thread_id;
 
+	if (dp_rx_tm_steer_enabled(rx_tm_hdl, rx_ctx_id))
+		return dp_rx_tm_steer_gro_flush_ind(rx_tm_hdl, rx_ctx_id,
+						    flush_code);
+
 	selected_thread_id = dp_rx_tm_select_thread(rx_tm_hdl, rx_ctx_id);
 	dp_rx_tm_thread_gro_flush_ind(rx_tm_hdl->rx_thread[selected_thread_id],
 				      flush_code);
@@ -1400,8 +1968,16 @@ dp_rx_tm_gro_flush_ind(struct dp_rx_tm_handle *rx_tm_hdl, int rx_ctx_id,
 struct napi_struct *dp_rx_tm_get_napi_context(struct dp_rx_tm_handle *rx_tm_hdl,
 					      uint8_t rx_ctx_id)
 {
+	struct dp_rx_thread *rx_thread;
 	uint8_t selected_thread_id;
 
+	/* flows of a ring are spread over the threads, use the caller's NAPI */
+	if (dp_rx_tm_steer_enabled(rx_tm_hdl, rx_ctx_id)) {
+		rx_thread = dp_rx_tm_steer_current_thread(rx_tm_hdl);
+		if (rx_thread)
+			return &rx_thread->napi;
+	}
+
 	selected_thread_id = dp_rx_tm_select_thread(rx_tm_hdl, rx_ctx_id);
 
 	return &rx_tm_hdl->rx_thread[selected_thread_id]->napi;
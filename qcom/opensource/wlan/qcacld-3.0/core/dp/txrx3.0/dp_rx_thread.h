@@ -30,6 +30,8 @@
 #define DP_RX_TM_MAX_REO_RINGS WLAN_CFG_NUM_REO_DEST_RING
 /* Number of DP RX threads supported */
 #define DP_MAX_RX_THREADS WLAN_CFG_NUM_REO_DEST_RING
+/* Number of queue depth buckets: 1, 2-3, 4-7 ... 128 and above */
+#define DP_RX_TM_QDEPTH_HIST_MAX 8
 
 /*
  * struct dp_rx_tm_handle_cmn - Opaque handle for rx_threads to store
@@ -55,6 +57,14 @@ struct dp_rx_tm_handle_cmn;
  * @dropped_others: packets dropped due to other reasons
  * @dropped_enq_fail: packets dropped due to pending queue full
  * @rx_nbufq_loop_yield: rx loop yield counter
+ * @flush_none: dp_rx_should_flush() decisions not to flush
+ * @flush_normal: dp_rx_should_flush() decisions for a normal flush
+ * @flush_low_tput: dp_rx_should_flush() decisions for a low TPUT flush
+ * @nbufq_depth_hist: queue depth seen on enqueue, log2 buckets
+ * @steer_in: flow buckets steered to the thread
+ * @steer_out: flow buckets steered away from the thread
+ * @steer_deferred: bucket moves away from the thread held back because
+ *		    packets of the bucket were still in flight
  */
 struct dp_rx_thread_stats {
 	unsigned int nbuf_queued[DP_RX_TM_MAX_REO_RINGS];
@@ -71,8 +81,78 @@ struct dp_rx_thread_stats {
 	unsigned int dropped_others;
 	unsigned int dropped_enq_fail;
 	unsigned int rx_nbufq_loop_yield;
+	unsigned int flush_none;
+	unsigned int flush_normal;
+	unsigned int flush_low_tput;
+	unsigned int nbufq_depth_hist[DP_RX_TM_QDEPTH_HIST_MAX];
+	unsigned int steer_in;
+	unsigned int steer_out;
+	unsigned int steer_deferred;
 };
 
+#ifdef DP_RX_TM_FLOW_STEERING
+/* Flow buckets steered independently on each REO ring */
+#define DP_RX_TM_FLOW_BUCKET_SHIFT 6
+#define DP_RX_TM_FLOW_BUCKETS (1 << DP_RX_TM_FLOW_BUCKET_SHIFT)
+
+/**
+ * struct dp_rx_tm_flow_bucket - steering state of a flow bucket
+ * @thread_id: rx_thread the flows of the bucket are queued to
+ * @next_thread_id: rx_thread the bucket moves to once @thread_id is done
+ *		    with its packets, same as @thread_id if no move is pending
+ * @pkts: packets of the bucket queued in the current steering window
+ * @last_seq: value of the ring enq_seq for @thread_id after the last
+ *	      packet of the bucket was queued
+ */
+struct dp_rx_tm_flow_bucket {
+	uint8_t thread_id;
+	uint8_t next_thread_id;
+	uint32_t pkts;
+	uint32_t last_seq;
+};
+
+/**
+ * struct dp_rx_tm_ring_steer - flow steering state of a REO ring
+ * @lock: serializes steering and queueing of the packets of the ring
+ * @bucket: flow buckets of the ring, indexed by the high bits of the
+ *	    multiplicative hash of the flow hash
+ * @enq_seq: packets the ring queued to each rx_thread
+ * @thread_queued: nbuf_queued_total of each rx_thread at window start
+ * @window_start: start of the current steering window in ms
+ * @imbalance_cnt: consecutive windows the rx_thread load was imbalanced
+ * @flush_pending: rx_threads which got packets of the ring since the last
+ *		   normal GRO flush indication
+ *
+ * Packets of a ring are not only queued from the NAPI context of the ring:
+ * the REO error and exception paths deliver from other contexts, with
+ * nbufs tagged for ring 0. All but @flush_pending is therefore accessed
+ * under @lock, which is also held while the packets are queued to the
+ * threads so that @enq_seq matches the order they reach each thread in.
+ */
+struct dp_rx_tm_ring_steer {
+	qdf_spinlock_t lock;
+	struct dp_rx_tm_flow_bucket bucket[DP_RX_TM_FLOW_BUCKETS];
+	uint32_t enq_seq[DP_MAX_RX_THREADS];
+	uint32_t thread_queued[DP_MAX_RX_THREADS];
+	uint64_t window_start;
+	uint8_t imbalance_cnt;
+	unsigned long flush_pending;
+};
+
+/**
+ * struct dp_rx_thread_steer - flow steering state of a DP RX thread
+ * @done_seq: per REO ring, packets the thread is done with. A packet is
+ *	      done once it is delivered and GRO flushed, or dropped.
+ * @unflushed: per REO ring, packets delivered since the last GRO flush
+ * @cpu: CPU the thread last ran on, -1 before it first ran
+ */
+struct dp_rx_thread_steer {
+	qdf_atomic_t done_seq[DP_RX_TM_MAX_REO_RINGS];
+	uint32_t unflushed[DP_RX_TM_MAX_REO_RINGS];
+	int cpu;
+};
+#endif
+
 /**
  * enum dp_rx_refill_thread_state - enum to keep track of rx refill thread state
  * @DP_RX_REFILL_THREAD_INVALID: initial invalid state
@@ -107,6 +187,7 @@ enum dp_rx_refill_thread_state {
  *		    structures via APIs.
  * @napi: napi to deliver packet to stack via GRO
  * @netdev: dummy netdev to initialize the napi structure with
+ * @steer: flow steering state
  */
 struct dp_rx_thread {
 	uint8_t id;
@@ -125,6 +206,9 @@ struct dp_rx_thread {
 	struct napi_struct napi;
 	qdf_wait_queue_head_t wait_q;
 	struct net_device netdev;
+#ifdef DP_RX_TM_FLOW_STEERING
+	struct dp_rx_thread_steer steer;
+#endif
 };
 
 /**
@@ -175,6 +259,8 @@ enum dp_rx_thread_state {
  * @state: state of the rx_threads. All of them should be in the same state.
  * @rx_thread: array of pointers of type struct dp_rx_thread
  * @allow_dropping: flag to indicate frame dropping is enabled
+ * @ring_steer: per REO ring flow steering state, NULL if RX threads are
+ *		selected by REO ring
  */
 struct dp_rx_tm_handle {
 	uint8_t num_dp_rx_threads;
@@ -182,6 +268,9 @@ struct dp_rx_tm_handle {
 	enum dp_rx_thread_state state;
 	struct dp_rx_thread **rx_thread;
 	qdf_atomic_t allow_dropping;
+#ifdef DP_RX_TM_FLOW_STEERING
+	struct dp_rx_tm_ring_steer *ring_steer;
+#endif
 };
 
 /**
@@ -65,6 +65,60 @@ static bool dp_swlm_is_tput_thresh_reached(struct dp_soc *soc, uint8_t rid)
 	return result;
 }
 
+/**
+ * dp_swlm_tcl_flow_classify() - Account the current packet to its flow and
+ *				 get the class of the flow.
+ * @soc: Datapath global soc handle
+ * @tcl_data: priv data for tcl coalescing
+ * @curr_time: current timestamp in us
+ *
+ * Flows are tracked in a small table per TCL ring, indexed by the flow
+ * hash of the packet, where a new flow evicts the one it collides with.
+ * At the end of each window, a flow sending only a few small packets is
+ * classified as interactive and a flow sending many large packets as bulk.
+ *
+ * Returns: class of the flow, enum dp_swlm_flow_class
+ */
+static uint8_t dp_swlm_tcl_flow_classify(struct dp_soc *soc,
+					 struct dp_swlm_tcl_data *tcl_data,
+					 u64 curr_time)
+{
+	struct dp_swlm_params *params = &soc->swlm.params;
+	struct dp_swlm_flow *flow;
+	uint32_t hash, avg_len;
+
+	hash = qdf_nbuf_get_hash(tcl_data->nbuf);
+	flow = &params->tcl[tcl_data->ring_id].flows[hash &
+						(DP_SWLM_FLOW_TABLE_SIZE - 1)];
+
+	if (flow->hash != hash || !flow->window_end) {
+		flow->hash = hash;
+		flow->flow_class = DP_SWLM_FLOW_UNKNOWN;
+		flow->pkts = 0;
+		flow->bytes = 0;
+		flow->window_end = curr_time + params->flow_window;
+	} else if (curr_time >= flow->window_end) {
+		avg_len = flow->bytes / flow->pkts;
+		if (flow->pkts <= params->interactive_pkt_thresh &&
+		    avg_len <= params->interactive_pkt_len)
+			flow->flow_class = DP_SWLM_FLOW_INTERACTIVE;
+		else if (flow->bytes >= params->bulk_bytes_thresh &&
+			 avg_len >= params->bulk_pkt_len)
+			flow->flow_class = DP_SWLM_FLOW_BULK;
+		else
+			flow->flow_class = DP_SWLM_FLOW_UNKNOWN;
+
+		flow->pkts = 0;
+		flow->bytes = 0;
+		flow->window_end = curr_time + params->flow_window;
+	}
+
+	flow->pkts++;
+	flow->bytes += tcl_data->pkt_len;
+
+	return flow->flow_class;
+}
+
 /**
  * dp_swlm_can_tcl_wr_coalesce() - To check if current TCL reg write can be
  *				   coalesced or not.
@@ -76,6 +130,9 @@ static bool dp_swlm_is_tput_thresh_reached(struct dp_soc *soc, uint8_t rid)
  * to be transmitted, is to be processed or coalesced.
  * It maintains a session for which the TCL register writes are coalesced and
  * then flushed if a certain time/bytes threshold is reached.
+ * Packets of interactive flows are never coalesced, while packets of bulk
+ * flows are coalesced after a shorter throughput test and up to a larger
+ * bytes threshold.
  *
  * Returns: 1 if the current TCL write is to be coalesced
  *	    0, if the current TCL write is to be processed.
@@ -89,6 +146,9 @@ dp_swlm_can_tcl_wr_coalesce(struct dp_soc *soc,
 	struct dp_swlm *swlm = &soc->swlm;
 	uint8_t rid = tcl_data->ring_id;
 	struct dp_swlm_params *params = &soc->swlm.params;
+	uint32_t tput_pass_thresh = DP_SWLM_TCL_TPUT_PASS_THRESH;
+	uint32_t bytes_flush_thresh = params->tcl[rid].bytes_flush_thresh;
+	uint8_t flow_class;
 
 	if (curr_time >= params->tcl[rid].expire_time) {
 		params->tcl[rid].expire_time = qdf_get_log_timestamp_usecs() +
@@ -103,12 +163,21 @@ dp_swlm_can_tcl_wr_coalesce(struct dp_soc *soc,
 		}
 	}
 
+	flow_class = dp_swlm_tcl_flow_classify(soc, tcl_data, curr_time);
+	if (flow_class == DP_SWLM_FLOW_INTERACTIVE) {
+		DP_STATS_INC(swlm, tcl[rid].interactive_flow, 1);
+		goto coalescing_fail;
+	} else if (flow_class == DP_SWLM_FLOW_BULK) {
+		DP_STATS_INC(swlm, tcl[rid].bulk_flow, 1);
+		tput_pass_thresh = DP_SWLM_TCL_BULK_TPUT_PASS_THRESH;
+		bytes_flush_thresh *= params->bulk_thresh_multiplier;
+	}
+
 	params->tcl[rid].bytes_coalesced += tcl_data->pkt_len;
 
-	if (params->tcl[rid].tput_pass_cnt > DP_SWLM_TCL_TPUT_PASS_THRESH) {
+	if (params->tcl[rid].tput_pass_cnt > tput_pass_thresh) {
 		coalesce = 1;
-		if (params->tcl[rid].bytes_coalesced >
-		    params->tcl[rid].bytes_flush_thresh) {
+		if (params->tcl[rid].bytes_coalesced > bytes_flush_thresh) {
 			coalesce = 0;
 			DP_STATS_INC(swlm, tcl[rid].bytes_thresh_reached, 1);
 		} else if (curr_time > params->tcl[rid].coalesce_end_time) {
@@ -123,11 +192,88 @@ coalescing_fail:
 		return 0;
 	}
 
+	params->tcl[rid].depth++;
 	qdf_timer_mod(&params->tcl[rid].flush_timer, 1);
 
 	return 1;
 }
 
+/**
+ * dp_swlm_can_reo_wr_coalesce() - To check if current REO destination ring
+ *				   TP write can be coalesced or not.
+ * @soc: Datapath global soc handle
+ * @reo_data: priv data for reo coalescing
+ *
+ * While the rx throughput stays above the pre-set threshold, the TP write
+ * at the end of a reap is skipped until a number of entries have been
+ * reaped. No flush timer is needed: as long as the HW sees entries pending
+ * on the ring it raises the ring interrupt again, and a reap which finds no
+ * new entries always writes the TP.
+ *
+ * Returns: 1 if the current REO TP write is to be coalesced
+ *	    0, if the current REO TP write is to be processed.
+ */
+static int
+dp_swlm_can_reo_wr_coalesce(struct dp_soc *soc,
+			    struct dp_swlm_reo_data *reo_data)
+{
+	u64 curr_time = qdf_get_log_timestamp_usecs();
+	struct dp_swlm *swlm = &soc->swlm;
+	uint8_t rid = reo_data->ring_id;
+	struct dp_swlm_params *params = &soc->swlm.params;
+	struct dp_swlm_reo_params *reo = &params->reo[rid];
+	int rx_delta;
+
+	if (!reo_data->num_reaped)
+		goto coalescing_fail;
+
+	if (curr_time >= reo->expire_time) {
+		reo->expire_time = curr_time + params->sampling_time;
+		rx_delta = soc->stats.rx.ingress.bytes - reo->prev_rx_bytes;
+		reo->prev_rx_bytes = soc->stats.rx.ingress.bytes;
+		if (rx_delta > params->reo_rx_traffic_thresh) {
+			reo->tput_pass_cnt++;
+		} else {
+			reo->tput_pass_cnt = 0;
+			DP_STATS_INC(swlm, reo[rid].tput_criteria_fail, 1);
+			goto coalescing_fail;
+		}
+	}
+
+	if (reo->tput_pass_cnt <= DP_SWLM_REO_TPUT_PASS_THRESH)
+		goto coalescing_fail;
+
+	reo->entries_coalesced += reo_data->num_reaped;
+	if (reo->entries_coalesced > params->reo_entries_flush_thresh) {
+		DP_STATS_INC(swlm, reo[rid].entries_thresh_reached, 1);
+		goto coalescing_fail;
+	}
+
+	reo->depth++;
+
+	return 1;
+
+coalescing_fail:
+	dp_swlm_depth_hist_update(swlm->stats.reo[rid].depth_hist, reo->depth);
+	reo->depth = 0;
+	reo->entries_coalesced = 0;
+
+	return 0;
+}
+
+/**
+ * dp_print_swlm_depth_hist() - Print a coalescing depth histogram
+ * @hist: histogram of DP_SWLM_DEPTH_HIST_MAX buckets
+ *
+ * Returns: none
+ */
+static void dp_print_swlm_depth_hist(uint32_t *hist)
+{
+	dp_info("Coalesce depth: 0: %u 1: %u 2-3: %u 4-7: %u 8-15: %u 16-31: %u 32-63: %u 64+: %u",
+		hist[0], hist[1], hist[2], hist[3], hist[4], hist[5],
+		hist[6], hist[7]);
+}
+
 QDF_STATUS dp_print_swlm_stats(struct dp_soc *soc)
 {
 	struct dp_swlm *swlm = &soc->swlm;
@@ -155,6 +301,24 @@ QDF_STATUS dp_print_swlm_stats(struct dp_soc *soc)
 			swlm->stats.tcl[i].time_thresh_reached);
 		dp_info("Coalesce fail (TPUT sampling fail): %d",
 			swlm->stats.tcl[i].tput_criteria_fail);
+		dp_info("Coalesce fail (interactive flow): %d",
+			swlm->stats.tcl[i].interactive_flow);
+		dp_info("Bulk flow pkts: %d",
+			swlm->stats.tcl[i].bulk_flow);
+		dp_print_swlm_depth_hist(swlm->stats.tcl[i].depth_hist);
+	}
+
+	for (i = 0; i < soc->num_reo_dest_rings; i++) {
+		dp_info("REO: %u Coalescing stats:", i);
+		dp_info("Num coalesce success: %d",
+			swlm->stats.reo[i].coalesce_success);
+		dp_info("Num coalesce fail: %d",
+			swlm->stats.reo[i].coalesce_fail);
+		dp_info("Coalesce fail (entries thresh crossed): %d",
+			swlm->stats.reo[i].entries_thresh_reached);
+		dp_info("Coalesce fail (TPUT sampling fail): %d",
+			swlm->stats.reo[i].tput_criteria_fail);
+		dp_print_swlm_depth_hist(swlm->stats.reo[i].depth_hist);
 	}
 
 	return QDF_STATUS_SUCCESS;
@@ -162,6 +326,7 @@ QDF_STATUS dp_print_swlm_stats(struct dp_soc *soc)
 
 static struct dp_swlm_ops dp_latency_mgr_ops = {
 	.tcl_wr_coalesce_check = dp_swlm_can_tcl_wr_coalesce,
+	.reo_wr_coalesce_check = dp_swlm_can_reo_wr_coalesce,
 };
 
 /**
@@ -190,6 +355,9 @@ static void dp_swlm_tcl_flush_timer(void *arg)
 	}
 
 	DP_STATS_INC(swlm, tcl[tcl->ring_id].timer_flush_success, 1);
+	dp_swlm_depth_hist_update(swlm->stats.tcl[tcl->ring_id].depth_hist,
+				  tcl->depth);
+	tcl->depth = 0;
 	hal_srng_access_end(soc->hal_soc, hal_ring_hdl);
 	hif_pm_runtime_put(soc->hif_handle, RTPM_ID_DW_TX_HW_ENQUEUE);
 
@@ -219,6 +387,17 @@ static inline QDF_STATUS dp_soc_swlm_tcl_attach(struct dp_soc *soc)
 	swlm->params.time_flush_thresh = DP_SWLM_TCL_TIME_FLUSH_THRESH;
 	swlm->params.tx_thresh_multiplier = DP_SWLM_TCL_TX_THRESH_MULTIPLIER;
 	swlm->params.tx_pkt_thresh = DP_SWLM_TCL_TX_PKT_THRESH;
+	swlm->params.flow_window = DP_SWLM_FLOW_WINDOW;
+	swlm->params.interactive_pkt_len = DP_SWLM_FLOW_INTERACTIVE_PKT_LEN;
+	swlm->params.interactive_pkt_thresh =
+				DP_SWLM_FLOW_INTERACTIVE_PKT_THRESH;
+	swlm->params.bulk_pkt_len = DP_SWLM_FLOW_BULK_PKT_LEN;
+	swlm->params.bulk_bytes_thresh = DP_SWLM_FLOW_BULK_BYTES_THRESH;
+	swlm->params.bulk_thresh_multiplier =
+				DP_SWLM_TCL_BULK_THRESH_MULTIPLIER;
+	swlm->params.reo_rx_traffic_thresh = DP_SWLM_REO_RX_TRAFFIC_THRESH;
+	swlm->params.reo_entries_flush_thresh =
+				DP_SWLM_REO_ENTRIES_FLUSH_THRESH;
 
 	for (i = 0; i < soc->num_tcl_data_rings; i++) {
 		swlm->params.tcl[i].soc = soc;
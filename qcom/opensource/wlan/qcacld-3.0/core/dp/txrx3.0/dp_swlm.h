@@ -31,8 +31,39 @@
 #define DP_SWLM_TCL_TIME_FLUSH_THRESH 1000
 #define DP_SWLM_TCL_TX_THRESH_MULTIPLIER 2
 
+/* Flow classification, window is in us and lengths/bytes per window */
+#define DP_SWLM_FLOW_WINDOW 1000
+#define DP_SWLM_FLOW_INTERACTIVE_PKT_LEN 256
+#define DP_SWLM_FLOW_INTERACTIVE_PKT_THRESH 8
+#define DP_SWLM_FLOW_BULK_PKT_LEN 1000
+#define DP_SWLM_FLOW_BULK_BYTES_THRESH 16384
+#define DP_SWLM_TCL_BULK_TPUT_PASS_THRESH 1
+#define DP_SWLM_TCL_BULK_THRESH_MULTIPLIER 2
+
+#define DP_SWLM_REO_TPUT_PASS_THRESH 3
+#define DP_SWLM_REO_RX_TRAFFIC_THRESH 50
+#define DP_SWLM_REO_ENTRIES_FLUSH_THRESH 64
+
 /* Inline Functions */
 
+/**
+ * dp_swlm_depth_hist_update() - Account a ring pointer write in a
+ *				 coalescing depth histogram
+ * @hist: histogram of DP_SWLM_DEPTH_HIST_MAX buckets
+ * @depth: Num writes coalesced into the current one
+ *
+ * Returns: none
+ */
+static inline void dp_swlm_depth_hist_update(uint32_t *hist, uint32_t depth)
+{
+	int idx = qdf_fls(depth);
+
+	if (idx >= DP_SWLM_DEPTH_HIST_MAX)
+		idx = DP_SWLM_DEPTH_HIST_MAX - 1;
+
+	hist[idx]++;
+}
+
 /**
  * dp_tx_is_special_frame() - check if this TX frame is a special frame.
  * @nbuf: TX skb pointer
@@ -71,6 +102,9 @@ dp_swlm_tcl_reset_session_data(struct dp_soc *soc, uint8_t ring_id)
 {
 	struct dp_swlm_params *params = &soc->swlm.params;
 
+	dp_swlm_depth_hist_update(soc->swlm.stats.tcl[ring_id].depth_hist,
+				  params->tcl[ring_id].depth);
+	params->tcl[ring_id].depth = 0;
 	params->tcl[ring_id].coalesce_end_time = qdf_get_log_timestamp_usecs() +
 		params->time_flush_thresh;
 	params->tcl[ring_id].bytes_coalesced = 0;
@@ -137,6 +171,9 @@ static inline int dp_swlm_query_policy(struct dp_soc *soc, int ring_type,
 	case TCL_DATA:
 		return swlm->ops->tcl_wr_coalesce_check(soc,
 							query_data.tcl_data);
+	case REO_DST:
+		return swlm->ops->reo_wr_coalesce_check(soc,
+							query_data.reo_data);
 	default:
 		dp_err("Ring type %d not supported by SW latency manager",
 		       ring_type);
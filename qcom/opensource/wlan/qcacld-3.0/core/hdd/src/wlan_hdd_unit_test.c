@@ -23,10 +23,13 @@
  * debugfs unit_test_host
  */
 #include "wlan_hdd_main.h"
+#include "qdf_bench_test.h"
 #include "qdf_delayed_work_test.h"
 #include "qdf_hashtable_test.h"
+#include "qdf_mempool_test.h"
 #include "qdf_periodic_work_test.h"
 #include "qdf_ptr_hash_test.h"
+#include "qdf_rcu_test.h"
 #include "qdf_slist_test.h"
 #include "qdf_talloc_test.h"
 #include "qdf_str.h"
@@ -45,11 +48,14 @@ struct hdd_ut_entry {
 
 struct hdd_ut_entry hdd_ut_entries[] = {
 	{ .name = "dsc", .callback = dsc_unit_test },
+	{ .name = "qdf_bench", .callback = qdf_bench_unit_test },
 	{ .name = "qdf_delayed_work", .callback = qdf_delayed_work_unit_test },
 	{ .name = "qdf_ht", .callback = qdf_ht_unit_test },
+	{ .name = "qdf_mempool", .callback = qdf_mempool_unit_test },
 	{ .name = "qdf_periodic_work",
 	  .callback = qdf_periodic_work_unit_test },
 	{ .name = "qdf_ptr_hash", .callback = qdf_ptr_hash_unit_test },
+	{ .name = "qdf_rcu", .callback = qdf_rcu_unit_test },
 	{ .name = "qdf_slist", .callback = qdf_slist_unit_test },
 	{ .name = "qdf_talloc", .callback = qdf_talloc_unit_test },
 	{ .name = "qdf_tracker", .callback = qdf_tracker_unit_test },
@@ -427,6 +427,7 @@ _fixed_srcs = [
 	"cmn/qdf/src/qdf_flex_mem.c",
 	"cmn/qdf/src/qdf_parse.c",
 	"cmn/qdf/src/qdf_platform.c",
+	"cmn/qdf/src/qdf_ptr_rhash.c",
 	"cmn/qdf/src/qdf_str.c",
 	"cmn/qdf/src/qdf_talloc.c",
 	"cmn/qdf/src/qdf_types.c",
@@ -1274,10 +1275,13 @@ _conditional_srcs = {
     },
     "CONFIG_QDF_TEST": {
         True: [
+            "cmn/qdf/test/qdf_bench_test.c",
             "cmn/qdf/test/qdf_delayed_work_test.c",
             "cmn/qdf/test/qdf_hashtable_test.c",
+            "cmn/qdf/test/qdf_mempool_test.c",
             "cmn/qdf/test/qdf_periodic_work_test.c",
             "cmn/qdf/test/qdf_ptr_hash_test.c",
+            "cmn/qdf/test/qdf_rcu_test.c",
             "cmn/qdf/test/qdf_slist_test.c",
             "cmn/qdf/test/qdf_talloc_test.c",
             "cmn/qdf/test/qdf_tracker_test.c",